@@ -162,6 +162,16 @@
 *   -----   XAxiDma_Pause() or XAxiDma_Reset()                 ------
 * </pre>
 *
+* <b>Single Producer, Single Consumer Rings</b>
+*
+* After XAxiDma_BdRingSpscEnable(), a BD ring may be driven by one context
+* that allocates and submits BDs through XAxiDma_BdRingSpscAlloc() and
+* XAxiDma_BdRingSpscToHw(), and another context that retrieves and frees
+* them through XAxiDma_BdRingSpscFromHw() and XAxiDma_BdRingSpscFree(), for
+* example a thread and the completion interrupt handler, without a lock. A
+* whole set of BDs is flushed or invalidated as one cache range and the tail
+* descriptor register is written once per set.
+*
 * <b>Interrupt Coalescing</b>
 *
 * SGDMA provides control over the frequency of interrupts through interrupt
@@ -44,6 +44,8 @@
 *       rsp  01/17/18  Use virtual address for register read/write.
 *                      In _BdRingCreate() assign VA to BdaRestart CR#976392
 * 9.9   rsp  02/05/19  Fix XAxiDma_BdRingFromHw implementation for cyclic mode.
+* 9.14       10/19/26  Added single producer, single consumer ring mode with
+*                      burst submit and retrieve, see XAxiDma_BdRingSpsc*.
 *
 * </pre>
 ******************************************************************************/
@@ -59,6 +61,14 @@
  */
 #define XAXIDMA_STOP_TIMEOUT	500000   /* about 100 milliseconds on 100MHz */
 
+/* Number of BDs invalidated at a time by XAxiDma_BdRingSpscFromHw(), so a
+ * poll of a ring with many BDs still under hardware control does not
+ * invalidate all of them.
+ */
+#ifndef XAXIDMA_SPSC_SYNC_BDS
+#define XAXIDMA_SPSC_SYNC_BDS	16
+#endif
+
 /**************************** Type Definitions *******************************/
 
 
@@ -143,6 +153,10 @@
 
 /************************** Function Prototypes ******************************/
 
+static void XAxiDma_BdRingSyncRange(XAxiDma_BdRing * RingPtr,
+		XAxiDma_Bd * BdPtr, int NumBd, int Flush);
+static void XAxiDma_BdRingWriteTail(XAxiDma_BdRing * RingPtr);
+
 /************************** Variable Definitions *****************************/
 
 
@@ -343,6 +357,7 @@ u32 XAxiDma_BdRingCreate(XAxiDma_BdRing *RingPtr, UINTPTR PhysAddr,
 	RingPtr->PreCnt = 0;
 	RingPtr->PostCnt = 0;
 	RingPtr->Cyclic = 0;
+	RingPtr->SpscEnabled = 0;
 
 	/* Make sure Alignment parameter meets minimum requirements */
 	if (Alignment < XAXIDMA_BD_MINIMUM_ALIGNMENT) {
@@ -572,7 +587,8 @@ int XAxiDma_StartBdRingHw(XAxiDma_BdRing * RingPtr)
 		/* If there are unprocessed BDs then we want the channel to begin
 		 * processing right away
 		 */
-		if (RingPtr->HwCnt > 0) {
+		if ((RingPtr->HwCnt > 0) || (RingPtr->SpscEnabled &&
+		    (RingPtr->SpscHwCnt != RingPtr->SpscPostCnt))) {
 
 			XAXIDMA_CACHE_INVALIDATE(RingPtr->HwTail);
 			if (RingPtr->Cyclic) {
@@ -1379,6 +1395,500 @@ int XAxiDma_BdRingFree(XAxiDma_BdRing * RingPtr, int NumBd,
 
 	return XST_SUCCESS;
 }
+/*****************************************************************************/
+/**
+ * Switch a BD ring to single producer, single consumer mode. In this mode one
+ * context allocates BDs and gives them to hardware with
+ * XAxiDma_BdRingSpscAlloc() and XAxiDma_BdRingSpscToHw(), while another
+ * context retrieves and frees them with XAxiDma_BdRingSpscFromHw() and
+ * XAxiDma_BdRingSpscFree(), without a lock between the two.
+ *
+ * Each side only writes its own ring pointers and counts. The counts are
+ * free running, so the number of BDs in each group is the difference of two
+ * counts, each written by one side only.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return
+ *		- XST_SUCCESS if the ring is now in SPSC mode.
+ *		- XST_DMA_SG_NO_LIST if the ring has not been created.
+ *		- XST_NO_FEATURE if the ring is in cyclic mode.
+ *		- XST_DMA_SG_LIST_ERROR if some of the BDs in this ring are
+ *		under hardware or application control.
+ *
+ * @note	Call after XAxiDma_BdRingCreate() and XAxiDma_BdRingClone(),
+ *		before any BD is allocated. Do not mix the SPSC functions with
+ *		XAxiDma_BdRingAlloc(), XAxiDma_BdRingToHw(),
+ *		XAxiDma_BdRingFromHw() or XAxiDma_BdRingFree() on the same ring.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscEnable(XAxiDma_BdRing * RingPtr)
+{
+	if (RingPtr->AllCnt == 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscEnable: no bds\r\n");
+
+		return XST_DMA_SG_NO_LIST;
+	}
+
+	if (RingPtr->Cyclic) {
+		return XST_NO_FEATURE;
+	}
+
+	if (RingPtr->FreeCnt != RingPtr->AllCnt) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscEnable: BDs in "
+			"use\r\n");
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	RingPtr->SpscAllocCnt = 0;
+	RingPtr->SpscHwCnt = 0;
+	RingPtr->SpscPostCnt = 0;
+	RingPtr->SpscFreeCnt = 0;
+	RingPtr->SpscEnabled = 1;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Reserve locations in the BD ring from the producer side of a ring in SPSC
+ * mode. See XAxiDma_BdRingAlloc() for how the returned set is used.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs to allocate
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for modification.
+ *
+ * @return
+ *		- XST_SUCCESS if the requested number of BDs were returned in
+ *		the BdSetPtr parameter.
+ *		- XST_INVALID_PARAM if passed in NumBd is not positive
+ *		- XST_FAILURE if there were not enough free BDs to satisfy
+ *		the request.
+ *
+ * @note	Call only from the producer side.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd ** BdSetPtr)
+{
+	if (NumBd <= 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscAlloc: negative BD "
+				"number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* Enough free BDs available for the request? */
+	if (XAxiDma_BdRingSpscGetFreeCnt(RingPtr) < NumBd) {
+		return XST_FAILURE;
+	}
+
+	/* Set the return argument and move FreeHead forward */
+	*BdSetPtr = RingPtr->FreeHead;
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->FreeHead, NumBd);
+	RingPtr->SpscAllocCnt += NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Give a set of BDs previously allocated with XAxiDma_BdRingSpscAlloc() to
+ * hardware. Several allocated sets may be given to hardware in one call as
+ * long as they follow each other in the ring.
+ *
+ * Unlike XAxiDma_BdRingToHw(), the BDs of the set are flushed from the data
+ * cache as one range rather than one BD at a time, and the tail descriptor
+ * register is written once for the whole set.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	BdSetPtr is the first BD of the set to commit to hardware.
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was accepted and enqueued to
+ *		hardware
+ *		- XST_INVALID_PARAM if passed in NumBd is negative
+ *		- XST_FAILURE if the set of BDs was rejected because the first
+ *		BD does not have its start-of-packet bit set, or the last BD
+ *		does not have its end-of-packet bit set, or any one of the BDs
+ *		has 0 length.
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingSpscAlloc()
+ *
+ * @note	Call only from the producer side.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscToHw(XAxiDma_BdRing * RingPtr, int NumBd,
+	XAxiDma_Bd * BdSetPtr)
+{
+	XAxiDma_Bd *CurBdPtr;
+	int i;
+	u32 BdCr;
+	u32 BdSts;
+
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscToHw: negative BD "
+			"number %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* If the commit set is empty, do nothing */
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingSpscAlloc() */
+	if (((int)(RingPtr->SpscAllocCnt - RingPtr->SpscHwCnt) < NumBd) ||
+	    (RingPtr->PreHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Bd ring has problems\r\n");
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	CurBdPtr = BdSetPtr;
+	BdCr = XAxiDma_BdGetCtrl(CurBdPtr);
+
+	/* In case of Tx channel, the first BD should have been marked
+	 * as start-of-frame
+	 */
+	if (!(RingPtr->IsRxChannel) && !(BdCr & XAXIDMA_BD_CTRL_TXSOF_MASK)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Tx first BD does not have "
+								"SOF\r\n");
+
+		return XST_FAILURE;
+	}
+
+	/* Clear the completed status bit of every BD in the set */
+	for (i = 0; i < NumBd; i++) {
+
+		/* Make sure the length value in the BD is non-zero. */
+		if (XAxiDma_BdGetLength(CurBdPtr,
+				RingPtr->MaxTransferLen) == 0) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "0 length bd\r\n");
+
+			return XST_FAILURE;
+		}
+
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+		XAxiDma_BdWrite(CurBdPtr, XAXIDMA_BD_STS_OFFSET,
+				BdSts & ~XAXIDMA_BD_STS_COMPLETE_MASK);
+
+		if (i < NumBd - 1) {
+			CurBdPtr = (XAxiDma_Bd *)((void *)
+				XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+		}
+	}
+
+	/* In case of Tx channel, the last BD should have EOF bit set */
+	BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+	if (!(RingPtr->IsRxChannel) && !(BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "Tx last BD does not have "
+								"EOF\r\n");
+
+		return XST_FAILURE;
+	}
+
+	/* Flush the whole set so DMA core could see the updates */
+	XAxiDma_BdRingSyncRange(RingPtr, BdSetPtr, NumBd, TRUE);
+	DATA_SYNC;
+
+	/* This set has completed pre-processing, adjust ring pointers.
+	 * The consumer sees the set once SpscHwCnt is updated.
+	 */
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PreHead, NumBd);
+	RingPtr->HwTail = CurBdPtr;
+	RingPtr->SpscHwCnt += NumBd;
+
+	/* If it is running, signal the engine to begin processing */
+	if (RingPtr->RunState == AXIDMA_CHANNEL_NOT_HALTED) {
+		XAxiDma_BdRingWriteTail(RingPtr);
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Return the set of BDs that have been processed by hardware to the consumer
+ * side of a ring in SPSC mode. See XAxiDma_BdRingFromHw() for how the
+ * returned set is used.
+ *
+ * Unlike XAxiDma_BdRingFromHw(), the BDs under hardware control are
+ * invalidated in the data cache in groups of XAXIDMA_SPSC_SYNC_BDS rather
+ * than one BD at a time.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdLimit is the maximum number of BDs to return in the set. Use
+ *		XAXIDMA_ALL_BDS to return all BDs that have been processed.
+ * @param	BdSetPtr is an output parameter, it points to the first BD
+ *		available for examination.
+ *
+ * @return	The number of BDs processed by hardware. A value of 0 indicates
+ *		that no data is available. No more than BdLimit BDs will be
+ *		returned.
+ *
+ * @note	Call only from the consumer side.
+ *
+ *		If hardware has partially completed a packet spanning multiple
+ *		BDs, then none of the BDs for that packet will be included in
+ *		the results.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+			     XAxiDma_Bd ** BdSetPtr)
+{
+	XAxiDma_Bd *CurBdPtr;
+	int HwCnt;
+	int BdCount;
+	int BdPartialCount;
+	int SyncCount;
+	u32 BdSts;
+	u32 BdCr;
+
+	/* If no BDs in work group, then there's nothing to search */
+	HwCnt = (int)(RingPtr->SpscHwCnt - RingPtr->SpscPostCnt);
+	if (HwCnt == 0) {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+
+	/* Make sure the BDs are read after the count that published them */
+	DATA_SYNC;
+
+	if (BdLimit > HwCnt) {
+		BdLimit = HwCnt;
+	}
+
+	CurBdPtr = RingPtr->HwHead;
+	BdCount = 0;
+	BdPartialCount = 0;
+	SyncCount = 0;
+
+	while (BdCount < BdLimit) {
+		/* Invalidate the next group of BDs to examine */
+		if (BdCount == SyncCount) {
+			SyncCount += XAXIDMA_SPSC_SYNC_BDS;
+			if (SyncCount > BdLimit) {
+				SyncCount = BdLimit;
+			}
+
+			XAxiDma_BdRingSyncRange(RingPtr, CurBdPtr,
+						SyncCount - BdCount, FALSE);
+		}
+
+		/* Read the status */
+		BdSts = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_STS_OFFSET);
+		BdCr = XAxiDma_BdRead(CurBdPtr, XAXIDMA_BD_CTRL_LEN_OFFSET);
+
+		/* If the hardware still hasn't processed this BD then we are
+		 * done
+		 */
+		if (!(BdSts & XAXIDMA_BD_STS_COMPLETE_MASK)) {
+			break;
+		}
+
+		BdCount++;
+
+		/* Keep a count of the BDs of a packet that is not complete
+		 * yet.
+		 *
+		 * For tx BDs, EOF bit is in the control word
+		 * For rx BDs, EOF bit is in the status word
+		 */
+		if (((!(RingPtr->IsRxChannel) &&
+		(BdCr & XAXIDMA_BD_CTRL_TXEOF_MASK)) ||
+		((RingPtr->IsRxChannel) && (BdSts &
+			XAXIDMA_BD_STS_RXEOF_MASK)))) {
+
+			BdPartialCount = 0;
+		}
+		else {
+			BdPartialCount++;
+		}
+
+		/* Move on to the next BD in work group */
+		CurBdPtr = (XAxiDma_Bd *)((void *)XAxiDma_BdRingNext(RingPtr, CurBdPtr));
+	}
+
+	/* Subtract off any partial packet BDs found */
+	BdCount -= BdPartialCount;
+
+	if (BdCount) {
+		*BdSetPtr = RingPtr->HwHead;
+		XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->HwHead, BdCount);
+		RingPtr->SpscPostCnt += BdCount;
+
+		return BdCount;
+	}
+	else {
+		*BdSetPtr = (XAxiDma_Bd *)NULL;
+
+		return 0;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Free a set of BDs previously retrieved with XAxiDma_BdRingSpscFromHw().
+ * Several retrieved sets may be freed in one call as long as they follow
+ * each other in the ring.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	NumBd is the number of BDs to free.
+ * @param	BdSetPtr is the head of a list of BDs returned by
+ *		XAxiDma_BdRingSpscFromHw().
+ *
+ * @return
+ *		- XST_SUCCESS if the set of BDs was freed.
+ *		- XST_INVALID_PARAM if NumBd is negative
+ *		- XST_DMA_SG_LIST_ERROR if this function was called out of
+ *		sequence with XAxiDma_BdRingSpscFromHw().
+ *
+ * @note	Call only from the consumer side.
+ *
+ *		This function can be used only when DMA is in SG mode
+ *
+ *****************************************************************************/
+int XAxiDma_BdRingSpscFree(XAxiDma_BdRing * RingPtr, int NumBd,
+		      XAxiDma_Bd * BdSetPtr)
+{
+	if (NumBd < 0) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR,
+		    "BdRingSpscFree: negative BDs %d\r\n", NumBd);
+
+		return XST_INVALID_PARAM;
+	}
+
+	/* If the BD Set to free is empty, do nothing
+	 */
+	if (NumBd == 0) {
+		return XST_SUCCESS;
+	}
+
+	/* Make sure we are in sync with XAxiDma_BdRingSpscFromHw() */
+	if (((int)(RingPtr->SpscPostCnt - RingPtr->SpscFreeCnt) < NumBd) ||
+	    (RingPtr->PostHead != BdSetPtr)) {
+
+		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingSpscFree: Error free "
+			"BDs\r\n");
+
+		return XST_DMA_SG_LIST_ERROR;
+	}
+
+	XAXIDMA_RING_SEEKAHEAD(RingPtr, RingPtr->PostHead, NumBd);
+
+	/* Make sure the BDs are no longer read before the producer may
+	 * reuse them
+	 */
+	DATA_SYNC;
+	RingPtr->SpscFreeCnt += NumBd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * Flush or invalidate a set of BDs in the data cache. A set that wraps
+ * around the end of the ring is handled as two ranges.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ * @param	BdPtr is the first BD of the set.
+ * @param	NumBd is the number of BDs in the set.
+ * @param	Flush is TRUE to flush, FALSE to invalidate.
+ *
+ * @return	None
+ *
+ * @note	BDs are aligned on at least XAXIDMA_BD_MINIMUM_ALIGNMENT, so the
+ *		range never shares a cache line with BDs outside of the set.
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingSyncRange(XAxiDma_BdRing * RingPtr,
+		XAxiDma_Bd * BdPtr, int NumBd, int Flush)
+{
+	UINTPTR Addr = (UINTPTR)BdPtr;
+	UINTPTR End = RingPtr->LastBdAddr + RingPtr->Separation;
+	u32 Len = (u32)(RingPtr->Separation * NumBd);
+	u32 HeadLen = Len;
+
+	if (Addr + Len > End) {
+		HeadLen = (u32)(End - Addr);
+	}
+
+	if (Flush) {
+		XAXIDMA_CACHE_FLUSH_RANGE(Addr, HeadLen);
+		if (HeadLen < Len) {
+			XAXIDMA_CACHE_FLUSH_RANGE(RingPtr->FirstBdAddr,
+						  Len - HeadLen);
+		}
+	}
+	else {
+		XAXIDMA_CACHE_INVALIDATE_RANGE(Addr, HeadLen);
+		if (HeadLen < Len) {
+			XAXIDMA_CACHE_INVALIDATE_RANGE(RingPtr->FirstBdAddr,
+						       Len - HeadLen);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * Write the tail descriptor register of the channel with HwTail.
+ *
+ * @param	RingPtr is a pointer to the descriptor ring instance to be
+ *		worked on.
+ *
+ * @return	None
+ *
+ * @note	None
+ *
+ *****************************************************************************/
+static void XAxiDma_BdRingWriteTail(XAxiDma_BdRing * RingPtr)
+{
+	UINTPTR TailPhys = XAXIDMA_VIRT_TO_PHYS(RingPtr->HwTail);
+	u32 TailOffset = XAXIDMA_TDESC_OFFSET;
+	u32 TailMsbOffset = XAXIDMA_TDESC_MSB_OFFSET;
+
+	if (RingPtr->IsRxChannel && RingPtr->RingIndex) {
+		TailOffset = XAXIDMA_RX_TDESC0_OFFSET +
+			(RingPtr->RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET;
+		TailMsbOffset = XAXIDMA_RX_TDESC0_MSB_OFFSET +
+			(RingPtr->RingIndex - 1) * XAXIDMA_RX_NDESC_OFFSET;
+	}
+
+	XAxiDma_WriteReg(RingPtr->ChanBase, TailOffset,
+			 (TailPhys & XAXIDMA_DESC_LSB_MASK));
+	if (RingPtr->Addr_ext)
+		XAxiDma_WriteReg(RingPtr->ChanBase, TailMsbOffset,
+				 UPPER_32_BITS(TailPhys));
+}
+
 /*****************************************************************************/
 /**
  * Check the internal data structures of the BD ring for the provided channel.
@@ -1500,7 +2010,25 @@ int XAxiDma_BdRingCheck(XAxiDma_BdRing * RingPtr)
 	}
 
 	/* Verify internal counters add up */
-	if ((RingPtr->HwCnt + RingPtr->PreCnt + RingPtr->FreeCnt +
+	if (RingPtr->SpscEnabled) {
+		/* Each BD is freed after it was retrieved, retrieved after it
+		 * was given to hardware and given to hardware after it was
+		 * allocated
+		 */
+		if (((RingPtr->SpscAllocCnt - RingPtr->SpscFreeCnt) >
+		     (u32)RingPtr->AllCnt) ||
+		    ((RingPtr->SpscHwCnt - RingPtr->SpscFreeCnt) >
+		     (RingPtr->SpscAllocCnt - RingPtr->SpscFreeCnt)) ||
+		    ((RingPtr->SpscPostCnt - RingPtr->SpscFreeCnt) >
+		     (RingPtr->SpscHwCnt - RingPtr->SpscFreeCnt))) {
+
+			xdbg_printf(XDBG_DEBUG_ERROR, "BdRingCheck: internal "
+				"counter error\r\n");
+
+			return XST_DMA_SG_LIST_ERROR;
+		}
+	}
+	else if ((RingPtr->HwCnt + RingPtr->PreCnt + RingPtr->FreeCnt +
 	     RingPtr->PostCnt) != RingPtr->AllCnt) {
 
 		xdbg_printf(XDBG_DEBUG_ERROR, "BdRingCheck: internal counter "
@@ -43,6 +43,8 @@
 *		       backward compatibility.
 * 9.2   vak  15/04/16  Fixed the compilation warnings in axidma driver
 * 9.7   rsp  01/11/18  Use UINTPTR instead of u32 for ChanBase CR#976392
+* 9.14       10/19/26  Added single producer, single consumer ring mode with
+*                      burst submit and retrieve.
 *
 * </pre>
 *
@@ -109,6 +111,16 @@ typedef struct {
 	int AllCnt;		/**< Total Number of BDs for channel */
 	int RingIndex;		/**< Ring Index */
 	int Cyclic;		/**< Check for cyclic DMA Mode */
+
+	/* Single producer, single consumer mode. The counts are free running
+	 * and each one is only written by one side.
+	 */
+	int SpscEnabled;	/**< Ring is used through XAxiDma_BdRingSpsc* */
+	u32 SpscAllocCnt;	/**< BDs allocated, producer only */
+	volatile u32 SpscHwCnt;	/**< BDs given to hardware, producer only */
+	volatile u32 SpscPostCnt; /**< BDs retrieved from hardware, consumer
+				    *  only */
+	volatile u32 SpscFreeCnt; /**< BDs freed, consumer only */
 } XAxiDma_BdRing;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -193,6 +205,24 @@ typedef struct {
 *****************************************************************************/
 #define XAxiDma_BdRingGetFreeCnt(RingPtr)  ((RingPtr)->FreeCnt)
 
+/****************************************************************************/
+/**
+* Return the number of BDs allocatable with XAxiDma_BdRingSpscAlloc().
+*
+* @param	RingPtr is the BD ring to operate on.
+*
+* @return	The number of BDs currently allocatable.
+*
+* @note
+* 		C-style signature:
+*		int XAxiDma_BdRingSpscGetFreeCnt(XAxiDma_BdRing* RingPtr)
+*		Call only from the producer side.
+*
+*****************************************************************************/
+#define XAxiDma_BdRingSpscGetFreeCnt(RingPtr)				\
+	((RingPtr)->AllCnt - (int)((RingPtr)->SpscAllocCnt -		\
+				   (RingPtr)->SpscFreeCnt))
+
 
 /****************************************************************************/
 /**
@@ -508,6 +538,19 @@ int XAxiDma_BdRingSetCoalesce(XAxiDma_BdRing * RingPtr, u32 Counter, u32 Timer);
 void XAxiDma_BdRingGetCoalesce(XAxiDma_BdRing * RingPtr,
 		u32 *CounterPtr, u32 *TimerPtr);
 
+/*
+ * Single producer, single consumer ring functions xaxidma_bdring.c
+ */
+int XAxiDma_BdRingSpscEnable(XAxiDma_BdRing * RingPtr);
+int XAxiDma_BdRingSpscAlloc(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd ** BdSetPtr);
+int XAxiDma_BdRingSpscToHw(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd * BdSetPtr);
+int XAxiDma_BdRingSpscFromHw(XAxiDma_BdRing * RingPtr, int BdLimit,
+		XAxiDma_Bd ** BdSetPtr);
+int XAxiDma_BdRingSpscFree(XAxiDma_BdRing * RingPtr, int NumBd,
+		XAxiDma_Bd * BdSetPtr);
+
 /* The following functions are for debug only
  */
 int XAxiDma_BdRingCheck(XAxiDma_BdRing * RingPtr);
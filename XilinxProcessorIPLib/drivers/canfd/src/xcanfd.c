@@ -60,7 +60,9 @@
 * 2.3  sne  12/18/19 Added Protocol Exception Event and BusOff event support.
 * 2.3	sne  03/06/20 Fixed sending extra frames in XCanFd_Send_Queue API.
 * 2.3	se   03/09/20 Initialize IsPl of config structure.
-*
+* 2.6	     10/19/26 Added XCanFd_RecvBurst() and the receive ring. Moved the
+*		      frame read of XCanFd_SeqRecv_logic() to
+*		      XCanFd_ReadRxFrame().
 *
 * </pre>
 ******************************************************************************/
@@ -76,6 +78,17 @@
 
 /************************** Constant Definitions *****************************/
 
+/* Orders receive ring entry accesses against the ring index updates */
+#if defined(__GNUC__)
+#define XCANFD_RXRING_SYNC() \
+	do { \
+		__asm__ __volatile__("" : : : "memory"); \
+		DATA_SYNC; \
+	} while (0)
+#else
+#define XCANFD_RXRING_SYNC()	DATA_SYNC
+#endif
+
 /**************************** Type Definitions *******************************/
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -88,6 +101,10 @@ static void StubHandler(void);
 static int XCanfd_TrrVal_Get_SetBit_Position(u32 u);
 static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex,
 	   u32 FsrVal, u32 *FramePtr, u8 fifo_no);
+static void XCanFd_ReadRxFrame(XCanFd *InstancePtr, u32 ReadIndex,
+	   u32 *FramePtr, u8 fifo_no);
+static u32 XCanFd_RecvFrames(XCanFd *InstancePtr, u32 *BasePtr, u32 Stride,
+	   u32 Start, u32 Mask, u32 MaxFrames);
 
 /************************** Global Variables ******************************/
 
@@ -144,6 +161,7 @@ int XCanFd_CfgInitialize(XCanFd *InstancePtr, XCanFd_Config *ConfigPtr,
 	InstancePtr->RecvHandler = (XCanFd_SendRecvHandler) StubHandler;
 	InstancePtr->ErrorHandler = (XCanFd_ErrorHandler) StubHandler;
 	InstancePtr->EventHandler = (XCanFd_EventHandler) StubHandler;
+	InstancePtr->RxRingPtr = NULL;
 
 	InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
@@ -720,6 +738,229 @@ u32 XCanFd_Recv_Sequential(XCanFd *InstancePtr, u32 *FramePtr)
 
 }
 
+/*****************************************************************************/
+/**
+*
+* This function receives all CAN/CAN FD frames pending in RX FIFO 0 and RX
+* FIFO 1, up to MaxFrames. Each FSR read takes the frame at the read index of
+* both FIFOs and the read indexes of both FIFOs are incremented with a single
+* FSR write, until both FIFOs are empty.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer of MaxFrames
+*		frames of XCANFD_MAX_FRAME_WORDS words each. Every frame is
+*		written in the XCanFd_Recv_Sequential() format.
+* @param	MaxFrames is the maximum number of frames to receive.
+*
+* @return	Number of frames received, 0 if both FIFOs are empty.
+*
+* @note		This function is meant for Sequential Mode. When both FIFOs
+*		hold frames they are received alternately, use the time stamp
+*		in the DLC word to order them.
+*
+******************************************************************************/
+u32 XCanFd_RecvBurst(XCanFd *InstancePtr, u32 *FramePtr, u32 MaxFrames)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	return XCanFd_RecvFrames(InstancePtr, FramePtr, XCANFD_MAX_FRAME_WORDS,
+				 (u32)0, (u32)0xFFFFFFFFU, MaxFrames);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function attaches a receive ring to the instance. Once attached, the
+* interrupt handler moves all pending frames into the ring with
+* XCanFd_RxRingFill() before it calls the receive handler, and the
+* application takes them with XCanFd_RxRingGet() outside interrupt context.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	RingPtr is a pointer to the ring, or NULL to detach the ring.
+* @param	EntryPtr is a pointer to an array of NumEntries ring entries.
+* @param	NumEntries is the number of entries, a power of 2 of at least
+*		2.
+*
+* @return	- XST_SUCCESS if the ring is attached or detached.
+*		- XST_FAILURE if the core is in Mailbox Mode.
+*
+* @note		Call this function with the receive interrupts disabled.
+*
+******************************************************************************/
+int XCanFd_RxRingInit(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr,
+			XCanFd_RxRingEntry *EntryPtr, u32 NumEntries)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+
+	if (RingPtr == NULL) {
+		InstancePtr->RxRingPtr = NULL;
+		return (s32)XST_SUCCESS;
+	}
+
+	Xil_AssertNonvoid(EntryPtr != NULL);
+	Xil_AssertNonvoid(NumEntries >= (u32)2);
+	Xil_AssertNonvoid((NumEntries & (NumEntries - (u32)1)) == (u32)0);
+
+	if (XCANFD_GET_RX_MODE(InstancePtr) == (u32)1) {
+		return (s32)XST_FAILURE;
+	}
+
+	RingPtr->EntryPtr = EntryPtr;
+	RingPtr->Mask = NumEntries - (u32)1;
+	RingPtr->Head = 0U;
+	RingPtr->Tail = 0U;
+	RingPtr->TsLast = 0U;
+	RingPtr->RingOverflows = 0U;
+	RingPtr->FifoOverflows = 0U;
+	InstancePtr->RxRingPtr = RingPtr;
+
+	return (s32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function moves all frames pending in the RX FIFOs into the receive
+* ring. Frames that do not fit into the ring are received and dropped, so the
+* RX FIFOs keep room for new frames, and are counted in RingOverflows.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+*
+* @return	Number of frames put into the ring.
+*
+* @note		Called by XCanFd_IntrHandler() when a ring is attached. It may
+*		also be called in polled mode, but never concurrently with the
+*		interrupt handler.
+*		The 16 bit time stamp of each frame is extended to 32 bits,
+*		which holds as long as frames are received at least once per
+*		half period of the time stamp counter.
+*
+******************************************************************************/
+u32 XCanFd_RxRingFill(XCanFd *InstancePtr)
+{
+	XCanFd_RxRing *RingPtr;
+	XCanFd_RxRingEntry *EntryPtr;
+	u32 Head;
+	u32 Free;
+	u32 Count;
+	u32 Index;
+	u32 Dropped;
+	u16 TsDelta;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->RxRingPtr != NULL);
+
+	RingPtr = InstancePtr->RxRingPtr;
+	Head = RingPtr->Head;
+
+	Free = (RingPtr->Mask + (u32)1) - (Head - RingPtr->Tail);
+
+	Count = XCanFd_RecvFrames(InstancePtr, RingPtr->EntryPtr[0].Frame,
+			sizeof(XCanFd_RxRingEntry) / sizeof(u32), Head,
+			RingPtr->Mask, Free);
+
+	for (Index = 0U; Index < Count; Index++) {
+		EntryPtr = &RingPtr->EntryPtr[(Head + Index) & RingPtr->Mask];
+		TsDelta = (u16)((EntryPtr->Frame[1] &
+				XCANFD_DLCR_TIMESTAMP_MASK) - RingPtr->TsLast);
+		RingPtr->TsLast += (u32)(s32)(s16)TsDelta;
+		EntryPtr->TimeStamp = RingPtr->TsLast;
+	}
+
+	/* Publish the entries before the new Head */
+	XCANFD_RXRING_SYNC();
+	RingPtr->Head = Head + Count;
+
+	if (Count == Free) {
+		/* The ring is full, drop what is left in the RX FIFOs */
+		Dropped = XCanFd_RecvFrames(InstancePtr,
+				RingPtr->Discard.Frame, (u32)0, (u32)0,
+				(u32)0, (u32)0xFFFFFFFFU);
+		RingPtr->RingOverflows += Dropped;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes the oldest frame from the receive ring.
+*
+* @param	RingPtr is a pointer to the ring.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer of
+*		XCANFD_MAX_FRAME_WORDS words where the frame is written in the
+*		XCanFd_Recv_Sequential() format.
+* @param	TimeStampPtr is a pointer to the extended receive time stamp,
+*		or NULL.
+*
+* @return	- XST_SUCCESS if a frame was taken from the ring.
+*		- XST_NO_DATA if the ring is empty.
+*
+* @note		May be called while the interrupt handler fills the ring, by
+*		one reader only.
+*
+******************************************************************************/
+u32 XCanFd_RxRingGet(XCanFd_RxRing *RingPtr, u32 *FramePtr,
+			u32 *TimeStampPtr)
+{
+	const XCanFd_RxRingEntry *EntryPtr;
+	u32 Tail;
+	u32 Len;
+	u32 Index;
+
+	Xil_AssertNonvoid(RingPtr != NULL);
+	Xil_AssertNonvoid(FramePtr != NULL);
+
+	Tail = RingPtr->Tail;
+	if (Tail == RingPtr->Head) {
+		return (u32)XST_NO_DATA;
+	}
+
+	/* Read the entry only after Head covers it */
+	XCANFD_RXRING_SYNC();
+	EntryPtr = &RingPtr->EntryPtr[Tail & RingPtr->Mask];
+
+	FramePtr[0] = EntryPtr->Frame[0];
+	FramePtr[1] = EntryPtr->Frame[1];
+	Len = (u32)XCanFd_GetDlc2len(EntryPtr->Frame[1] & XCANFD_DLCR_DLC_MASK,
+			EntryPtr->Frame[1] & XCANFD_DLCR_EDL_MASK);
+	for (Index = 0U; (Index * XCANFD_DW_BYTES) < Len; Index++) {
+		FramePtr[(u32)2 + Index] = EntryPtr->Frame[(u32)2 + Index];
+	}
+	if (TimeStampPtr != NULL) {
+		*TimeStampPtr = EntryPtr->TimeStamp;
+	}
+
+	/* Release the entry only after it has been copied */
+	XCANFD_RXRING_SYNC();
+	RingPtr->Tail = Tail + (u32)1;
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of frames held in the receive ring.
+*
+* @param	RingPtr is a pointer to the ring.
+*
+* @return	Number of frames that XCanFd_RxRingGet() can take.
+*
+* @note		None.
+*
+******************************************************************************/
+u32 XCanFd_RxRingCount(const XCanFd_RxRing *RingPtr)
+{
+	Xil_AssertNonvoid(RingPtr != NULL);
+
+	return RingPtr->Head - RingPtr->Tail;
+}
+
 /*****************************************************************************/
 /**
 *
@@ -1817,6 +2058,44 @@ static int XCanfd_TrrVal_Get_SetBit_Position(u32 u) {
 *
 ******************************************************************************/
 static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex, u32 FsrVal, u32 *FramePtr, u8 fifo_no)
+{
+	XCanFd_ReadRxFrame(InstancePtr, ReadIndex, FramePtr, fifo_no);
+
+		/* Set the IRI bit causes core to increment RI in FSR Register */
+		if (fifo_no == (u8)XCANFD_RX_FIFO_0) {
+			FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET);
+			FsrVal |= XCANFD_FSR_IRI_MASK;
+			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET, FsrVal);
+		} else {
+			FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET);
+			FsrVal |= XCANFD_FSR_IRI_1_MASK;
+			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+					XCANFD_FSR_OFFSET, FsrVal);
+		}
+
+		return XST_SUCCESS;
+}
+/*****************************************************************************/
+/**
+* This function reads the CAN/CAN FD Frame at a read index of an RX FIFO. The
+* read index of the FIFO is not changed.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	ReadIndex is the RI(Read Index) of the frame.
+* @param	FramePtr is a pointer to a 32-bit aligned buffer where the
+*		    CAN/CAN FD frame is to be written.
+* @param    	fifo_no is target fifo number
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XCanFd_ReadRxFrame(XCanFd *InstancePtr, u32 ReadIndex,
+	   u32 *FramePtr, u8 fifo_no)
 {
 	u32 DwIndex=0;
 	u32 CanEDL;
@@ -1885,24 +2164,76 @@ static u32 XCanFd_SeqRecv_logic(XCanFd *InstancePtr, u32 ReadIndex, u32 FsrVal,
 				DwIndex++;
 			}
 		}
+}
 
-		/* Set the IRI bit causes core to increment RI in FSR Register */
-		if (fifo_no == (u8)XCANFD_RX_FIFO_0) {
-			FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_FSR_OFFSET);
-			FsrVal |= XCANFD_FSR_IRI_MASK;
-			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_FSR_OFFSET, FsrVal);
-		} else {
-			FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_FSR_OFFSET);
-			FsrVal |= XCANFD_FSR_IRI_1_MASK;
-			XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
-					XCANFD_FSR_OFFSET, FsrVal);
+/*****************************************************************************/
+/**
+* This function receives the frames pending in RX FIFO 0 and RX FIFO 1 into
+* a frame array or ring. Frame k is written at BasePtr +
+* ((Start + k) & Mask) * Stride words.
+*
+* @param	InstancePtr is a pointer to the XCanFd instance to be worked on.
+* @param	BasePtr is a pointer to the first frame of the array or ring.
+* @param	Stride is the distance between two frames in words.
+* @param	Start is the position of the first frame.
+* @param	Mask is the position mask, 0xFFFFFFFF for an array.
+* @param	MaxFrames is the maximum number of frames to receive.
+*
+* @return	Number of frames received.
+*
+* @note		The core increments the read index of a FIFO by one for each
+*		IRI write and the FIFO depth is a design parameter, so FSR is
+*		read once per frame of each FIFO. Both FIFOs share that FSR read
+*		and the FSR write.
+*
+******************************************************************************/
+static u32 XCanFd_RecvFrames(XCanFd *InstancePtr, u32 *BasePtr, u32 Stride,
+	   u32 Start, u32 Mask, u32 MaxFrames)
+{
+	u32 FsrVal;
+	u32 IriVal;
+	u32 Count = 0U;
+
+	FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+			XCANFD_FSR_OFFSET);
+
+	while (Count < MaxFrames) {
+		IriVal = 0U;
+
+		if ((FsrVal & XCANFD_FSR_FL_MASK) != (u32)0) {
+			XCanFd_ReadRxFrame(InstancePtr,
+				FsrVal & XCANFD_FSR_RI_MASK,
+				&BasePtr[((Start + Count) & Mask) * Stride],
+				(u8)XCANFD_RX_FIFO_0);
+			IriVal |= XCANFD_FSR_IRI_MASK;
+			Count++;
 		}
 
-		return XST_SUCCESS;
+		if ((Count < MaxFrames) &&
+			((FsrVal & XCANFD_FSR_FL_1_MASK) != (u32)0)) {
+			XCanFd_ReadRxFrame(InstancePtr,
+				(FsrVal & XCANFD_FSR_RI_1_MASK) >>
+				XCANFD_FSR_RI_1_SHIFT,
+				&BasePtr[((Start + Count) & Mask) * Stride],
+				(u8)XCANFD_RX_FIFO_1);
+			IriVal |= XCANFD_FSR_IRI_1_MASK;
+			Count++;
+		}
+
+		if (IriVal == (u32)0) {
+			break;
+		}
+
+		/* Increment RI of the FIFOs read with one write */
+		XCanFd_WriteReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET, IriVal);
+		FsrVal = XCanFd_ReadReg(InstancePtr->CanFdConfig.BaseAddress,
+				XCANFD_FSR_OFFSET);
+	}
+
+	return Count;
 }
+
 /*****************************************************************************/
 /**
 *
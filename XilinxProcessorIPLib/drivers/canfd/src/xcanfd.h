@@ -255,6 +255,9 @@ exclusion
 * 2.3	sne  03/09/20 Initialize IsPl of config structure.
 * 2.4   sne  08/28/20 Modify Makefile to support parallel make execution.
 * 2.5	sne  11/23/20 Fixed MISRAC violations.
+* 2.6	     10/19/26 Added XCanFd_RecvBurst() and the interrupt driven
+*		      receive ring XCanFd_RxRingInit(), XCanFd_RxRingFill(),
+*		      XCanFd_RxRingGet() and XCanFd_RxRingCount().
 *
 * </pre>
 *
@@ -316,6 +319,14 @@ extern "C" {
 #define XCANFD_RX_FIFO_1	         1 /**< Selection for RX Fifo 1 */
 /** @} */
 
+/** @name Receive ring
+ *  @{
+ */
+#define XCANFD_MAX_FRAME_WORDS	(XCANFD_MAX_FRAME_SIZE / XCANFD_DW_BYTES)
+					/**< Words of a received frame: ID, DLC
+					  *  and up to 16 data words */
+/** @} */
+
 /** @name Callback identifiers used as parameters to XCanFd_SetHandler()
  *  @{
  */
@@ -381,6 +392,34 @@ typedef void (*XCanFd_ErrorHandler) (void *CallBackRef, u32 ErrorMask);
 ******************************************************************************/
 typedef void (*XCanFd_EventHandler) (void *CallBackRef, u32 Mask);
 
+/*****************************************************************************/
+/**
+ * One frame held in the receive ring.
+ */
+typedef struct {
+	u32 Frame[XCANFD_MAX_FRAME_WORDS]; /**< ID, DLC and data words in the
+					     *  XCanFd_Recv_Sequential() format */
+	u32 TimeStamp;	/**< Receive time stamp of the DLC register extended
+			  *  to 32 bits */
+} XCanFd_RxRingEntry;
+
+/**
+ * Receive ring filled from the interrupt handler. The interrupt handler is
+ * the only writer of Head, TsLast and the overflow counters and the reader
+ * is the only writer of Tail, so no lock is needed between them.
+ */
+typedef struct {
+	XCanFd_RxRingEntry *EntryPtr;	/**< Ring entries */
+	u32 Mask;		/**< Number of entries - 1 */
+	volatile u32 Head;	/**< Frames put into the ring, free running */
+	volatile u32 Tail;	/**< Frames taken from the ring, free running */
+	u32 TsLast;		/**< Last extended time stamp */
+	volatile u32 RingOverflows;	/**< Frames dropped because the ring
+					  *  was full */
+	volatile u32 FifoOverflows;	/**< RX FIFO overflow interrupts */
+	XCanFd_RxRingEntry Discard;	/**< Target of dropped frames */
+} XCanFd_RxRing;
+
 /*****************************************************************************/
 /**
  * The XCanFd driver instance data. The user is required to allocate a
@@ -415,6 +454,9 @@ typedef struct {
 	XCanFd_EventHandler EventHandler;
 	void *EventRef;	  /**< This will be passed to the EventHandler callback */
 
+	XCanFd_RxRing *RxRingPtr; /**< Receive ring filled by the interrupt
+				    *  handler, NULL if not used */
+
 }XCanFd;
 
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -1051,6 +1093,13 @@ u32 XCanFd_RxBuff_MailBox_DeActive(XCanFd *InstancePtr, u32 RxBuffer);
 u32 XCanFd_Set_MailBox_IdMask(XCanFd *InstancePtr, u32 RxBuffer,
 						u32 MaskValue, u32 IdValue);
 u32 XCanFd_Recv_Sequential(XCanFd *InstancePtr, u32 *FramePtr);
+u32 XCanFd_RecvBurst(XCanFd *InstancePtr, u32 *FramePtr, u32 MaxFrames);
+int XCanFd_RxRingInit(XCanFd *InstancePtr, XCanFd_RxRing *RingPtr,
+			XCanFd_RxRingEntry *EntryPtr, u32 NumEntries);
+u32 XCanFd_RxRingFill(XCanFd *InstancePtr);
+u32 XCanFd_RxRingGet(XCanFd_RxRing *RingPtr, u32 *FramePtr,
+			u32 *TimeStampPtr);
+u32 XCanFd_RxRingCount(const XCanFd_RxRing *RingPtr);
 u32 XCanFd_Recv_Mailbox(XCanFd *InstancePtr, u32 *FramePtr);
 u32 XCanFd_Recv_TXEvents_Sequential(XCanFd *InstancePtr, u32 *FramePtr);
 void XCanFd_PollQueue_Buffer(XCanFd *InstancePtr);
@@ -27,6 +27,8 @@
 *					   XCanFd_SetRxIntrWatermark : This function has been
 *					   moved to xcanfd_intr.c
 *       ask  07/03/18 Fix for Sequential recv CR# 992606,CR# 1004222.
+* 2.6	     10/19/26 Fill the receive ring, when attached, before calling the
+*		      receive handler.
 * </pre>
 *
 ******************************************************************************/
@@ -449,9 +451,21 @@ void XCanFd_IntrHandler(void *InstancePtr)
 	if ((PendingIntr & (XCANFD_IXR_RXFWMFLL_MASK | XCANFD_IXR_RXOK_MASK \
 			| XCANFD_IXR_RXRBF_MASK | XCANFD_IXR_RXFWMFLL_1_MASK)) !=(u32)0) {
 
+		/*
+		 * With a receive ring the frames are moved to the ring here and
+		 * the receive handler only has to signal the reader.
+		 */
+		if (CanPtr->RxRingPtr != NULL) {
+			(void)XCanFd_RxRingFill(CanPtr);
+		}
 		CanPtr->RecvHandler(CanPtr->RecvRef);
 	}
 
+	if ((CanPtr->RxRingPtr != NULL) && ((PendingIntr &
+		(XCANFD_IXR_RXFOFLW_MASK | XCANFD_IXR_RXFOFLW_1_MASK)) != (u32)0)) {
+		CanPtr->RxRingPtr->FifoOverflows++;
+	}
+
 	/* A frame was transmitted successfully */
 	if ((PendingIntr & (XCANFD_IXR_TXOK_MASK | XCANFD_IXR_TXEWMFLL_MASK)) != (u32)0) {
 		CanPtr->SendHandler(CanPtr->SendRef);
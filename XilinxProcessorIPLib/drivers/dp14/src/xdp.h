@@ -363,6 +363,11 @@
  *                     capability for receiving colorimetry information through
  *                     VSC SDP packets.
  * 7.4   rg   09/26/20 Added support yuv420 color format.
+ *            10/19/26 Added EDID cache to the TX instance and the
+ *                     XDp_TxGetEdidCached, XDp_TxGetRemoteEdidCached and
+ *                     XDp_TxFlushEdidCache APIs.
+ *            10/19/26 Added pipelined sideband message slots to the TX
+ *                     instance and the XDp_TxRefreshTopology API.
  *
  * </pre>
  *
@@ -380,6 +385,33 @@
 #include "xstatus.h"
 #include "xvidc.h"
 
+/************************** Constant Definitions ******************************/
+
+/**
+ * Number of sink EDIDs held by the TX EDID cache. May be overridden at build
+ * time; a value of 0 is not supported.
+ */
+#ifndef XDP_TX_EDID_CACHE_SIZE
+#define XDP_TX_EDID_CACHE_SIZE		4
+#endif
+
+/**
+ * Maximum number of EDID blocks, including block 0, stored per cache entry.
+ * Sinks with more extension blocks are read without being cached.
+ */
+#ifndef XDP_TX_EDID_CACHE_MAX_BLOCKS
+#define XDP_TX_EDID_CACHE_MAX_BLOCKS	4
+#endif
+
+/**
+ * Number of sideband message requests that may be outstanding at the same
+ * time during topology discovery. May be overridden at build time; a value of
+ * 1 sends one request at a time.
+ */
+#ifndef XDP_TX_SBMSG_MAX_PENDING
+#define XDP_TX_SBMSG_MAX_PENDING	4
+#endif
+
 /****************************** Type Definitions ******************************/
 
 /**
@@ -731,6 +763,67 @@ typedef struct {
 						NodeTable. */
 } XDp_TxTopology;
 
+/**
+ * This typedef describes one sink EDID held by the TX EDID cache. An entry is
+ * identified by the sink's position in the topology and by a hash of EDID
+ * block 0 together with the extension block count.
+ */
+typedef struct {
+	u8 IsValid;			/**< The entry holds a sink EDID. */
+	u8 LinkCountTotal;		/**< The total number of DisplayPort
+						links connecting the sink to
+						the DisplayPort TX. */
+	u8 RelativeAddress[15];		/**< The relative address from the
+						DisplayPort TX to the sink. */
+	u8 NumExt;			/**< The extension block count (byte
+						0x7E of block 0). */
+	u8 Checksum;			/**< The checksum of block 0 (byte
+						0x7F), re-read to validate the
+						entry. */
+	u32 Hash;			/**< The hash of EDID block 0. */
+	u32 LastUsed;			/**< Stamp used to select the least
+						recently used entry. */
+	u8 Edid[XDP_TX_EDID_CACHE_MAX_BLOCKS * XDP_EDID_BLOCK_SIZE]; /**< The
+						EDID blocks of the sink. */
+} XDp_TxEdidCacheEntry;
+
+/**
+ * This typedef describes the TX EDID cache.
+ */
+typedef struct {
+	XDp_TxEdidCacheEntry Entry[XDP_TX_EDID_CACHE_SIZE]; /**< The cached
+						sink EDIDs. */
+	u32 Stamp;			/**< Incremented on every access. */
+	u32 Hits;			/**< Accesses validated by the block 0
+						checksum only. */
+	u32 Misses;			/**< Accesses that read the full
+						EDID. */
+} XDp_TxEdidCache;
+
+/**
+ * This typedef describes a sideband message request that was sent without
+ * waiting for its reply. The reply is matched to the request by the link count
+ * total, the relative address and the sequence number of its header.
+ */
+typedef struct {
+	u8 InUse;			/**< The request was sent and the slot
+						has not been released. */
+	u8 Done;			/**< The last fragment of the reply has
+						been received. */
+	u8 LinkCountTotal;		/**< The link count total of the
+						request header. */
+	u8 RelativeAddress[15];		/**< The relative address of the
+						request header. */
+	u8 SeqNum;			/**< The sequence number of the
+						request header. */
+	u32 Status;			/**< XST_SUCCESS if the reply is an
+						acknowledge, XST_FAILURE if it
+						is a NACK. */
+	u8 Length;			/**< The number of bytes of reply
+						data. */
+	u8 Data[256];			/**< The raw reply data. */
+} XDp_TxSbMsgSlot;
+
 /**
  * This typedef describes Audio InfoFrame packet.
  */
@@ -957,6 +1050,16 @@ typedef struct {
 							devices when the driver
 							is running in MST
 							mode. */
+	XDp_TxSbMsgSlot SbMsgSlot[XDP_TX_SBMSG_MAX_PENDING]; /**< Sideband
+							message requests
+							waiting for their
+							reply. */
+	u8 SbMsgPending;			/**< The number of slots in
+							use in SbMsgSlot. */
+	XDp_TxEdidCache EdidCache;		/**< Cache of downstream sink
+							EDIDs used by the
+							XDp_Tx*EdidCached
+							functions. */
 	u32 AuxDelayUs;				/**< Amount of latency in micro-
 							seconds to use between
 							AUX transactions. */
@@ -1527,6 +1630,10 @@ u32 XDp_TxGetDispIdDataBlock(u8 *DisplayIdRaw, u8 SectionTag,
 							u8 **DataBlockPtr);
 u32 XDp_TxGetRemoteTiledDisplayDb(XDp *InstancePtr, u8 *EdidExt,
 		u8 LinkCountTotal, u8 *RelativeAddress, u8 **DataBlockPtr);
+u32 XDp_TxGetEdidCached(XDp *InstancePtr, u8 *Edid, u8 NumBlocks);
+u32 XDp_TxGetRemoteEdidCached(XDp *InstancePtr, u8 LinkCountTotal,
+		u8 *RelativeAddress, u8 *Edid, u8 NumBlocks);
+void XDp_TxFlushEdidCache(XDp *InstancePtr);
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 /* xdp_intr.c: Interrupt handling functions. */
@@ -1569,6 +1676,7 @@ void XDp_TxSetStreamSinkRad(XDp *InstancePtr, u8 Stream, u8 LinkCountTotal,
 /* xdp_mst.c: Multi-stream transport (MST) functions related to MST topology
  * discovery and management. */
 u32 XDp_TxDiscoverTopology(XDp *InstancePtr);
+u32 XDp_TxRefreshTopology(XDp *InstancePtr);
 u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 							u8 *RelativeAddress);
 void XDp_TxTopologySwapSinks(XDp *InstancePtr, u8 Index0, u8 Index1);
@@ -22,14 +22,27 @@
  * Ver   Who  Date     Changes
  * ----- ---- -------- -----------------------------------------------
  * 1.0   als  01/20/15 Initial release. TX code merged from the dptx driver.
+ *            10/19/26 Added XDp_TxGetEdidCached, XDp_TxGetRemoteEdidCached
+ *                     and XDp_TxFlushEdidCache.
  * </pre>
  *
 *******************************************************************************/
 
 /******************************* Include Files ********************************/
 
+#include "string.h"
 #include "xdp.h"
 
+/**************************** Function Prototypes *****************************/
+
+#if XPAR_XDPTXSS_NUM_INSTANCES
+static u32 XDp_TxEdidHash(const u8 *Block);
+static u8 XDp_TxEdidBlocksValid(const u8 *Edid, u16 NumBlocks);
+static u8 XDp_TxEdidSinkMatch(const XDp_TxEdidCacheEntry *Entry,
+				u8 LinkCountTotal, const u8 *RelativeAddress);
+static XDp_TxEdidCacheEntry *XDp_TxEdidCacheAlloc(XDp_TxEdidCache *Cache);
+#endif /* XPAR_XDPTXSS_NUM_INSTANCES */
+
 /**************************** Function Definitions ****************************/
 
 #if XPAR_XDPTXSS_NUM_INSTANCES
@@ -391,5 +404,340 @@ u32 XDp_TxGetRemoteTiledDisplayDb(XDp *InstancePtr, u8 *EdidExt,
 
 	return XST_SUCCESS;
 }
+
+/******************************************************************************/
+/**
+ * This function retrieves an immediately connected RX device's Extended Display
+ * Identification Data (EDID) through the TX EDID cache. See
+ * XDp_TxGetRemoteEdidCached for details.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Edid is a pointer to the buffer to save the EDID to. It must
+ *		hold NumBlocks * XDP_EDID_BLOCK_SIZE bytes.
+ * @param	NumBlocks is the maximum number of EDID blocks, including
+ *		block 0, to save to Edid.
+ *
+ * @return
+ *		- XST_SUCCESS if the EDID was retrieved.
+ *		- XST_ERROR_COUNT_MAX if the EDID read request timed out.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u32 XDp_TxGetEdidCached(XDp *InstancePtr, u8 *Edid, u8 NumBlocks)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid(Edid != NULL);
+	Xil_AssertNonvoid(NumBlocks > 0);
+
+	return XDp_TxGetRemoteEdidCached(InstancePtr, 1, NULL, Edid,
+								NumBlocks);
+}
+
+/******************************************************************************/
+/**
+ * This function retrieves a downstream RX device's Extended Display
+ * Identification Data (EDID), block 0 followed by its extension blocks,
+ * through the TX EDID cache.
+ *
+ * Only the extension block count and the checksum of block 0 are read from
+ * the sink. If a cache entry for the same sink holds an EDID with the same
+ * values, the cached EDID is returned without further I2C transactions.
+ * Otherwise block 0 is read and hashed; if another entry holds an identical
+ * block 0 its extension blocks are reused, else the extension blocks are read
+ * in a single I2C read. Entries are replaced in least recently used order.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the total DisplayPort links connecting the
+ *		DisplayPort TX to the targeted downstream device.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the targeted DisplayPort device.
+ * @param	Edid is a pointer to the buffer to save the EDID to. It must
+ *		hold NumBlocks * XDP_EDID_BLOCK_SIZE bytes.
+ * @param	NumBlocks is the maximum number of EDID blocks, including
+ *		block 0, to save to Edid.
+ *
+ * @return
+ *		- XST_SUCCESS if the EDID was retrieved.
+ *		- XST_ERROR_COUNT_MAX if the EDID read request timed out.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	A sink whose EDID changes without changing the checksum of
+ *		block 0 or the extension block count is not detected;
+ *		XDp_TxFlushEdidCache may be used to force a full read. EDIDs
+ *		with a bad block checksum or more than
+ *		XDP_TX_EDID_CACHE_MAX_BLOCKS blocks are not cached.
+ *
+*******************************************************************************/
+u32 XDp_TxGetRemoteEdidCached(XDp *InstancePtr, u8 LinkCountTotal,
+			u8 *RelativeAddress, u8 *Edid, u8 NumBlocks)
+{
+	u32 Status;
+	XDp_TxEdidCache *Cache;
+	XDp_TxEdidCacheEntry *Entry;
+	XDp_TxEdidCacheEntry *Src;
+	u8 Tail[2];
+	u8 NumExt;
+	u8 Checksum;
+	u16 TotalBlocks;
+	u16 CopyBlocks;
+	u32 Hash;
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+	Xil_AssertNonvoid(LinkCountTotal > 0);
+	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
+	Xil_AssertNonvoid(Edid != NULL);
+	Xil_AssertNonvoid(NumBlocks > 0);
+
+	Cache = &InstancePtr->TxInstance.EdidCache;
+	Cache->Stamp++;
+
+	/* Read the extension block count and the checksum of block 0. */
+	Status = XDp_TxRemoteIicRead(InstancePtr, LinkCountTotal,
+		RelativeAddress, XDP_EDID_ADDR, XDP_EDID_EXT_BLOCK_COUNT, 2,
+									Tail);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+	NumExt = Tail[0];
+	Checksum = Tail[1];
+	TotalBlocks = NumExt + 1;
+	CopyBlocks = (TotalBlocks < NumBlocks) ? TotalBlocks : NumBlocks;
+
+	/* Look for an entry of this sink that is still valid. */
+	for (Index = 0; Index < XDP_TX_EDID_CACHE_SIZE; Index++) {
+		Entry = &Cache->Entry[Index];
+		if (Entry->IsValid && (Entry->NumExt == NumExt) &&
+				(Entry->Checksum == Checksum) &&
+				XDp_TxEdidSinkMatch(Entry, LinkCountTotal,
+							RelativeAddress)) {
+			memcpy(Edid, Entry->Edid,
+					CopyBlocks * XDP_EDID_BLOCK_SIZE);
+			Entry->LastUsed = Cache->Stamp;
+			Cache->Hits++;
+			return XST_SUCCESS;
+		}
+	}
+	Cache->Misses++;
+
+	/* The EDID is too large to be cached; read it directly. */
+	if (TotalBlocks > XDP_TX_EDID_CACHE_MAX_BLOCKS) {
+		return XDp_TxRemoteIicRead(InstancePtr, LinkCountTotal,
+			RelativeAddress, XDP_EDID_ADDR, 0,
+			CopyBlocks * XDP_EDID_BLOCK_SIZE, Edid);
+	}
+
+	/* Read block 0 and look for an entry holding the same EDID, for
+	 * example the same monitor seen on another port. */
+	Status = XDp_TxGetRemoteEdidBlock(InstancePtr, Edid, 0,
+					LinkCountTotal, RelativeAddress);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+	Hash = XDp_TxEdidHash(Edid);
+
+	Src = NULL;
+	for (Index = 0; Index < XDP_TX_EDID_CACHE_SIZE; Index++) {
+		Entry = &Cache->Entry[Index];
+		if (Entry->IsValid && (Entry->Hash == Hash) &&
+				(Entry->NumExt == NumExt) &&
+				(memcmp(Entry->Edid, Edid,
+					XDP_EDID_BLOCK_SIZE) == 0)) {
+			Src = Entry;
+			break;
+		}
+	}
+
+	Entry = XDp_TxEdidCacheAlloc(Cache);
+	if ((Src != NULL) && (Src != Entry)) {
+		memcpy(Entry->Edid, Src->Edid,
+				TotalBlocks * XDP_EDID_BLOCK_SIZE);
+	}
+	else if (Src == NULL) {
+		memcpy(Entry->Edid, Edid, XDP_EDID_BLOCK_SIZE);
+
+		/* Read all extension blocks in one transfer. */
+		if (NumExt > 0) {
+			Status = XDp_TxRemoteIicRead(InstancePtr,
+				LinkCountTotal, RelativeAddress, XDP_EDID_ADDR,
+				XDP_EDID_BLOCK_SIZE,
+				NumExt * XDP_EDID_BLOCK_SIZE,
+				&Entry->Edid[XDP_EDID_BLOCK_SIZE]);
+			if (Status != XST_SUCCESS) {
+				return Status;
+			}
+		}
+	}
+
+	memcpy(Edid, Entry->Edid, CopyBlocks * XDP_EDID_BLOCK_SIZE);
+
+	/* Do not keep an EDID that was corrupted on the way. */
+	if (!XDp_TxEdidBlocksValid(Entry->Edid, TotalBlocks) ||
+					(Entry->Edid[0x7F] != Checksum)) {
+		return XST_SUCCESS;
+	}
+
+	Entry->LinkCountTotal = LinkCountTotal;
+	memset(Entry->RelativeAddress, 0, sizeof(Entry->RelativeAddress));
+	if (LinkCountTotal > 1) {
+		memcpy(Entry->RelativeAddress, RelativeAddress,
+							LinkCountTotal - 1);
+	}
+	Entry->NumExt = NumExt;
+	Entry->Checksum = Checksum;
+	Entry->Hash = Hash;
+	Entry->LastUsed = Cache->Stamp;
+	Entry->IsValid = 1;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function invalidates all entries of the TX EDID cache and clears its
+ * statistics.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XDp_TxFlushEdidCache(XDp *InstancePtr)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	memset(&InstancePtr->TxInstance.EdidCache, 0, sizeof(XDp_TxEdidCache));
+}
+
+/******************************************************************************/
+/**
+ * This function calculates the 32-bit FNV-1a hash of an EDID block.
+ *
+ * @param	Block is a pointer to the XDP_EDID_BLOCK_SIZE byte block.
+ *
+ * @return	The hash of the block.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxEdidHash(const u8 *Block)
+{
+	u32 Hash = 0x811C9DC5;
+	u8 Index;
+
+	for (Index = 0; Index < XDP_EDID_BLOCK_SIZE; Index++) {
+		Hash ^= Block[Index];
+		Hash *= 0x01000193;
+	}
+
+	return Hash;
+}
+
+/******************************************************************************/
+/**
+ * This function checks that every block of an EDID sums to zero.
+ *
+ * @param	Edid is a pointer to the EDID blocks.
+ * @param	NumBlocks is the number of blocks to check.
+ *
+ * @return	1 if all block checksums are correct, 0 otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XDp_TxEdidBlocksValid(const u8 *Edid, u16 NumBlocks)
+{
+	u16 Index;
+	u8 Sum;
+
+	while (NumBlocks-- > 0) {
+		Sum = 0;
+		for (Index = 0; Index < XDP_EDID_BLOCK_SIZE; Index++) {
+			Sum += Edid[Index];
+		}
+		if (Sum != 0) {
+			return 0;
+		}
+		Edid += XDP_EDID_BLOCK_SIZE;
+	}
+
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function checks whether a cache entry belongs to the sink at the given
+ * position in the topology.
+ *
+ * @param	Entry is a pointer to the cache entry.
+ * @param	LinkCountTotal is the total DisplayPort links connecting the
+ *		DisplayPort TX to the sink.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the sink.
+ *
+ * @return	1 if the entry belongs to the sink, 0 otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XDp_TxEdidSinkMatch(const XDp_TxEdidCacheEntry *Entry,
+				u8 LinkCountTotal, const u8 *RelativeAddress)
+{
+	if (Entry->LinkCountTotal != LinkCountTotal) {
+		return 0;
+	}
+	if ((LinkCountTotal > 1) && (memcmp(Entry->RelativeAddress,
+				RelativeAddress, LinkCountTotal - 1) != 0)) {
+		return 0;
+	}
+
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function selects the cache entry to fill: an unused entry if there is
+ * one, otherwise the least recently used entry. The entry is invalidated.
+ *
+ * @param	Cache is a pointer to the TX EDID cache.
+ *
+ * @return	A pointer to the selected entry.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XDp_TxEdidCacheEntry *XDp_TxEdidCacheAlloc(XDp_TxEdidCache *Cache)
+{
+	XDp_TxEdidCacheEntry *Victim = &Cache->Entry[0];
+	u8 Index;
+
+	for (Index = 0; Index < XDP_TX_EDID_CACHE_SIZE; Index++) {
+		if (!Cache->Entry[Index].IsValid) {
+			Victim = &Cache->Entry[Index];
+			break;
+		}
+		if ((Cache->Stamp - Cache->Entry[Index].LastUsed) >
+					(Cache->Stamp - Victim->LastUsed)) {
+			Victim = &Cache->Entry[Index];
+		}
+	}
+	Victim->IsValid = 0;
+
+	return Victim;
+}
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 /** @} */
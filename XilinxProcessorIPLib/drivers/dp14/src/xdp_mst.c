@@ -27,6 +27,16 @@
  * 5.2  aad  01/24/16 XDp_RxAllocatePayloadStream now adjusts to timeslot
  *			   rearragement
  * 6.0	tu   05/30/17 Initialized variable in XDp_RxDeviceInfoToRawData
+ *                  10/19/26 XDp_TxRemoteIicRead now requests each chunk once
+ *			   in bursts of up to XDP_TX_REMOTE_IIC_READ_MAX_BYTES
+ *			   instead of re-requesting all remaining bytes for
+ *			   every 16 byte step.
+ *                  10/19/26 Topology discovery keeps LINK_ADDRESS requests to
+ *			   several branches outstanding and matches replies by
+ *			   header. Added XDp_TxRefreshTopology. Fixed the port
+ *			   GUID copy in XDp_TxGetDeviceInfoFromSbMsgLinkAddress.
+ *                  10/19/26 XDp_TxReceiveSbMsg discards late replies to
+ *			   abandoned pipelined requests.
  * </pre>
  *
 *******************************************************************************/
@@ -49,6 +59,10 @@
 /* Error out if waiting for the RX device to indicate that it has received an
  * ACT trigger takes more than 30 AUX read iterations. */
 #define XDP_TX_VCP_TABLE_MAX_TIMEOUT_COUNT 30
+/* The maximum number of bytes requested by a single REMOTE_I2C_READ sideband
+ * message; the reply, including its 3 byte header, must fit the 8-bit length
+ * of a sideband reply. */
+#define XDP_TX_REMOTE_IIC_READ_MAX_BYTES 128
 #endif
 
 /****************************** Type Definitions ******************************/
@@ -162,6 +176,23 @@ static void XDp_TxGetDeviceInfoFromSbMsgLinkAddress(
 			XDp_SidebandReply *SbReply,
 			XDp_SbMsgLinkAddressReplyDeviceInfo *FormatReply);
 static u32 XDp_TxSendActTrigger(XDp *InstancePtr);
+static u32 XDp_TxWalkTopology(XDp *InstancePtr, u8 LinkCountTotal,
+			u8 *RelativeAddress, u8 *VerifyIndex);
+static u8 XDp_TxNodeMatches(XDp_TxTopologyNode *Node, u8 *Guid,
+			u8 DeviceType, u8 LinkCountTotal, u8 *RelativeAddress,
+			u8 DpcdRev, u8 MsgCapStatus);
+static void XDp_TxPrefetchBranches(XDp *InstancePtr, u8 StartIndex);
+static XDp_TxSbMsgSlot *XDp_TxSbMsgFindSlot(XDp *InstancePtr,
+			u8 LinkCountTotal, u8 *RelativeAddress, u8 SeqNum);
+static XDp_TxSbMsgSlot *XDp_TxSbMsgSubmitLinkAddress(XDp *InstancePtr,
+			u8 LinkCountTotal, u8 *RelativeAddress);
+static u32 XDp_TxFetchLinkAddress(XDp *InstancePtr, u8 LinkCountTotal,
+			u8 *RelativeAddress,
+			XDp_SbMsgLinkAddressReplyDeviceInfo *DeviceInfo);
+static u8 XDp_TxSbMsgRoute(XDp *InstancePtr, XDp_SidebandMsg *Msg);
+static u32 XDp_TxSbMsgWaitSlot(XDp *InstancePtr, XDp_TxSbMsgSlot *Slot);
+static void XDp_TxSbMsgReleaseSlot(XDp *InstancePtr, XDp_TxSbMsgSlot *Slot);
+static void XDp_TxSbMsgDrain(XDp *InstancePtr);
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 static u32 XDp_SendSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg);
@@ -172,6 +203,7 @@ static void XDp_RxReadDownReq(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 
 #if XPAR_XDPTXSS_NUM_INSTANCES
 static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply);
+static u32 XDp_TxReadSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg);
 static u32 XDp_TxWaitSbReply(XDp *InstancePtr);
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
@@ -639,6 +671,65 @@ u32 XDp_TxDiscoverTopology(XDp *InstancePtr)
 	return XDp_TxFindAccessibleDpDevices(InstancePtr, 1, RelativeAddress);
 }
 
+/******************************************************************************/
+/**
+ * This function will check that the topology found by a previous discovery is
+ * still connected. A LINK_ADDRESS sideband message is sent to every branch
+ * device of the topology, with up to XDP_TX_SBMSG_MAX_PENDING requests
+ * outstanding at a time, and the replies are compared with the topology's node
+ * table. If any GUID, relative address, device type or plug status differs, or
+ * no topology was discovered yet, the topology is cleared and discovered
+ * again using XDp_TxDiscoverTopology.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the topology is unchanged or was discovered
+ *		  again successfully.
+ *		- XST_FAILURE otherwise - if sending a LINK_ADDRESS sideband
+ *		  message to one of the branch devices in the topology failed.
+ *
+ * @note	When the topology is unchanged, the node table and the sink
+ *		list, including any reordering done by XDp_TxTopologySwapSinks
+ *		or XDp_TxTopologySortSinksByTiling, are left as they are and no
+ *		GUIDs are written.
+ *
+*******************************************************************************/
+u32 XDp_TxRefreshTopology(XDp *InstancePtr)
+{
+	u32 Status;
+	u8 VerifyIndex = 0;
+	u8 RelativeAddress[15];
+	XDp_TxTopology *Topology;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(XDp_GetCoreType(InstancePtr) == XDP_TX);
+
+	Topology = &InstancePtr->TxInstance.Topology;
+
+	if (Topology->NodeTotal > 0) {
+		/* All branch addresses are known; request them up front. */
+		XDp_TxPrefetchBranches(InstancePtr, 0);
+
+		Status = XDp_TxWalkTopology(InstancePtr, 1, RelativeAddress,
+								&VerifyIndex);
+		XDp_TxSbMsgDrain(InstancePtr);
+
+		if ((Status == XST_SUCCESS) &&
+					(VerifyIndex == Topology->NodeTotal)) {
+			return XST_SUCCESS;
+		}
+	}
+
+	/* The topology changed; discover it again. */
+	Topology->NodeTotal = 0;
+	Topology->SinkTotal = 0;
+
+	return XDp_TxDiscoverTopology(InstancePtr);
+}
+
 /******************************************************************************/
 /**
  * This function will explore the DisplayPort topology of downstream devices
@@ -665,18 +756,16 @@ u32 XDp_TxDiscoverTopology(XDp *InstancePtr)
  *
  * @note	The contents of the InstancePtr->TxInstance.Topology structure
  *		will be modified.
+ * @note	The LINK_ADDRESS requests to the downstream branches of a
+ *		branch are sent as soon as its reply is received, without
+ *		waiting for the replies of the earlier ones. Nodes are still
+ *		added to the topology in depth-first order.
  *
 *******************************************************************************/
 u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 							u8 *RelativeAddress)
 {
 	u32 Status;
-	u8 Index;
-	u8 NumDownBranches = 0;
-	u8 OverallFailures = 0;
-	XDp_TxTopology *Topology;
-	XDp_SbMsgLinkAddressReplyPortDetail *PortDetails;
-	static XDp_SbMsgLinkAddressReplyDeviceInfo DeviceInfo;
 
 	/* Verify arguments. */
 	Xil_AssertNonvoid(InstancePtr != NULL);
@@ -685,85 +774,14 @@ u32 XDp_TxFindAccessibleDpDevices(XDp *InstancePtr, u8 LinkCountTotal,
 	Xil_AssertNonvoid(LinkCountTotal > 0);
 	Xil_AssertNonvoid((RelativeAddress != NULL) || (LinkCountTotal == 1));
 
-	Topology = &InstancePtr->TxInstance.Topology;
-
-	/* Send a LINK_ADDRESS sideband message to the branch device in order to
-	 * obtain information on it and its downstream devices. */
-	Status = XDp_TxSendSbMsgLinkAddress(InstancePtr, LinkCountTotal,
-						RelativeAddress, &DeviceInfo);
-	if (Status != XST_SUCCESS) {
-		/* The LINK_ADDRESS was sent to a device that cannot reply; exit
-		 * from this recursion path. */
-		return XST_FAILURE;
-	}
-
-	/* Write GUID to the branch device if it doesn't already have one. */
-	XDp_TxIssueGuid(InstancePtr, LinkCountTotal, RelativeAddress, Topology,
-							DeviceInfo.Guid);
-
-	/* Add the branch device to the topology table. */
-	XDp_TxAddBranchToList(InstancePtr, &DeviceInfo, LinkCountTotal,
-							RelativeAddress);
-
-	/* Downstream devices will be an extra link away from the source than
-	 * this branch device. */
-	LinkCountTotal++;
-
-	u8 DownBranchesDownPorts[DeviceInfo.NumPorts];
-	for (Index = 0; Index < DeviceInfo.NumPorts; Index++) {
-		PortDetails = &DeviceInfo.PortDetails[Index];
-		/* Any downstream device downstream device will have the RAD of
-		 * the current branch device appended with the port number. */
-		RelativeAddress[LinkCountTotal - 2] = PortDetails->PortNum;
-
-		if ((PortDetails->InputPort == 0) &&
-					(PortDetails->PeerDeviceType != 0x2) &&
-					(PortDetails->DpDevPlugStatus == 1)) {
-
-			if ((PortDetails->MsgCapStatus == 1) &&
-					(PortDetails->DpcdRev >= 0x12)) {
-				/* Write GUID to the branch device if it
-				 * doesn't already have one. */
-				XDp_TxIssueGuid(InstancePtr,
-					LinkCountTotal, RelativeAddress,
-					Topology, PortDetails->Guid);
-			}
-
-			XDp_TxAddSinkToList(InstancePtr, PortDetails,
-					LinkCountTotal,
-					RelativeAddress);
-		}
-
-		if (PortDetails->PeerDeviceType == 0x2) {
-			DownBranchesDownPorts[NumDownBranches] =
-							PortDetails->PortNum;
-			NumDownBranches++;
-		}
-	}
+	Status = XDp_TxWalkTopology(InstancePtr, LinkCountTotal,
+						RelativeAddress, NULL);
 
-	for (Index = 0; Index < NumDownBranches; Index++) {
-		/* Any downstream device downstream device will have the RAD of
-		 * the current branch device appended with the port number. */
-		RelativeAddress[LinkCountTotal - 2] =
-						DownBranchesDownPorts[Index];
-
-		/* Found a branch device; recurse the algorithm to see what
-		 * DisplayPort devices are connected to it with the appended
-		 * RAD. */
-		Status = XDp_TxFindAccessibleDpDevices(InstancePtr,
-					LinkCountTotal, RelativeAddress);
-		if (Status != XST_SUCCESS) {
-			/* Keep trying to discover the topology, but the top
-			 * level function call should indicate that a failure
-			 * was detected. */
-			OverallFailures++;
-		}
-	}
+	/* Collect the replies of requests that were not needed after a
+	 * failure. */
+	XDp_TxSbMsgDrain(InstancePtr);
 
-	if (OverallFailures != 0) {
-		return XST_FAILURE;
-	}
-	return XST_SUCCESS;
+	return Status;
 }
 
 /******************************************************************************/
@@ -1167,30 +1185,31 @@ u32 XDp_TxRemoteIicRead(XDp *InstancePtr, u8 LinkCountTotal,
 		return Status;
 	}
 
-	/* Send I2C read message in 16 byte chunks. */
+	/* Send I2C read messages in the largest chunks allowed. */
 	while (BytesLeft > 0) {
-		/* Read a maximum of 16 bytes. */
-		if ((NumBytesLeftInSeg >= 16) && (BytesLeft >= 16)) {
-			CurrBytesToRead = 16;
-		}
 		/* Read the remaining number of bytes as requested. */
-		else if (NumBytesLeftInSeg >= BytesLeft) {
-			CurrBytesToRead = BytesLeft;
+		if (NumBytesLeftInSeg >= BytesLeft) {
+			CurrBytesToRead = (BytesLeft >
+				XDP_TX_REMOTE_IIC_READ_MAX_BYTES) ?
+				XDP_TX_REMOTE_IIC_READ_MAX_BYTES : BytesLeft;
 		}
 		/* Read the remaining data in the current segment boundary. */
 		else {
-			CurrBytesToRead = NumBytesLeftInSeg;
+			CurrBytesToRead = (NumBytesLeftInSeg >
+				XDP_TX_REMOTE_IIC_READ_MAX_BYTES) ?
+				XDP_TX_REMOTE_IIC_READ_MAX_BYTES :
+				NumBytesLeftInSeg;
 		}
 
 		/* Send remote I2C read sideband message. */
 		Status = XDp_TxSendSbMsgRemoteIicRead(InstancePtr,
 			LinkCountTotal, RelativeAddress, IicAddress, Offset,
-			BytesLeft, ReadData);
+			CurrBytesToRead, ReadData);
 		if (Status != XST_SUCCESS) {
 			return Status;
 		}
 
-		/* Previous I2C read was 16 bytes; prepare for next read. */
+		/* Prepare for the next read. */
 		if (BytesLeft > CurrBytesToRead) {
 			BytesLeft -= CurrBytesToRead;
 			Offset += CurrBytesToRead;
@@ -3340,6 +3359,249 @@ static void XDp_TxAddSinkToList(XDp *InstancePtr,
 	Topology->SinkTotal++;
 }
 
+/******************************************************************************/
+/**
+ * This function will explore, or verify, the DisplayPort topology of
+ * downstream devices starting from the branch device specified by the
+ * LinkCountTotal and RelativeAddress parameters. It implements
+ * XDp_TxFindAccessibleDpDevices and XDp_TxRefreshTopology.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the total DisplayPort links connecting the
+ *		DisplayPort TX to the current downstream device in the
+ *		recursion.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the current target DisplayPort device in the
+ *		recursion.
+ * @param	VerifyIndex is NULL to add the devices found to the topology.
+ *		Otherwise the devices found are compared with the topology's
+ *		node table starting at the index it points to, which is
+ *		advanced past every matching node; no GUIDs are written.
+ *
+ * @return
+ *		- XST_SUCCESS if the topology discovery, or verification, is
+ *		  successful.
+ *		- XST_FAILURE otherwise - if sending a LINK_ADDRESS sideband
+ *		  message to one of the branch devices in the topology failed
+ *		  or, when verifying, a device does not match the node table.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxWalkTopology(XDp *InstancePtr, u8 LinkCountTotal,
+			u8 *RelativeAddress, u8 *VerifyIndex)
+{
+	u32 Status;
+	u8 Index;
+	u8 NumDownBranches = 0;
+	u8 OverallFailures = 0;
+	XDp_TxTopology *Topology;
+	XDp_SbMsgLinkAddressReplyPortDetail *PortDetails;
+	static XDp_SbMsgLinkAddressReplyDeviceInfo DeviceInfo;
+
+	Topology = &InstancePtr->TxInstance.Topology;
+
+	/* Obtain the reply to a LINK_ADDRESS sideband message sent to the
+	 * branch device in order to obtain information on it and its
+	 * downstream devices. */
+	Status = XDp_TxFetchLinkAddress(InstancePtr, LinkCountTotal,
+						RelativeAddress, &DeviceInfo);
+	if (Status != XST_SUCCESS) {
+		/* The LINK_ADDRESS was sent to a device that cannot reply; exit
+		 * from this recursion path. */
+		return XST_FAILURE;
+	}
+
+	if (VerifyIndex == NULL) {
+		/* Write GUID to the branch device if it doesn't already have
+		 * one. */
+		XDp_TxIssueGuid(InstancePtr, LinkCountTotal, RelativeAddress,
+						Topology, DeviceInfo.Guid);
+
+		/* Add the branch device to the topology table. */
+		XDp_TxAddBranchToList(InstancePtr, &DeviceInfo, LinkCountTotal,
+							RelativeAddress);
+	}
+	else {
+		if ((*VerifyIndex >= Topology->NodeTotal) ||
+				!XDp_TxNodeMatches(
+					&Topology->NodeTable[*VerifyIndex],
+					DeviceInfo.Guid, 0x02, LinkCountTotal,
+					RelativeAddress, 0x12, 1)) {
+			return XST_FAILURE;
+		}
+		(*VerifyIndex)++;
+
+		/* Keep requests to the following branches outstanding. */
+		XDp_TxPrefetchBranches(InstancePtr, *VerifyIndex);
+	}
+
+	/* Downstream devices will be an extra link away from the source than
+	 * this branch device. */
+	LinkCountTotal++;
+
+	/* Request the information of the downstream branch devices now so
+	 * that their replies arrive while this branch is processed. */
+	if (VerifyIndex == NULL) {
+		for (Index = 0; Index < DeviceInfo.NumPorts; Index++) {
+			PortDetails = &DeviceInfo.PortDetails[Index];
+			if (PortDetails->PeerDeviceType == 0x2) {
+				RelativeAddress[LinkCountTotal - 2] =
+							PortDetails->PortNum;
+				XDp_TxSbMsgSubmitLinkAddress(InstancePtr,
+					LinkCountTotal, RelativeAddress);
+			}
+		}
+	}
+
+	u8 DownBranchesDownPorts[DeviceInfo.NumPorts];
+	for (Index = 0; Index < DeviceInfo.NumPorts; Index++) {
+		PortDetails = &DeviceInfo.PortDetails[Index];
+		/* Any downstream device downstream device will have the RAD of
+		 * the current branch device appended with the port number. */
+		RelativeAddress[LinkCountTotal - 2] = PortDetails->PortNum;
+
+		if ((PortDetails->InputPort == 0) &&
+					(PortDetails->PeerDeviceType != 0x2) &&
+					(PortDetails->DpDevPlugStatus == 1)) {
+
+			if (VerifyIndex != NULL) {
+				if ((*VerifyIndex >= Topology->NodeTotal) ||
+					!XDp_TxNodeMatches(
+					&Topology->NodeTable[*VerifyIndex],
+					PortDetails->Guid,
+					PortDetails->PeerDeviceType,
+					LinkCountTotal, RelativeAddress,
+					PortDetails->DpcdRev,
+					PortDetails->MsgCapStatus)) {
+					return XST_FAILURE;
+				}
+				(*VerifyIndex)++;
+			}
+			else {
+				if ((PortDetails->MsgCapStatus == 1) &&
+					(PortDetails->DpcdRev >= 0x12)) {
+					/* Write GUID to the branch device if it
+					 * doesn't already have one. */
+					XDp_TxIssueGuid(InstancePtr,
+						LinkCountTotal, RelativeAddress,
+						Topology, PortDetails->Guid);
+				}
+
+				XDp_TxAddSinkToList(InstancePtr, PortDetails,
+						LinkCountTotal,
+						RelativeAddress);
+			}
+		}
+
+		if (PortDetails->PeerDeviceType == 0x2) {
+			DownBranchesDownPorts[NumDownBranches] =
+							PortDetails->PortNum;
+			NumDownBranches++;
+		}
+	}
+
+	for (Index = 0; Index < NumDownBranches; Index++) {
+		/* Any downstream device downstream device will have the RAD of
+		 * the current branch device appended with the port number. */
+		RelativeAddress[LinkCountTotal - 2] =
+						DownBranchesDownPorts[Index];
+
+		/* Found a branch device; recurse the algorithm to see what
+		 * DisplayPort devices are connected to it with the appended
+		 * RAD. */
+		Status = XDp_TxWalkTopology(InstancePtr, LinkCountTotal,
+					RelativeAddress, VerifyIndex);
+		if (Status != XST_SUCCESS) {
+			if (VerifyIndex != NULL) {
+				/* The topology changed. */
+				return XST_FAILURE;
+			}
+			/* Keep trying to discover the topology, but the top
+			 * level function call should indicate that a failure
+			 * was detected. */
+			OverallFailures++;
+		}
+	}
+
+	if (OverallFailures != 0) {
+		return XST_FAILURE;
+	}
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function will compare a topology node with the information of a
+ * device found in a LINK_ADDRESS sideband message reply.
+ *
+ * @param	Node is a pointer to the topology node to compare.
+ * @param	Guid is the GUID of the device.
+ * @param	DeviceType is the type of the device.
+ * @param	LinkCountTotal is the number of DisplayPort links from the
+ *		DisplayPort source to the device.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the device.
+ * @param	DpcdRev is the DPCD revision of the device.
+ * @param	MsgCapStatus is the sideband message capability of the device.
+ *
+ * @return	1 if the node describes the device, 0 otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XDp_TxNodeMatches(XDp_TxTopologyNode *Node, u8 *Guid,
+			u8 DeviceType, u8 LinkCountTotal, u8 *RelativeAddress,
+			u8 DpcdRev, u8 MsgCapStatus)
+{
+	if ((Node->DeviceType != DeviceType) ||
+			(Node->LinkCountTotal != LinkCountTotal) ||
+			(Node->DpcdRev != DpcdRev) ||
+			(Node->MsgCapStatus != MsgCapStatus)) {
+		return 0;
+	}
+	if (memcmp(Node->Guid, Guid, XDP_GUID_NBYTES) != 0) {
+		return 0;
+	}
+	if ((LinkCountTotal > 1) && (memcmp(Node->RelativeAddress,
+				RelativeAddress, LinkCountTotal - 1) != 0)) {
+		return 0;
+	}
+
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function will send LINK_ADDRESS sideband messages, without waiting for
+ * their replies, to the branch devices of the topology's node table starting
+ * at the given index, until all sideband message slots are in use.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	StartIndex is the index in the node table to start from.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XDp_TxPrefetchBranches(XDp *InstancePtr, u8 StartIndex)
+{
+	u8 Index;
+	XDp_TxTopology *Topology = &InstancePtr->TxInstance.Topology;
+	XDp_TxTopologyNode *Node;
+
+	for (Index = StartIndex; (Index < Topology->NodeTotal) &&
+		(InstancePtr->TxInstance.SbMsgPending <
+				XDP_TX_SBMSG_MAX_PENDING); Index++) {
+		Node = &Topology->NodeTable[Index];
+		if (Node->DeviceType == 0x02) {
+			XDp_TxSbMsgSubmitLinkAddress(InstancePtr,
+				Node->LinkCountTotal, Node->RelativeAddress);
+		}
+	}
+}
+
 /******************************************************************************/
 /**
  * This function will fill in a device information structure from data obtained
@@ -3392,7 +3654,7 @@ static void XDp_TxGetDeviceInfoFromSbMsgLinkAddress(XDp_SidebandReply
 
 			memset(PortDetails->Guid, 0, XDP_GUID_NBYTES);
 			for (Index2 = 0; Index2 < XDP_GUID_NBYTES; Index2++) {
-				PortDetails->Guid[Index] =
+				PortDetails->Guid[Index2] =
 						SbReply->Data[ReplyIndex++];
 			}
 
@@ -3501,9 +3763,11 @@ static u32 XDp_SendSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg)
 	XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
 
 #if XPAR_XDPTXSS_NUM_INSTANCES
-	if (XDp_GetCoreType(InstancePtr) == XDP_TX) {
+	if ((XDp_GetCoreType(InstancePtr) == XDP_TX) &&
+				(InstancePtr->TxInstance.SbMsgPending == 0)) {
 		/* First, clear the DOWN_REP_MSG_RDY in case the RX device is in
-		 * a weird state. */
+		 * a weird state. A reply to an outstanding pipelined request
+		 * must not be discarded. */
 		Data[0] = 0x10;
 		Status = XDp_TxAuxWrite(InstancePtr,
 				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0, 1,
@@ -3605,6 +3869,11 @@ static void XDp_RxReadDownReq(XDp *InstancePtr, XDp_SidebandMsg *Msg)
  * This function will wait for a sideband message reply and fill in the SbReply
  * structure with the reply data for use by higher-level functions.
  *
+ * The reply is the first one with sequence number 0, the sequence number of
+ * all requests that are sent and waited for one at a time. Fragments for an
+ * outstanding pipelined request are stored in its slot, and late fragments
+ * for a pipelined request that was abandoned are discarded.
+ *
  * @param	InstancePtr is a pointer to the XDp instance.
  * @param	SbReply is a pointer to the reply structure that this function
  *		will fill in for use by higher-level functions.
@@ -3626,7 +3895,7 @@ static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply)
 {
 	u32 Status;
 	u8 Index = 0;
-	u8 AuxData[80];
+	u8 Done = 0;
 	XDp_SidebandMsg Msg;
 
 	Msg.FragmentNum = 0;
@@ -3635,27 +3904,22 @@ static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply)
 	do {
 		XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
 
-		/* Wait for a reply. */
-		Status = XDp_TxWaitSbReply(InstancePtr);
+		/* Wait for and receive a reply fragment. */
+		Status = XDp_TxReadSbMsgFragment(InstancePtr, &Msg);
 		if (Status != XST_SUCCESS) {
 			return Status;
 		}
 
-		/* Receive reply. */
-		Status = XDp_TxAuxRead(InstancePtr, XDP_DPCD_DOWN_REP, 80,
-								AuxData);
-		if (Status != XST_SUCCESS) {
-			/* The AUX read transaction failed. */
-			return Status;
+		/* The fragment belongs to an outstanding pipelined request;
+		 * keep waiting for this reply. */
+		if (XDp_TxSbMsgRoute(InstancePtr, &Msg)) {
+			continue;
 		}
 
-		/* Convert the reply transaction into XDp_SidebandReply
-		 * format. */
-		Status = XDp_Transaction2MsgFormat(AuxData, &Msg);
-		if (Status != XST_SUCCESS) {
-			/* The CRC of the header or the body did not match the
-			 * calculated value. */
-			return XST_FAILURE;
+		/* The fragment answers an abandoned pipelined request; it is
+		 * not part of this reply. */
+		if (Msg.Header.MsgSequenceNum != 0) {
+			continue;
 		}
 
 		/* Collect body data into an array. */
@@ -3663,18 +3927,9 @@ static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply)
 			SbReply->Data[SbReply->Length++] =
 							Msg.Body.MsgData[Index];
 		}
-
-		/* Clear. */
-		AuxData[0] = 0x10;
-		Status = XDp_TxAuxWrite(InstancePtr,
-				XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0,
-				1, AuxData);
-		if (Status != XST_SUCCESS) {
-			/* The AUX write transaction failed. */
-			return Status;
-		}
+		Done = Msg.Header.EndOfMsgTransaction;
 	}
-	while (Msg.Header.EndOfMsgTransaction == 0);
+	while (Done == 0);
 
 	/* Check if the reply indicates a NACK. */
 	if ((SbReply->Data[0] & 0x80) == 0x80) {
@@ -3684,6 +3939,62 @@ static u32 XDp_TxReceiveSbMsg(XDp *InstancePtr, XDp_SidebandReply *SbReply)
 	return XST_SUCCESS;
 }
 
+/******************************************************************************/
+/**
+ * This function will wait for a sideband message reply fragment to be ready,
+ * read it into the message structure and clear the reply ready indication.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Msg is a pointer to the message structure to be filled with the
+ *		fragment.
+ *
+ * @return
+ *		- XST_SUCCESS if a fragment was received.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_ERROR_COUNT_MAX if either waiting for a reply, or an AUX
+ *		  request timed out.
+ *		- XST_FAILURE otherwise - if an AUX read or write transaction
+ *		  failed, or the header or body CRC did not match the
+ *		  calculated value.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxReadSbMsgFragment(XDp *InstancePtr, XDp_SidebandMsg *Msg)
+{
+	u32 Status;
+	u8 AuxData[80];
+
+	/* Wait for a reply. */
+	Status = XDp_TxWaitSbReply(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		return Status;
+	}
+
+	/* Receive reply. */
+	Status = XDp_TxAuxRead(InstancePtr, XDP_DPCD_DOWN_REP, 80, AuxData);
+	if (Status != XST_SUCCESS) {
+		/* The AUX read transaction failed. */
+		return Status;
+	}
+
+	/* Convert the reply transaction into XDp_SidebandMsg format. */
+	Status = XDp_Transaction2MsgFormat(AuxData, Msg);
+	if (Status != XST_SUCCESS) {
+		/* The CRC of the header or the body did not match the
+		 * calculated value. */
+		return XST_FAILURE;
+	}
+
+	/* Clear. */
+	AuxData[0] = 0x10;
+	Status = XDp_TxAuxWrite(InstancePtr,
+			XDP_DPCD_SINK_DEVICE_SERVICE_IRQ_VECTOR_ESI0, 1,
+			AuxData);
+
+	return Status;
+}
+
 /******************************************************************************/
 /**
  * This function will wait until the RX device directly downstream to the
@@ -3730,6 +4041,313 @@ static u32 XDp_TxWaitSbReply(XDp *InstancePtr)
 
 	return XST_SUCCESS;
 }
+
+/******************************************************************************/
+/**
+ * This function will return the slot of the outstanding pipelined request
+ * with the given header fields.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the link count total of the request header.
+ * @param	RelativeAddress is the relative address of the request header.
+ * @param	SeqNum is the sequence number of the request header.
+ *
+ * @return	A pointer to the slot, or NULL if there is none.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XDp_TxSbMsgSlot *XDp_TxSbMsgFindSlot(XDp *InstancePtr,
+			u8 LinkCountTotal, u8 *RelativeAddress, u8 SeqNum)
+{
+	u8 Index;
+	XDp_TxSbMsgSlot *Slot;
+
+	if (InstancePtr->TxInstance.SbMsgPending == 0) {
+		return NULL;
+	}
+
+	for (Index = 0; Index < XDP_TX_SBMSG_MAX_PENDING; Index++) {
+		Slot = &InstancePtr->TxInstance.SbMsgSlot[Index];
+		if (Slot->InUse && (Slot->SeqNum == SeqNum) &&
+				(Slot->LinkCountTotal == LinkCountTotal) &&
+				((LinkCountTotal < 2) ||
+				(memcmp(Slot->RelativeAddress, RelativeAddress,
+					LinkCountTotal - 1) == 0))) {
+			return Slot;
+		}
+	}
+
+	return NULL;
+}
+
+/******************************************************************************/
+/**
+ * This function will send a LINK_ADDRESS sideband message to a target
+ * DisplayPort branch device without waiting for its reply. The reply is
+ * collected into a sideband message slot as it arrives.
+ *
+ * Pipelined requests use sequence number 1 and at most one is outstanding per
+ * branch device; requests sent and waited for one at a time use sequence
+ * number 0, so their replies can always be told apart.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the number of DisplayPort links from the
+ *		DisplayPort source to the target DisplayPort branch device.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the target DisplayPort branch device.
+ *
+ * @return	A pointer to the slot of the request, or NULL if all slots are
+ *		in use, a request to the branch is already outstanding or
+ *		sending the request failed.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static XDp_TxSbMsgSlot *XDp_TxSbMsgSubmitLinkAddress(XDp *InstancePtr,
+			u8 LinkCountTotal, u8 *RelativeAddress)
+{
+	u32 Status;
+	XDp_SidebandMsg Msg;
+	XDp_TxSbMsgSlot *Slot = NULL;
+	u8 Index;
+
+	if (XDp_TxSbMsgFindSlot(InstancePtr, LinkCountTotal, RelativeAddress,
+								1) != NULL) {
+		return NULL;
+	}
+	for (Index = 0; Index < XDP_TX_SBMSG_MAX_PENDING; Index++) {
+		if (!InstancePtr->TxInstance.SbMsgSlot[Index].InUse) {
+			Slot = &InstancePtr->TxInstance.SbMsgSlot[Index];
+			break;
+		}
+	}
+	if (Slot == NULL) {
+		return NULL;
+	}
+
+	Msg.FragmentNum = 0;
+
+	/* Prepare the sideband message header. */
+	Msg.Header.LinkCountTotal = LinkCountTotal;
+	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
+		Msg.Header.RelativeAddress[Index] = RelativeAddress[Index];
+	}
+	Msg.Header.LinkCountRemaining = Msg.Header.LinkCountTotal - 1;
+	Msg.Header.BroadcastMsg = 0;
+	Msg.Header.PathMsg = 0;
+	Msg.Header.MsgBodyLength = 2;
+	Msg.Header.StartOfMsgTransaction = 1;
+	Msg.Header.EndOfMsgTransaction = 1;
+	Msg.Header.MsgSequenceNum = 1;
+	Msg.Header.Crc = XDp_Crc4CalculateHeader(&Msg.Header);
+
+	/* Prepare the sideband message body. */
+	Msg.Body.MsgData[0] = XDP_SBMSG_LINK_ADDRESS;
+	Msg.Body.MsgDataLength = Msg.Header.MsgBodyLength - 1;
+	Msg.Body.Crc = XDp_Crc8CalculateBody(&Msg);
+
+	/* Submit the LINK_ADDRESS transaction message request. */
+	Status = XDp_SendSbMsgFragment(InstancePtr, &Msg);
+	if (Status != XST_SUCCESS) {
+		return NULL;
+	}
+
+	memset(Slot, 0, sizeof(XDp_TxSbMsgSlot));
+	Slot->LinkCountTotal = LinkCountTotal;
+	for (Index = 0; Index < (LinkCountTotal - 1); Index++) {
+		Slot->RelativeAddress[Index] = RelativeAddress[Index];
+	}
+	Slot->SeqNum = 1;
+	Slot->InUse = 1;
+	InstancePtr->TxInstance.SbMsgPending++;
+
+	return Slot;
+}
+
+/******************************************************************************/
+/**
+ * This function will obtain the reply to a LINK_ADDRESS sideband message sent
+ * to a target DisplayPort branch device. If a pipelined request to the branch
+ * is outstanding, its reply is waited for; otherwise the request is sent and
+ * waited for using XDp_TxSendSbMsgLinkAddress.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	LinkCountTotal is the number of DisplayPort links from the
+ *		DisplayPort source to the target DisplayPort branch device.
+ * @param	RelativeAddress is the relative address from the DisplayPort
+ *		source to the target DisplayPort branch device.
+ * @param	DeviceInfo is a pointer to the device information structure
+ *		whose contents will be filled in with the information obtained
+ *		by the LINK_ADDRESS sideband message.
+ *
+ * @return
+ *		- XST_SUCCESS if the reply to the sideband message was
+ *		  successfully obtained and it indicates an acknowledge.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_ERROR_COUNT_MAX if either waiting for a reply, or an AUX
+ *		  request timed out.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxFetchLinkAddress(XDp *InstancePtr, u8 LinkCountTotal,
+			u8 *RelativeAddress,
+			XDp_SbMsgLinkAddressReplyDeviceInfo *DeviceInfo)
+{
+	u32 Status;
+	XDp_TxSbMsgSlot *Slot;
+	XDp_SidebandReply SbMsgReply;
+
+	Slot = XDp_TxSbMsgFindSlot(InstancePtr, LinkCountTotal,
+						RelativeAddress, 1);
+	if (Slot == NULL) {
+		return XDp_TxSendSbMsgLinkAddress(InstancePtr, LinkCountTotal,
+						RelativeAddress, DeviceInfo);
+	}
+
+	Status = XDp_TxSbMsgWaitSlot(InstancePtr, Slot);
+	if (Status == XST_SUCCESS) {
+		SbMsgReply.Length = Slot->Length;
+		memcpy(SbMsgReply.Data, Slot->Data, Slot->Length);
+		XDp_TxGetDeviceInfoFromSbMsgLinkAddress(&SbMsgReply,
+								DeviceInfo);
+	}
+	XDp_TxSbMsgReleaseSlot(InstancePtr, Slot);
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+ * This function will store a received reply fragment in the slot of the
+ * outstanding pipelined request it answers, if any.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Msg is a pointer to the received fragment.
+ *
+ * @return	1 if the fragment was stored in a slot, 0 otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XDp_TxSbMsgRoute(XDp *InstancePtr, XDp_SidebandMsg *Msg)
+{
+	u8 Index;
+	XDp_TxSbMsgSlot *Slot;
+
+	Slot = XDp_TxSbMsgFindSlot(InstancePtr, Msg->Header.LinkCountTotal,
+		Msg->Header.RelativeAddress, Msg->Header.MsgSequenceNum);
+	if ((Slot == NULL) || Slot->Done) {
+		return 0;
+	}
+
+	if (Msg->Header.StartOfMsgTransaction) {
+		Slot->Length = 0;
+	}
+	for (Index = 0; (Index < Msg->Body.MsgDataLength) &&
+			(Slot->Length < sizeof(Slot->Data)); Index++) {
+		Slot->Data[Slot->Length++] = Msg->Body.MsgData[Index];
+	}
+
+	if (Msg->Header.EndOfMsgTransaction) {
+		/* Check if the reply indicates a NACK. */
+		Slot->Status = ((Slot->Length == 0) ||
+				((Slot->Data[0] & 0x80) == 0x80)) ?
+				XST_FAILURE : XST_SUCCESS;
+		Slot->Done = 1;
+	}
+
+	return 1;
+}
+
+/******************************************************************************/
+/**
+ * This function will receive reply fragments until the reply of the given
+ * pipelined request is complete. Fragments of other outstanding requests are
+ * stored in their slots and fragments that match no request are discarded.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Slot is a pointer to the slot of the request.
+ *
+ * @return
+ *		- XST_SUCCESS if the reply indicates an acknowledge.
+ *		- XST_DEVICE_NOT_FOUND if no RX device is connected.
+ *		- XST_ERROR_COUNT_MAX if either waiting for a reply, or an AUX
+ *		  request timed out.
+ *		- XST_FAILURE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u32 XDp_TxSbMsgWaitSlot(XDp *InstancePtr, XDp_TxSbMsgSlot *Slot)
+{
+	u32 Status;
+	XDp_SidebandMsg Msg;
+
+	Msg.FragmentNum = 0;
+
+	while (!Slot->Done) {
+		XDp_WaitUs(InstancePtr, InstancePtr->TxInstance.SbMsgDelayUs);
+
+		Status = XDp_TxReadSbMsgFragment(InstancePtr, &Msg);
+		if (Status != XST_SUCCESS) {
+			return Status;
+		}
+
+		XDp_TxSbMsgRoute(InstancePtr, &Msg);
+	}
+
+	return Slot->Status;
+}
+
+/******************************************************************************/
+/**
+ * This function will release the slot of a pipelined request.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ * @param	Slot is a pointer to the slot to release.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XDp_TxSbMsgReleaseSlot(XDp *InstancePtr, XDp_TxSbMsgSlot *Slot)
+{
+	if (Slot->InUse) {
+		Slot->InUse = 0;
+		InstancePtr->TxInstance.SbMsgPending--;
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function will wait for the replies of all outstanding pipelined
+ * requests and release their slots. A request whose reply cannot be received
+ * is abandoned.
+ *
+ * @param	InstancePtr is a pointer to the XDp instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void XDp_TxSbMsgDrain(XDp *InstancePtr)
+{
+	u8 Index;
+	XDp_TxSbMsgSlot *Slot;
+
+	for (Index = 0; Index < XDP_TX_SBMSG_MAX_PENDING; Index++) {
+		Slot = &InstancePtr->TxInstance.SbMsgSlot[Index];
+		if (Slot->InUse) {
+			XDp_TxSbMsgWaitSlot(InstancePtr, Slot);
+			XDp_TxSbMsgReleaseSlot(InstancePtr, Slot);
+		}
+	}
+}
 #endif /* XPAR_XDPTXSS_NUM_INSTANCES */
 
 /******************************************************************************/
@@ -26,6 +26,8 @@
 * 5.0  tu  08/03/17 Enabled video packing for bpc > 10
 * 5.0  aad 09/08/17 Case to handle HTotal > 4095, PPC = 1 in AXIStream Mode.
 * 6.4  rg  09/26/20 Added support for YUV420 color format.
+*          10/19/26 Dp_GetTopology keeps the topology of the previous
+*                   discovery when it is still connected.
 *
 * </pre>
 *
@@ -957,7 +959,8 @@ static u32 Dp_CheckBandwidth(XDp *InstancePtr, u8 Bpc, XVidC_VideoMode VidMode)
 /*****************************************************************************/
 /**
 *
-* This function discovers the topology and finds the actual number of sinks.
+* This function discovers the topology and finds the actual number of sinks,
+* keeping the topology of the previous discovery if it is still connected.
 * It enables streams corresponding to each sink found during topology
 * discovery.
 *
@@ -975,12 +978,9 @@ static u32 Dp_GetTopology(XDp *InstancePtr)
 	u32 Status;
 	u8 NumStreams;
 
-	/* Clear node and sink */
-	InstancePtr->TxInstance.Topology.NodeTotal = 0;
-	InstancePtr->TxInstance.Topology.SinkTotal = 0;
-
-	/* Discover topology and find total sinks */
-	Status = XDp_TxDiscoverTopology(InstancePtr);
+	/* Reuse the topology of the previous discovery if it is unchanged,
+	 * otherwise discover it again and find total sinks */
+	Status = XDp_TxRefreshTopology(InstancePtr);
 	if (Status != XST_SUCCESS) {
 		xdbg_printf(XDBG_DEBUG_GENERAL,"SS ERR:MST:Topology failed:"
 			"%ld.\n\r", Status);
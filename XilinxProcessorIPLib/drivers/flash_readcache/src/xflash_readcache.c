@@ -0,0 +1,752 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xflash_readcache.c
+* @addtogroup Overview
+* @{
+*
+* This file implements the flash read cache shared by the QSPIPSU and OSPIPSV
+* read cache layers. See xflash_readcache.h for a description of the read
+* cache.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.0       10/19/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include <string.h>
+#include "xflash_readcache.h"
+#include "xil_mem.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 XFlashRc_Start(XFlashRc *CachePtr, u32 Address, u8 *BfrPtr,
+			  u32 ByteCount);
+static void XFlashRc_Wait(const XFlashRc *CachePtr);
+static void XFlashRc_FinishPending(XFlashRc *CachePtr);
+static u32 XFlashRc_Transfer(XFlashRc *CachePtr, u32 Address,
+			     u8 *BfrPtr, u32 ByteCount);
+static u32 XFlashRc_Lookup(const XFlashRc *CachePtr, u32 LineAddr);
+static u32 XFlashRc_Victim(const XFlashRc *CachePtr);
+static u32 XFlashRc_Fill(XFlashRc *CachePtr, u32 LineAddr,
+			 u32 *IndexPtr);
+static void XFlashRc_ReadAhead(XFlashRc *CachePtr);
+static u32 XFlashRc_StreamKick(XFlashRc *CachePtr);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ *
+ * Initializes a read cache. The flash must already be selected and set up
+ * for the read command issued by the transport.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	XportPtr is a pointer to the transport of the driver layer.
+ * @param	FlashSize is the linear flash size in bytes, a multiple of 4.
+ * @param	LineSize is the line size and read-ahead window in bytes, a
+ *		power of 2 and a multiple of XFLASHRC_LINE_ALIGN.
+ * @param	LineMem is DMA capable memory for the lines, aligned to
+ *		XFLASHRC_LINE_ALIGN bytes.
+ * @param	LineMemSize is the size of LineMem in bytes. Up to
+ *		XFLASHRC_MAX_LINES lines of LineSize bytes are used.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if the geometry is not supported.
+ *
+ * @note	Read-ahead is enabled and reads of at least one line bypass the
+ *		lines by default, see XFlashRc_SetReadAhead().
+ *
+ ******************************************************************************/
+u32 XFlashRc_Init(XFlashRc *CachePtr, const XFlashRc_Transport *XportPtr,
+		  u32 FlashSize, u32 LineSize, u8 *LineMem, u32 LineMemSize)
+{
+	u32 Index;
+	u32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(XportPtr != NULL);
+	Xil_AssertNonvoid(XportPtr->Start != NULL);
+	Xil_AssertNonvoid(XportPtr->IsDone != NULL);
+	Xil_AssertNonvoid(LineMem != NULL);
+	Xil_AssertNonvoid(((UINTPTR)LineMem &
+			   (XFLASHRC_LINE_ALIGN - 1U)) == 0U);
+
+	if ((LineSize < XFLASHRC_LINE_ALIGN) ||
+	    ((LineSize & (LineSize - 1U)) != 0U) ||
+	    (LineMemSize < LineSize) ||
+	    (FlashSize == 0U) ||
+	    ((FlashSize & 3U) != 0U) ||
+	    (XportPtr->DmaBytesMax < LineSize)) {
+		Status = (u32)XST_INVALID_PARAM;
+		goto END;
+	}
+
+	(void)memset(CachePtr, 0, sizeof(XFlashRc));
+	CachePtr->Xport = *XportPtr;
+	CachePtr->FlashSize = FlashSize;
+	CachePtr->LineSize = LineSize;
+	CachePtr->NumLines = LineMemSize / LineSize;
+	if (CachePtr->NumLines > XFLASHRC_MAX_LINES) {
+		CachePtr->NumLines = XFLASHRC_MAX_LINES;
+	}
+	for (Index = 0U; Index < CachePtr->NumLines; Index++) {
+		CachePtr->Line[Index].Buf = &LineMem[Index * LineSize];
+		CachePtr->Line[Index].Addr = XFLASHRC_NONE;
+	}
+	CachePtr->DirectMin = LineSize;
+	CachePtr->ReadAhead = (u32)TRUE;
+	CachePtr->PendLine = XFLASHRC_NONE;
+	CachePtr->NextAddr = XFLASHRC_NONE;
+
+	Status = (u32)XST_SUCCESS;
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Configures read-ahead and the size from which reads bypass the lines.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	Enable is TRUE to fetch the line following a sequential read
+ *		in the background, FALSE otherwise.
+ * @param	DirectMin is the minimum read size which is read straight into
+ *		the caller's buffer, 0 to always read through the lines.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+void XFlashRc_SetReadAhead(XFlashRc *CachePtr, u32 Enable, u32 DirectMin)
+{
+	Xil_AssertVoid(CachePtr != NULL);
+
+	CachePtr->ReadAhead = Enable;
+	CachePtr->DirectMin = (DirectMin == 0U) ? XFLASHRC_NONE :
+			      DirectMin;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Reads from flash through the read cache. Lines already cached are copied,
+ * runs of lines not cached are either filled one line per read command or,
+ * for large aligned reads, read into ReadBfrPtr with one transfer.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	Address is the linear flash address to read from.
+ * @param	ReadBfrPtr is the buffer to fill in.
+ * @param	ByteCount is the number of bytes to read.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a stream is in progress.
+ *		- XST_FAILURE if a transfer could not be started.
+ *
+ * @note	The function may return with a read-ahead transfer in progress.
+ *		Lines already cached are served while it completes.
+ *
+ ******************************************************************************/
+u32 XFlashRc_Read(XFlashRc *CachePtr, u32 Address, u8 *ReadBfrPtr,
+		  u32 ByteCount)
+{
+	u32 Mask;
+	u32 CurAddr = Address;
+	u32 Left = ByteCount;
+	u8 *BfrPtr = ReadBfrPtr;
+	u32 LineAddr;
+	u32 Index;
+	u32 RunEnd;
+	u32 Len;
+	u32 Offset;
+	u32 Sequential;
+	u32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(ReadBfrPtr != NULL);
+	Xil_AssertNonvoid(ByteCount > 0U);
+	Xil_AssertNonvoid(Address < CachePtr->FlashSize);
+	Xil_AssertNonvoid(ByteCount <= (CachePtr->FlashSize - Address));
+
+	if (CachePtr->StreamActive != 0U) {
+		Status = (u32)XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Sequential = (Address == CachePtr->NextAddr) ? (u32)TRUE : (u32)FALSE;
+	Mask = CachePtr->LineSize - 1U;
+
+	while (Left > 0U) {
+		LineAddr = CurAddr & ~Mask;
+		Index = XFlashRc_Lookup(CachePtr, LineAddr);
+		if ((Index == CachePtr->PendLine) ||
+		    (Index == XFLASHRC_NONE)) {
+			/* The line or the controller is still in use */
+			XFlashRc_FinishPending(CachePtr);
+		}
+
+		if ((Index == XFLASHRC_NONE) &&
+		    (Left >= CachePtr->DirectMin) &&
+		    (((CurAddr | (u32)(UINTPTR)BfrPtr) & 3U) == 0U)) {
+			/* Coalesce the lines which are not cached */
+			RunEnd = LineAddr + CachePtr->LineSize;
+			while (((RunEnd - CurAddr) < Left) &&
+			       ((RunEnd - CurAddr) <
+				CachePtr->Xport.DmaBytesMax) &&
+			       (XFlashRc_Lookup(CachePtr, RunEnd) ==
+				XFLASHRC_NONE)) {
+				RunEnd += CachePtr->LineSize;
+			}
+			Len = RunEnd - CurAddr;
+			if (Len > Left) {
+				Len = Left;
+			}
+			if (Len > CachePtr->Xport.DmaBytesMax) {
+				Len = CachePtr->Xport.DmaBytesMax;
+			}
+			Len &= ~3U;
+			if (Len >= CachePtr->DirectMin) {
+				Status = XFlashRc_Transfer(CachePtr, CurAddr,
+							   BfrPtr, Len);
+				if (Status != (u32)XST_SUCCESS) {
+					goto END;
+				}
+				CurAddr += Len;
+				BfrPtr += Len;
+				Left -= Len;
+				continue;
+			}
+		}
+
+		if (Index == XFLASHRC_NONE) {
+			Status = XFlashRc_Fill(CachePtr, LineAddr, &Index);
+			if (Status != (u32)XST_SUCCESS) {
+				goto END;
+			}
+		} else {
+			CachePtr->Hits++;
+			if (CachePtr->Line[Index].Ahead != 0U) {
+				CachePtr->Line[Index].Ahead = 0U;
+				CachePtr->ReadAheadHits++;
+			}
+		}
+
+		Offset = CurAddr - LineAddr;
+		Len = CachePtr->LineSize - Offset;
+		if (Len > Left) {
+			Len = Left;
+		}
+		Xil_MemCpy(BfrPtr, &CachePtr->Line[Index].Buf[Offset], Len);
+		CachePtr->Clock++;
+		CachePtr->Line[Index].Stamp = CachePtr->Clock;
+		CurAddr += Len;
+		BfrPtr += Len;
+		Left -= Len;
+	}
+
+	CachePtr->NextAddr = Address + ByteCount;
+	if ((CachePtr->ReadAhead != 0U) && (Sequential != 0U)) {
+		XFlashRc_ReadAhead(CachePtr);
+	}
+
+	Status = (u32)XST_SUCCESS;
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Waits for a read-ahead transfer in progress. Call this before using the
+ * controller directly.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ *
+ * @return
+ *		- XST_SUCCESS if the controller is idle.
+ *		- XST_DEVICE_BUSY if a stream is in progress.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+u32 XFlashRc_Sync(XFlashRc *CachePtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+
+	if (CachePtr->StreamActive != 0U) {
+		Status = (u32)XST_DEVICE_BUSY;
+	} else {
+		XFlashRc_FinishPending(CachePtr);
+		Status = (u32)XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Drops the lines overlapping a flash region. Call this after the region
+ * was programmed or erased.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	Address is the linear flash address of the region.
+ * @param	ByteCount is the size of the region in bytes.
+ *
+ * @return	XST_SUCCESS always.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+u32 XFlashRc_Invalidate(XFlashRc *CachePtr, u32 Address, u32 ByteCount)
+{
+	u32 Index;
+	u32 LineAddr;
+	u32 Start;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+
+	XFlashRc_FinishPending(CachePtr);
+
+	Start = Address & ~(CachePtr->LineSize - 1U);
+	for (Index = 0U; Index < CachePtr->NumLines; Index++) {
+		LineAddr = CachePtr->Line[Index].Addr;
+		if ((LineAddr == XFLASHRC_NONE) || (LineAddr < Start)) {
+			continue;
+		}
+		if ((LineAddr == Start) || ((LineAddr - Address) < ByteCount)) {
+			CachePtr->Line[Index].Addr = XFLASHRC_NONE;
+			CachePtr->Line[Index].Ahead = 0U;
+		}
+	}
+	CachePtr->NextAddr = XFLASHRC_NONE;
+
+	return (u32)XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Starts reading a flash region into two buffers in turn. The first chunk
+ * is started right away; use XFlashRc_StreamNext() to get each
+ * chunk and start the following one.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	Address is the word aligned linear flash address to read from.
+ * @param	ByteCount is the number of bytes to read.
+ * @param	Bfr0Ptr is the first word aligned buffer of ChunkSize bytes.
+ * @param	Bfr1Ptr is the second word aligned buffer of ChunkSize bytes.
+ * @param	ChunkSize is the size of each chunk, a multiple of 4.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_DEVICE_BUSY if a stream is already in progress.
+ *		- XST_FAILURE if the transfer could not be started.
+ *
+ * @note	The lines are not used or updated by the stream.
+ *
+ ******************************************************************************/
+u32 XFlashRc_StreamStart(XFlashRc *CachePtr, u32 Address, u32 ByteCount,
+			 u8 *Bfr0Ptr, u8 *Bfr1Ptr, u32 ChunkSize)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(Bfr0Ptr != NULL);
+	Xil_AssertNonvoid(Bfr1Ptr != NULL);
+	Xil_AssertNonvoid(ByteCount > 0U);
+	Xil_AssertNonvoid(Address < CachePtr->FlashSize);
+	Xil_AssertNonvoid(ByteCount <= (CachePtr->FlashSize - Address));
+	Xil_AssertNonvoid((Address & 3U) == 0U);
+	Xil_AssertNonvoid((ChunkSize > 0U) && ((ChunkSize & 3U) == 0U));
+	Xil_AssertNonvoid(ChunkSize <= CachePtr->Xport.DmaBytesMax);
+
+	if (CachePtr->StreamActive != 0U) {
+		Status = (u32)XST_DEVICE_BUSY;
+		goto END;
+	}
+	XFlashRc_FinishPending(CachePtr);
+
+	CachePtr->StreamBuf[0] = Bfr0Ptr;
+	CachePtr->StreamBuf[1] = Bfr1Ptr;
+	CachePtr->StreamChunk = ChunkSize;
+	CachePtr->StreamAddr = Address;
+	CachePtr->StreamLeft = ByteCount;
+	CachePtr->StreamIdx = 0U;
+
+	Status = XFlashRc_StreamKick(CachePtr);
+	if (Status == (u32)XST_SUCCESS) {
+		CachePtr->StreamActive = (u8)TRUE;
+	}
+	CachePtr->NextAddr = XFLASHRC_NONE;
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Waits for the chunk in progress, starts reading the next chunk into the
+ * other buffer and returns the completed chunk. The returned chunk stays
+ * valid until the following call.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	BfrPtr is filled with the buffer holding the chunk.
+ * @param	ByteCountPtr is filled with the number of bytes in the chunk.
+ *
+ * @return
+ *		- XST_SUCCESS if a chunk is returned.
+ *		- XST_NO_DATA if the stream is complete.
+ *		- XST_FAILURE if the next transfer could not be started.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+u32 XFlashRc_StreamNext(XFlashRc *CachePtr, u8 **BfrPtr,
+			u32 *ByteCountPtr)
+{
+	u32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(BfrPtr != NULL);
+	Xil_AssertNonvoid(ByteCountPtr != NULL);
+
+	if ((CachePtr->StreamActive == 0U) || (CachePtr->StreamPendLen == 0U)) {
+		CachePtr->StreamActive = (u8)FALSE;
+		Status = (u32)XST_NO_DATA;
+		goto END;
+	}
+
+	XFlashRc_Wait(CachePtr);
+	*BfrPtr = CachePtr->StreamBuf[CachePtr->StreamIdx];
+	*ByteCountPtr = CachePtr->StreamPendLen;
+	CachePtr->StreamPendLen = 0U;
+	CachePtr->StreamIdx ^= 1U;
+
+	Status = (u32)XST_SUCCESS;
+	if (CachePtr->StreamLeft > 0U) {
+		Status = XFlashRc_StreamKick(CachePtr);
+		if (Status != (u32)XST_SUCCESS) {
+			CachePtr->StreamActive = (u8)FALSE;
+		}
+	}
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Starts a read through the transport and counts it.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	Address is the linear flash address to read from.
+ * @param	BfrPtr is the word aligned buffer to fill in.
+ * @param	ByteCount is the number of bytes to read, a multiple of 4.
+ *
+ * @return	Status returned by the transport.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XFlashRc_Start(XFlashRc *CachePtr, u32 Address, u8 *BfrPtr,
+			  u32 ByteCount)
+{
+	CachePtr->Commands++;
+	CachePtr->FlashBytes += ByteCount;
+
+	return CachePtr->Xport.Start(CachePtr->Xport.CallBackRef, Address,
+				     BfrPtr, ByteCount);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Waits for the transfer in progress to complete.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static void XFlashRc_Wait(const XFlashRc *CachePtr)
+{
+	while (CachePtr->Xport.IsDone(CachePtr->Xport.CallBackRef) !=
+	       (u32)XST_SUCCESS) {
+		/* Wait for the DMA to complete */
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Waits for a read-ahead transfer in progress, if any.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static void XFlashRc_FinishPending(XFlashRc *CachePtr)
+{
+	if (CachePtr->PendLine != XFLASHRC_NONE) {
+		XFlashRc_Wait(CachePtr);
+		CachePtr->PendLine = XFLASHRC_NONE;
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Reads from flash and waits for completion, splitting the read into
+ * transfers of at most DmaBytesMax bytes.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	Address is the linear flash address to read from.
+ * @param	BfrPtr is the word aligned buffer to fill in.
+ * @param	ByteCount is the number of bytes to read, a multiple of 4.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if a transfer could not be started.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XFlashRc_Transfer(XFlashRc *CachePtr, u32 Address,
+			     u8 *BfrPtr, u32 ByteCount)
+{
+	u32 CurAddr = Address;
+	u8 *CurBfrPtr = BfrPtr;
+	u32 Left = ByteCount;
+	u32 Len;
+	u32 Status = (u32)XST_SUCCESS;
+
+	while (Left > 0U) {
+		Len = (Left > CachePtr->Xport.DmaBytesMax) ?
+		      CachePtr->Xport.DmaBytesMax : Left;
+		Status = XFlashRc_Start(CachePtr, CurAddr, CurBfrPtr, Len);
+		if (Status != (u32)XST_SUCCESS) {
+			Status = (u32)XST_FAILURE;
+			break;
+		}
+		XFlashRc_Wait(CachePtr);
+		CurAddr += Len;
+		CurBfrPtr += Len;
+		Left -= Len;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Looks up the line holding a flash address.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	LineAddr is the line aligned flash address.
+ *
+ * @return	Index of the line or XFLASHRC_NONE if not cached.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XFlashRc_Lookup(const XFlashRc *CachePtr, u32 LineAddr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < CachePtr->NumLines; Index++) {
+		if (CachePtr->Line[Index].Addr == LineAddr) {
+			break;
+		}
+	}
+
+	return (Index < CachePtr->NumLines) ? Index : XFLASHRC_NONE;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Selects the line to replace, an empty line if there is one, the least
+ * recently used line otherwise.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ *
+ * @return	Index of the line.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XFlashRc_Victim(const XFlashRc *CachePtr)
+{
+	u32 Index;
+	u32 Victim = 0U;
+
+	for (Index = 0U; Index < CachePtr->NumLines; Index++) {
+		if (CachePtr->Line[Index].Addr == XFLASHRC_NONE) {
+			Victim = Index;
+			break;
+		}
+		if ((CachePtr->Clock - CachePtr->Line[Index].Stamp) >
+		    (CachePtr->Clock - CachePtr->Line[Victim].Stamp)) {
+			Victim = Index;
+		}
+	}
+
+	return Victim;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Fills a line with one read command.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	LineAddr is the line aligned flash address.
+ * @param	IndexPtr is filled with the index of the line.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_FAILURE if the transfer could not be started.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XFlashRc_Fill(XFlashRc *CachePtr, u32 LineAddr,
+			 u32 *IndexPtr)
+{
+	u32 Index = XFlashRc_Victim(CachePtr);
+	u32 Len = CachePtr->FlashSize - LineAddr;
+	u32 Status;
+
+	if (Len > CachePtr->LineSize) {
+		Len = CachePtr->LineSize;
+	}
+
+	CachePtr->Line[Index].Addr = XFLASHRC_NONE;
+	CachePtr->Line[Index].Ahead = 0U;
+	Status = XFlashRc_Transfer(CachePtr, LineAddr,
+				   CachePtr->Line[Index].Buf, Len);
+	if (Status == (u32)XST_SUCCESS) {
+		CachePtr->Line[Index].Addr = LineAddr;
+		CachePtr->Misses++;
+		*IndexPtr = Index;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Starts filling the first line not cached after the previous read unless
+ * a read-ahead transfer is already in progress. The transfer completes in
+ * the background.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ *
+ * @return	None.
+ *
+ * @note	Read-ahead is best effort, a transfer which cannot be started
+ *		is ignored.
+ *
+ ******************************************************************************/
+static void XFlashRc_ReadAhead(XFlashRc *CachePtr)
+{
+	u32 LineAddr;
+	u32 Index;
+	u32 Len;
+
+	if (CachePtr->PendLine != XFLASHRC_NONE) {
+		return;
+	}
+
+	LineAddr = CachePtr->NextAddr & ~(CachePtr->LineSize - 1U);
+	if ((LineAddr < CachePtr->FlashSize) &&
+	    (XFlashRc_Lookup(CachePtr, LineAddr) != XFLASHRC_NONE)) {
+		LineAddr += CachePtr->LineSize;
+	}
+	if ((LineAddr >= CachePtr->FlashSize) ||
+	    (XFlashRc_Lookup(CachePtr, LineAddr) != XFLASHRC_NONE)) {
+		return;
+	}
+
+	Index = XFlashRc_Victim(CachePtr);
+	Len = CachePtr->FlashSize - LineAddr;
+	if (Len > CachePtr->LineSize) {
+		Len = CachePtr->LineSize;
+	}
+
+	CachePtr->Line[Index].Addr = XFLASHRC_NONE;
+	if (XFlashRc_Start(CachePtr, LineAddr, CachePtr->Line[Index].Buf,
+			   Len) == (u32)XST_SUCCESS) {
+		CachePtr->Line[Index].Addr = LineAddr;
+		CachePtr->Line[Index].Ahead = (u32)TRUE;
+		CachePtr->Clock++;
+		CachePtr->Line[Index].Stamp = CachePtr->Clock;
+		CachePtr->PendLine = Index;
+	}
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Starts reading the next stream chunk into the current stream buffer.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ *
+ * @return	Status returned by the transport.
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XFlashRc_StreamKick(XFlashRc *CachePtr)
+{
+	u32 Len;
+	u32 Status;
+
+	Len = (CachePtr->StreamLeft > CachePtr->StreamChunk) ?
+	      CachePtr->StreamChunk : CachePtr->StreamLeft;
+	/* DMA transfers are whole words, the flash size is a multiple of 4 */
+	Status = XFlashRc_Start(CachePtr, CachePtr->StreamAddr,
+				CachePtr->StreamBuf[CachePtr->StreamIdx],
+				(Len + 3U) & ~3U);
+	if (Status == (u32)XST_SUCCESS) {
+		CachePtr->StreamPendLen = Len;
+		CachePtr->StreamAddr += Len;
+		CachePtr->StreamLeft -= Len;
+	}
+
+	return Status;
+}
+/** @} */
@@ -0,0 +1,163 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ *
+ * @file xflash_readcache.h
+ * @addtogroup Overview
+ * @{
+ *
+ * This is the header file of the flash read cache shared by the QSPIPSU and
+ * OSPIPSV read cache layers. Boot loaders and file systems tend to issue many
+ * small reads, and each one pays for the command, address and dummy cycles on
+ * the bus. The read cache serves them from a small set of RAM lines instead.
+ *
+ * - The application passes a DMA capable buffer which is split into lines of
+ *   LineSize bytes. Each line holds one LineSize aligned window of flash and
+ *   lines are replaced least recently used first. A miss fills a whole line
+ *   with one read command, so LineSize is the read-ahead window.
+ * - Reads of at least DirectMin bytes whose flash address and buffer are
+ *   word aligned skip the line buffers. All adjacent lines that are not
+ *   cached are read straight into the caller's buffer with a single DMA
+ *   transfer of up to DmaBytesMax bytes.
+ * - When read-ahead is enabled and a read starts where the previous one
+ *   ended, the line following the read is fetched in the background. The
+ *   next call waits for that transfer before it uses the controller.
+ * - XFlashRc_StreamStart() and XFlashRc_StreamNext() read a large region
+ *   into two buffers in turn, so the application can process one chunk
+ *   while the DMA fills the other.
+ *
+ * The cache does not access the controller itself. The driver layer passes
+ * an XFlashRc_Transport with a function which builds and starts one read
+ * command with DMA, and a function which polls for its completion. See
+ * xqspipsu_readcache.h and xospipsv_readcache.h.
+ *
+ * The cache is not coherent with writes to the flash. Call XFlashRc_Sync()
+ * before using the controller directly and XFlashRc_Invalidate() after
+ * programming or erasing flash.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.0       10/19/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#ifndef XFLASH_READCACHE_H_		/**< prevent circular inclusions */
+#define XFLASH_READCACHE_H_		/**< by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xil_types.h"
+#include "xil_assert.h"
+#include "xstatus.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XFLASHRC_MAX_LINES	16U		/**< Maximum cache lines */
+#define XFLASHRC_LINE_ALIGN	64U		/**< Line size and buffer
+						  *  alignment */
+#define XFLASHRC_NONE		0xFFFFFFFFU	/**< No line / no address */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Starts one read of ByteCount bytes, a multiple of 4, from the linear flash
+ * Address into the word aligned BfrPtr with DMA, without waiting for it.
+ * Returns XST_SUCCESS if the transfer was started.
+ */
+typedef u32 (*XFlashRc_StartFunc)(void *CallBackRef, u32 Address,
+				  u8 *BfrPtr, u32 ByteCount);
+
+/**
+ * Returns XST_SUCCESS once the transfer started last has completed.
+ */
+typedef u32 (*XFlashRc_DoneFunc)(void *CallBackRef);
+
+/**
+ * Transport supplied by the driver layer.
+ */
+typedef struct {
+	XFlashRc_StartFunc Start;	/**< Starts a read */
+	XFlashRc_DoneFunc IsDone;	/**< Polls for completion */
+	void *CallBackRef;	/**< Passed to Start and IsDone */
+	u32 DmaBytesMax;	/**< Maximum bytes of one transfer, a
+				  *  multiple of XFLASHRC_LINE_ALIGN */
+} XFlashRc_Transport;
+
+/**
+ * One cache line.
+ */
+typedef struct {
+	u8 *Buf;		/**< Line buffer */
+	u32 Addr;		/**< Flash address of the line or
+				  *  XFLASHRC_NONE if empty */
+	u32 Stamp;		/**< Last use, for LRU replacement */
+	u32 Ahead;		/**< Filled by read-ahead and not used yet */
+} XFlashRc_Line;
+
+/**
+ * The read cache instance. The statistics counters may be read and cleared
+ * by the application at any time.
+ */
+typedef struct {
+	XFlashRc_Transport Xport;	/**< Transport of the driver layer */
+	u32 FlashSize;		/**< Linear flash size in bytes */
+	u32 LineSize;		/**< Line size and read-ahead window */
+	u32 NumLines;		/**< Number of lines in use */
+	u32 DirectMin;		/**< Reads of at least this size bypass the
+				  *  lines */
+	u32 ReadAhead;		/**< Read-ahead enabled */
+	XFlashRc_Line Line[XFLASHRC_MAX_LINES];	/**< Lines */
+	u32 Clock;		/**< LRU clock */
+	u32 PendLine;		/**< Line being filled in the background or
+				  *  XFLASHRC_NONE */
+	u32 NextAddr;		/**< Address following the previous read */
+
+	u8 *StreamBuf[2];	/**< Stream buffers */
+	u32 StreamChunk;	/**< Stream chunk size */
+	u32 StreamAddr;		/**< Next stream address to read */
+	u32 StreamLeft;		/**< Stream bytes not yet requested */
+	u32 StreamPendLen;	/**< Bytes of the chunk in flight */
+	u8 StreamIdx;		/**< Buffer of the chunk in flight */
+	u8 StreamActive;	/**< A stream is in progress */
+
+	u32 Hits;		/**< Reads served from a line */
+	u32 Misses;		/**< Line fills */
+	u32 ReadAheadHits;	/**< Hits on a line filled by read-ahead */
+	u32 Commands;		/**< Read commands issued to the flash */
+	u64 FlashBytes;		/**< Bytes read from the flash */
+} XFlashRc;
+
+/************************** Function Prototypes ******************************/
+
+u32 XFlashRc_Init(XFlashRc *CachePtr, const XFlashRc_Transport *XportPtr,
+		  u32 FlashSize, u32 LineSize, u8 *LineMem, u32 LineMemSize);
+void XFlashRc_SetReadAhead(XFlashRc *CachePtr, u32 Enable, u32 DirectMin);
+u32 XFlashRc_Read(XFlashRc *CachePtr, u32 Address, u8 *ReadBfrPtr,
+		  u32 ByteCount);
+u32 XFlashRc_Sync(XFlashRc *CachePtr);
+u32 XFlashRc_Invalidate(XFlashRc *CachePtr, u32 Address, u32 ByteCount);
+u32 XFlashRc_StreamStart(XFlashRc *CachePtr, u32 Address, u32 ByteCount,
+			 u8 *Bfr0Ptr, u8 *Bfr1Ptr, u32 ChunkSize);
+u32 XFlashRc_StreamNext(XFlashRc *CachePtr, u8 **BfrPtr,
+			u32 *ByteCountPtr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFLASH_READCACHE_H_ */
+/** @} */
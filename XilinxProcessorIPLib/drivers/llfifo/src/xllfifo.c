@@ -33,6 +33,10 @@
  *                     XLlFifo_Initialize APIs.
  * 5.5   sk   06/15/20 In XLlFifo_iRead_Aligned and XLlFifo_iWrite_Aligned add
  *		       type casting to fix gcc warnings.
+ * 5.5        10/19/26 Added XLlFifo_TxBurst, XLlFifo_RxBurst and
+ *		       XLlFifo_RxSetCoalesce. XLlFifo_iRead_Aligned and
+ *		       XLlFifo_iWrite_Aligned select the data register once
+ *		       per call instead of once per word.
  * </pre>
  ******************************************************************************/
 
@@ -46,6 +50,15 @@
 /************************** Constant Definitions *****************************/
 #define FIFO_WIDTH_BYTES 4
 
+/*
+ * Offsets of the data registers from Axi4BaseAddress for the data interface
+ * of the instance
+ */
+#define XLlFifo_RxDataOffset(InstancePtr) \
+	((InstancePtr)->Datainterface ? XLLF_AXI4_RDFD_OFFSET : XLLF_RDFD_OFFSET)
+#define XLlFifo_TxDataOffset(InstancePtr) \
+	((InstancePtr)->Datainterface ? XLLF_AXI4_TDFD_OFFSET : XLLF_TDFD_OFFSET)
+
 /*
  * Implementation Notes:
  *
@@ -158,6 +171,7 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 {
 	unsigned WordsRemaining = WordCount;
 	u32 *BufPtrIdx = (u32 *)BufPtr;
+	u32 DataOffset;
 
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: start\n");
 	Xil_AssertNonvoid(InstancePtr);
@@ -166,12 +180,14 @@ int XLlFifo_iRead_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	Xil_AssertNonvoid(((UINTPTR)BufPtr & 0x3) == 0x0);
 	xdbg_printf(XDBG_DEBUG_FIFO_RX, "XLlFifo_iRead_Aligned: after asserts\n");
 
+	DataOffset = XLlFifo_RxDataOffset(InstancePtr);
 	while (WordsRemaining) {
 /*		xdbg_printf(XDBG_DEBUG_FIFO_RX,
 			    "XLlFifo_iRead_Aligned: WordsRemaining: %d\n",
 			    WordsRemaining);
 */
-		*BufPtrIdx = XLlFifo_RxGetWord(InstancePtr);
+		*BufPtrIdx = XLlFifo_ReadReg(InstancePtr->Axi4BaseAddress,
+					     DataOffset);
 		BufPtrIdx++;
 		WordsRemaining--;
 	}
@@ -264,6 +280,7 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 {
 	unsigned WordsRemaining = WordCount;
 	u32 *BufPtrIdx = (u32 *)BufPtr;
+	u32 DataOffset;
 
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: Inst: %p; Buff: %p; Count: %d\n",
@@ -276,8 +293,10 @@ int XLlFifo_iWrite_Aligned(XLlFifo *InstancePtr, void *BufPtr,
 	xdbg_printf(XDBG_DEBUG_FIFO_TX,
 		    "XLlFifo_iWrite_Aligned: WordsRemaining: %d\n",
 		    WordsRemaining);
+	DataOffset = XLlFifo_TxDataOffset(InstancePtr);
 	while (WordsRemaining) {
-		XLlFifo_TxPutWord(InstancePtr, *BufPtrIdx);
+		XLlFifo_WriteReg(InstancePtr->Axi4BaseAddress, DataOffset,
+				 *BufPtrIdx);
 		BufPtrIdx++;
 		WordsRemaining--;
 	}
@@ -416,6 +435,261 @@ void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word)
 
 }
 
+/*****************************************************************************/
+/**
+*
+* XLlFifo_PutBytes writes <i>Bytes</i> bytes from <i>SrcPtr</i> to the data
+* register at <i>DataOffset</i>, four bytes per FIFO word. The last word is
+* padded with zero bytes.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    DataOffset is the offset of the transmit data register.
+* @param    SrcPtr specifies the data to write, any alignment.
+* @param    Bytes specifies the number of bytes to write.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_PutBytes(XLlFifo *InstancePtr, u32 DataOffset,
+			     const u8 *SrcPtr, u32 Bytes)
+{
+	u32 Word;
+
+	if (((UINTPTR)SrcPtr & 3) == 0) {
+		const u32 *WordPtr = (const u32 *)SrcPtr;
+
+		for (; Bytes >= FIFO_WIDTH_BYTES; Bytes -= FIFO_WIDTH_BYTES) {
+			XLlFifo_WriteReg(InstancePtr->Axi4BaseAddress,
+					 DataOffset, *WordPtr++);
+		}
+		SrcPtr = (const u8 *)WordPtr;
+	} else {
+		for (; Bytes >= FIFO_WIDTH_BYTES; Bytes -= FIFO_WIDTH_BYTES) {
+			memcpy(&Word, SrcPtr, FIFO_WIDTH_BYTES);
+			XLlFifo_WriteReg(InstancePtr->Axi4BaseAddress,
+					 DataOffset, Word);
+			SrcPtr += FIFO_WIDTH_BYTES;
+		}
+	}
+	if (Bytes != 0) {
+		Word = 0;
+		memcpy(&Word, SrcPtr, Bytes);
+		XLlFifo_WriteReg(InstancePtr->Axi4BaseAddress, DataOffset,
+				 Word);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_GetBytes reads <i>Words</i> FIFO words from the data register at
+* <i>DataOffset</i> and stores the first <i>Bytes</i> bytes at
+* <i>DestPtr</i>. The remaining words are read and dropped.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    DataOffset is the offset of the receive data register.
+* @param    DestPtr specifies the memory to place the data read, any
+*           alignment.
+* @param    Bytes specifies the number of bytes to store.
+* @param    Words specifies the number of FIFO words to read.
+*
+* @return   N/A
+*
+******************************************************************************/
+static void XLlFifo_GetBytes(XLlFifo *InstancePtr, u32 DataOffset,
+			     u8 *DestPtr, u32 Bytes, u32 Words)
+{
+	u32 Word;
+
+	if (((UINTPTR)DestPtr & 3) == 0) {
+		u32 *WordPtr = (u32 *)DestPtr;
+
+		for (; Bytes >= FIFO_WIDTH_BYTES; Bytes -= FIFO_WIDTH_BYTES) {
+			*WordPtr++ = XLlFifo_ReadReg(InstancePtr->Axi4BaseAddress,
+						     DataOffset);
+			Words--;
+		}
+		DestPtr = (u8 *)WordPtr;
+	} else {
+		for (; Bytes >= FIFO_WIDTH_BYTES; Bytes -= FIFO_WIDTH_BYTES) {
+			Word = XLlFifo_ReadReg(InstancePtr->Axi4BaseAddress,
+					       DataOffset);
+			memcpy(DestPtr, &Word, FIFO_WIDTH_BYTES);
+			DestPtr += FIFO_WIDTH_BYTES;
+			Words--;
+		}
+	}
+	if (Bytes != 0) {
+		Word = XLlFifo_ReadReg(InstancePtr->Axi4BaseAddress,
+				       DataOffset);
+		memcpy(DestPtr, &Word, Bytes);
+		Words--;
+	}
+	while (Words--) {
+		(void)XLlFifo_ReadReg(InstancePtr->Axi4BaseAddress,
+				      DataOffset);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_TxBurst writes up to <i>NumPkts</i> complete frames, described by
+* the array at <i>PktPtr</i>, to the transmit channel of the FIFO referenced
+* by <i>InstancePtr</i> and starts the transmission of each one.
+*
+* The vacancy register is read once, and read again only when the next frame
+* does not fit in the vacancy left. The call stops at the first frame that
+* does not fit, so frames are always sent in order.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    PktPtr references an array of NumPkts frame descriptors. The
+*           BufPtr and Len members of each are used.
+* @param    NumPkts is the number of frames to send.
+*
+* @return   XLlFifo_TxBurst returns the number of frames written, which is
+*           less than NumPkts when the FIFO is full.
+*
+* @note
+* A frame is never written partly, so a frame longer than the FIFO depth is
+* never sent. No frame may be in progress with XLlFifo_Write() when this
+* routine is called.
+*
+******************************************************************************/
+u32 XLlFifo_TxBurst(XLlFifo *InstancePtr, const XLlFifo_Pkt *PktPtr,
+			u32 NumPkts)
+{
+	u32 DataOffset;
+	u32 Vacancy;
+	u32 Words;
+	u32 Count;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(PktPtr);
+	Xil_AssertNonvoid(InstancePtr->TxStreamer.TailIndex == 0);
+
+	DataOffset = XLlFifo_TxDataOffset(InstancePtr);
+	Vacancy = XLlFifo_ReadReg(InstancePtr->BaseAddress, XLLF_TDFV_OFFSET);
+
+	for (Count = 0; Count < NumPkts; Count++, PktPtr++) {
+		Words = (PktPtr->Len + FIFO_WIDTH_BYTES - 1) / FIFO_WIDTH_BYTES;
+		if (Words > Vacancy) {
+			Vacancy = XLlFifo_ReadReg(InstancePtr->BaseAddress,
+						  XLLF_TDFV_OFFSET);
+			if (Words > Vacancy) {
+				break;
+			}
+		}
+		XLlFifo_PutBytes(InstancePtr, DataOffset,
+				 (const u8 *)PktPtr->BufPtr, PktPtr->Len);
+		XLlFifo_WriteReg(InstancePtr->BaseAddress, XLLF_TLF_OFFSET,
+				 PktPtr->Len);
+		Vacancy -= Words;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_RxBurst reads up to <i>NumPkts</i> complete frames from the receive
+* channel of the FIFO referenced by <i>InstancePtr</i> into the buffers
+* described by the array at <i>PktPtr</i>.
+*
+* The occupancy register is read once, and read again only when the frames
+* read have used up the occupancy read. For each frame the length register is
+* read and the data words are copied to the frame buffer. Bytes that do not
+* fit in BufSize are read from the FIFO and dropped, and Len is still set to
+* the length of the frame.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    PktPtr references an array of NumPkts frame descriptors. BufPtr
+*           and BufSize are used and Len is set for each frame read.
+* @param    NumPkts is the number of descriptors.
+*
+* @return   XLlFifo_RxBurst returns the number of frames read, which is less
+*           than NumPkts when the FIFO is empty.
+*
+* @note
+* No frame may be in progress with XLlFifo_Read() when this routine is called.
+*
+******************************************************************************/
+u32 XLlFifo_RxBurst(XLlFifo *InstancePtr, XLlFifo_Pkt *PktPtr, u32 NumPkts)
+{
+	u32 DataOffset;
+	u32 Occupancy;
+	u32 Words;
+	u32 Count;
+
+	Xil_AssertNonvoid(InstancePtr);
+	Xil_AssertNonvoid(PktPtr);
+	Xil_AssertNonvoid(InstancePtr->RxStreamer.FrmByteCnt == 0);
+
+	DataOffset = XLlFifo_RxDataOffset(InstancePtr);
+	Occupancy = 0;
+
+	for (Count = 0; Count < NumPkts; Count++, PktPtr++) {
+		if (Occupancy == 0) {
+			Occupancy = XLlFifo_ReadReg(InstancePtr->BaseAddress,
+						    XLLF_RDFO_OFFSET);
+			if (Occupancy == 0) {
+				break;
+			}
+		}
+		PktPtr->Len = XLlFifo_ReadReg(InstancePtr->BaseAddress,
+					      XLLF_RLF_OFFSET);
+		Words = (PktPtr->Len + FIFO_WIDTH_BYTES - 1) / FIFO_WIDTH_BYTES;
+		XLlFifo_GetBytes(InstancePtr, DataOffset, (u8 *)PktPtr->BufPtr,
+				 (PktPtr->Len < PktPtr->BufSize) ?
+				 PktPtr->Len : PktPtr->BufSize, Words);
+		Occupancy = (Words < Occupancy) ? (Occupancy - Words) : 0;
+	}
+
+	return Count;
+}
+
+/*****************************************************************************/
+/**
+*
+* XLlFifo_RxSetCoalesce selects the receive interrupt of the FIFO referenced
+* by <i>InstancePtr</i>.
+*
+* When enabled, the Receive Complete interrupt is disabled and the Receive
+* FIFO Programmable Full interrupt is enabled, so an interrupt is raised when
+* the receive occupancy reaches the threshold set in the core configuration
+* instead of for every frame. When disabled, the Receive Complete interrupt is
+* enabled again. Pending receive interrupts are cleared in both cases.
+*
+* @param    InstancePtr references the FIFO on which to operate.
+* @param    Enable is TRUE to interrupt on the threshold and FALSE to
+*           interrupt for each frame.
+*
+* @return   N/A
+*
+* @note
+* The interrupt is raised when the occupancy crosses the threshold, so the
+* handler should clear it and then call XLlFifo_RxBurst() until it returns
+* fewer frames than asked for. Frames that do not reach the threshold must be
+* picked up by calling XLlFifo_RxBurst() from a timer or the idle loop.
+*
+******************************************************************************/
+void XLlFifo_RxSetCoalesce(XLlFifo *InstancePtr, u32 Enable)
+{
+	u32 Reg;
+
+	Xil_AssertVoid(InstancePtr);
+
+	Reg = XLlFifo_ReadReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET);
+	if (Enable) {
+		Reg = (Reg & ~XLLF_INT_RC_MASK) | XLLF_INT_RFPF_MASK;
+	} else {
+		Reg = (Reg & ~XLLF_INT_RFPF_MASK) | XLLF_INT_RC_MASK;
+	}
+	XLlFifo_WriteReg(InstancePtr->BaseAddress, XLLF_IER_OFFSET, Reg);
+	XLlFifo_IntClear(InstancePtr, XLLF_INT_RC_MASK | XLLF_INT_RFPF_MASK);
+}
+
 /*****************************************************************************/
 /**
 *
@@ -97,11 +97,43 @@
  * twice in a row. Each frame must be written by writing the data for one
  * frame and then calling iTxSetLen().
  *
+ * <h3>Burst transfers</h3>
+ * XLlFifo_TxBurst() and XLlFifo_RxBurst() move several complete frames per
+ * call, each described by an XLlFifo_Pkt. The vacancy and occupancy registers
+ * are read once per call and only read again when the value read has been
+ * used up, and the data words are copied in a tight loop with a fast path for
+ * 32 bit aligned buffers. Small frames then cost little more than their data
+ * words and the length register access. A burst call must not be made while
+ * a frame is partly written with XLlFifo_Write() or partly read with
+ * XLlFifo_Read(). As for the examples above, the receive side assumes the
+ * core is built in store and forward mode, so that a non zero occupancy means
+ * a complete frame is available.
+ *
+ * For example:
+ * <pre>
+ *	for (i = 0; i < NUM_PKTS; i++) {
+ *		Pkt[i].BufPtr = RxBuffer[i];
+ *		Pkt[i].BufSize = sizeof(RxBuffer[i]);
+ *	}
+ *	Count = XLlFifo_RxBurst(InstancePtr, Pkt, NUM_PKTS);
+ *	for (i = 0; i < Count; i++) {
+ *		// Pkt[i].Len bytes received in RxBuffer[i]
+ *	}
+ * </pre>
+ *
  * <h2>Interrupts</h2>
  * This driver does not handle interrupts from the FIFO hardware. The
  * software layer above may make use of the interrupts by setting up its
  * own handlers for the interrupts.
  *
+ * XLlFifo_RxSetCoalesce() switches the receive interrupt from Receive
+ * Complete, raised for every frame, to Receive FIFO Programmable Full, raised
+ * when the receive occupancy reaches the threshold set in the core
+ * configuration. The handler then drains many frames with XLlFifo_RxBurst()
+ * for each interrupt. Frames below the threshold do not raise an interrupt,
+ * so the application must also call XLlFifo_RxBurst() from a timer or its
+ * idle loop to bound the receive latency.
+ *
  * <pre>
  * MODIFICATION HISTORY:
  *
@@ -162,6 +194,8 @@
  *		       Updated comments in the usage section as per example code.
  *		       Fix doxygen warnings in the driver.
  * 5.5 sd     09/04/20  Makefile update for parallel execution.
+ * 5.5        10/19/26  Added XLlFifo_TxBurst, XLlFifo_RxBurst and
+ *		       XLlFifo_RxSetCoalesce.
  * </pre>
  *
  *****************************************************************************/
@@ -208,6 +242,20 @@ typedef struct XLlFifo {
 	                                  */
 } XLlFifo;
 
+/**
+ * This typedef describes one frame for XLlFifo_TxBurst and XLlFifo_RxBurst.
+ */
+typedef struct XLlFifo_Pkt {
+	void *BufPtr;		/**< Frame data, any alignment */
+	u32 BufSize;		/**< Size of the receive buffer in bytes. Not
+				 *   used for transmit.
+				 */
+	u32 Len;		/**< Frame length in bytes. Set by
+				 *   XLlFifo_RxBurst. A length larger than
+				 *   BufSize means the frame was truncated.
+				 */
+} XLlFifo_Pkt;
+
 typedef struct XLlFifo_Config {
 	u32 DeviceId;		/**< Deviceid of the AXI FIFO */
 	UINTPTR BaseAddress;	/**< Base Address of the AXI FIFO */
@@ -701,6 +749,10 @@ u32 XLlFifo_iTxVacancy(XLlFifo *InstancePtr);
 void XLlFifo_iTxSetLen(XLlFifo *InstancePtr, u32 Bytes);
 u32 XLlFifo_RxGetWord(XLlFifo *InstancePtr);
 void XLlFifo_TxPutWord(XLlFifo *InstancePtr, u32 Word);
+u32 XLlFifo_TxBurst(XLlFifo *InstancePtr, const XLlFifo_Pkt *PktPtr,
+			u32 NumPkts);
+u32 XLlFifo_RxBurst(XLlFifo *InstancePtr, XLlFifo_Pkt *PktPtr, u32 NumPkts);
+void XLlFifo_RxSetCoalesce(XLlFifo *InstancePtr, u32 Enable);
 
 #ifdef __cplusplus
 }
@@ -21,6 +21,8 @@
 * 1.1    rsp    20/02/18 Fix unused variable warning.
 *                        Remove TimeOut variable.CR-979061
 * 1.3    rsp    14/02/19 Populate HasRxLength value from config.
+*               10/19/26 Added software channel weight used by
+*                        XMcdma_DrainServiced().
 *
 ******************************************************************************/
 
@@ -150,6 +152,7 @@ s32 XMcDma_Initialize(XMcdma *InstancePtr, XMcdma_Config *CfgPtr)
 			InstancePtr->Tx_Chan[i].MaxTransferLen =
 					MAX_TRANSFER_LEN(CfgPtr->MaxTransferlen - 1);
 			InstancePtr->Tx_Chan[i].IsRxChan = 0;
+			InstancePtr->Tx_Chan[i].DrainWeight = 1;
 			if (InstancePtr->Config.AddrWidth > 32)
 				InstancePtr->Tx_Chan[i].ext_addr = 1;
 		}
@@ -172,6 +175,7 @@ s32 XMcDma_Initialize(XMcdma *InstancePtr, XMcdma_Config *CfgPtr)
 				   MAX_TRANSFER_LEN(CfgPtr->MaxTransferlen - 1);
 
 			InstancePtr->Rx_Chan[i].IsRxChan = 1;
+			InstancePtr->Rx_Chan[i].DrainWeight = 1;
 			if (InstancePtr->Config.AddrWidth > 32)
 				InstancePtr->Rx_Chan[i].ext_addr = 1;
 		}
@@ -562,6 +566,38 @@ u32 XMCdma_SetChan_Weight(XMcdma_ChanCtrl *Chan, u8 Weight)
 	else
 		XMcdma_WriteReg(Chan->ChanBase, XMCDMA_TX_WRR_REG_OFFSET, Val);
 
+	/* Apply the same weight when draining completed BDs */
+	Chan->DrainWeight = Weight;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+*
+* Sets the software weight of a channel. XMcdma_DrainServiced() returns up to
+* Weight * XMCDMA_DRAIN_QUANTUM completed BDs of the channel per round.
+*
+* @param	Chan is the Channel instance to be worked on
+* @param	Weight is the weight, valid range is 1 to 15
+*
+* @return
+*		- XST_SUCCESS if the weight was set.
+*		- XST_FAILURE if Weight is out of range.
+*
+* @note		Unlike XMCdma_SetChan_Weight() this does not program the
+*		hardware scheduler and may be used for S2MM channels.
+*
+******************************************************************************/
+u32 XMcdma_SetChanDrainWeight(XMcdma_ChanCtrl *Chan, u8 Weight)
+{
+	if (Weight == 0 || Weight > XMCDMA_DRAIN_WEIGHT_MAX) {
+		xil_printf("Invalid Weight to Configure\n\r");
+		return XST_FAILURE;
+	}
+
+	Chan->DrainWeight = Weight;
+
 	return XST_SUCCESS;
 }
 
@@ -80,6 +80,24 @@
 *
 * </pre>
 *
+* <b>Multi Channel Submission and Completion</b>
+*
+* When many channels are active, transfers for several channels can be
+* queued at once with XMcDma_SubmitMulti(), which returns the mask of the
+* channels it touched. XMcDma_ToHwMulti() then flushes the new BDs of each
+* channel in the mask, updates their tail descriptors in a single pass and
+* enables all of them with one write to the channel enable register.
+*
+* On the completion side, XMcdma_DrainServiced() reads the serviced channel
+* register once, acknowledges the interrupts of the serviced channels and
+* retrieves their completed BDs round robin. Each channel gets up to
+* DrainWeight * XMCDMA_DRAIN_QUANTUM BDs per round, rounded up to the end of
+* a packet, so a busy channel cannot starve the others. The weight defaults
+* to 1 and is set with XMcdma_SetChanDrainWeight(), or with
+* XMCdma_SetChan_Weight() which also programs the MM2S hardware scheduler.
+* Channels left with completed BDs when the budget runs out are remembered
+* and drained first on the next call.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -121,6 +139,11 @@
 *                        to program BD control and sideband information.
 * 1.5	sk	07/13/20 Add XMcDma_BdGetAppWord() function declaration to fix
 * 			 the gcc warning in mcdma integration test suite.
+*               10/19/26 Added multi channel submission with
+*                        XMcDma_SubmitMulti() and XMcDma_ToHwMulti(), and
+*                        weighted draining of serviced channels with
+*                        XMcdma_DrainServiced().
+*               10/19/26 Added XMcdma_BdChainFromHWPkt().
 ******************************************************************************/
 #ifndef XMCDMA_H_
 #define XMCDMA_H_
@@ -148,6 +171,14 @@ extern "C" {
 #define XMCDMA_BD_MINIMUM_ALIGNMENT	0x40
 #define XMCDMA_AXCACHE			0xB
 
+/* Number of BDs a channel of weight 1 may return per round of
+ * XMcdma_DrainServiced()
+ */
+#ifndef XMCDMA_DRAIN_QUANTUM
+#define XMCDMA_DRAIN_QUANTUM		4
+#endif
+#define XMCDMA_DRAIN_WEIGHT_MAX		0xF
+
 /* Direction flags */
 #define XMCDMA_DEV_TO_MEM		0
 #define XMCDMA_MEM_TO_DEV		1
@@ -179,6 +210,14 @@ typedef void (*XMcdma_ChanDoneHandler) (void *CallBackRef);
 typedef void (*XMcdma_ChanErrorHandler) (void *CallBackRef, u32 ErrorMask);
 typedef void (*XMcdma_ChanPktDropHandler) (void *CallBackRef);
 
+/**
+ * Callback type for XMcdma_DrainServiced(). BdCount completed BDs of channel
+ * Chan_Id starting at BdSetPtr are handed over; they are freed with
+ * XMcdma_BdChainFree() once the callback returns.
+ */
+typedef void (*XMcdma_DrainHandler) (void *CallBackRef, u32 Chan_Id,
+				     XMcdma_Bd *BdSetPtr, int BdCount);
+
 typedef enum {
 	XMCDMA_FIXED_PRIORITY,
 	XMCDMA_WRR,
@@ -227,8 +266,19 @@ typedef struct {
 	                                     * interrupt callback */
 	XMcdma_ChanPktDropHandler PktdropHandler;
 	void *PktDropRef;
+	u8 DrainWeight;			/**< Software weight used by
+					  *  XMcdma_DrainServiced() */
 } XMcdma_ChanCtrl;
 
+/**
+ * Transfer description for XMcDma_SubmitMulti()
+ */
+typedef struct {
+	u32 Chan_id;		/**< Channel number, starting from 1 */
+	UINTPTR BufAddr;	/**< Buffer address */
+	u32 Len;		/**< Transfer length in bytes */
+} XMcdma_Xfer;
+
 typedef struct {
 	u32 DeviceId;
 	UINTPTR BaseAddress;
@@ -276,6 +326,12 @@ typedef struct {
 	                                          *  interrupt */
 	void *PktDropRef;                 /**< To be passed to the error
 	                                     * interrupt callback */
+	u32 TxDrainMask;		/**< MM2S channels left with completed
+					  *  BDs by XMcdma_DrainServiced() */
+	u32 RxDrainMask;		/**< S2MM channels left with completed
+					  *  BDs by XMcdma_DrainServiced() */
+	u32 TxDrainNext;		/**< MM2S channel drained first */
+	u32 RxDrainNext;		/**< S2MM channel drained first */
 
 } XMcdma;
 /***************** Macros (Inline Functions) Definitions *********************/
@@ -596,6 +652,7 @@ u32 XMcdma_SetChanCoalesceDelay(XMcdma_ChanCtrl *Chan, u32 IrqCoalesce,
 u32 XMCdma_SetChan_Weight(XMcdma_ChanCtrl *Chan, u8 Weight);
 u32 XMCdma_GetChan_Weight(XMcdma_ChanCtrl *Chan);
 u32 XMCdma_GetChan_PktDoneCnt(XMcdma_ChanCtrl *Chan);
+u32 XMcdma_SetChanDrainWeight(XMcdma_ChanCtrl *Chan, u8 Weight);
 void XMcdma_SetSGAWCache(XMcdma *InstancePtr, u8 Value);
 void XMcdma_SetSGARCache(XMcdma *InstancePtr, u8 Value);
 
@@ -606,8 +663,14 @@ u32 XMcDma_ChanSubmit(XMcdma_ChanCtrl *Chan, UINTPTR BufAddr, u32 len);
 u32 XMcDma_Chan_Sideband_Submit(XMcdma_ChanCtrl *ChanPtr, UINTPTR BufAddr,
 				u32 Len, u32 *AppPtr, u16 Tuser, u16 Tid);
 u32 XMcDma_ChanToHw(XMcdma_ChanCtrl *Chan);
+u32 XMcDma_SubmitMulti(XMcdma *InstancePtr, u32 Direction,
+		       const XMcdma_Xfer *XferPtr, u32 NumXfers,
+		       u32 *ChanMaskPtr);
+u32 XMcDma_ToHwMulti(XMcdma *InstancePtr, u32 Direction, u32 ChanMask);
 int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit,
 			 XMcdma_Bd **BdSetPtr);
+int XMcdma_BdChainFromHWPkt(XMcdma_ChanCtrl *Chan, u32 BdLimit,
+			    XMcdma_Bd **BdSetPtr);
 int XMcdma_BdChainFree(XMcdma_ChanCtrl *Chan, int BdCount, XMcdma_Bd *BdSetPtr);
 u32 XMcdma_BdSetBufAddr(XMcdma_Bd *BdPtr, UINTPTR Addr);
 void XMcDma_BdSetCtrl(XMcdma_Bd *BdPtr, u32 Data);
@@ -619,6 +682,8 @@ u32 XMcDma_BdGetAppWord(XMcdma_Bd* BdPtr, int Offset, int *Valid);
 /* Global OR'ed Single interrupt */
 void XMcdma_IntrHandler(void *Instance);
 void XMcdma_TxIntrHandler(void *Instance);
+u32 XMcdma_DrainServiced(XMcdma *InstancePtr, u32 Direction, u32 Budget,
+			 XMcdma_DrainHandler Handler, void *CallBackRef);
 s32 XMcdma_SetCallBack(XMcdma *InstancePtr, XMcdma_Handler HandlerType,
 		       void *CallBackFunc, void *CallBackRef);
 /* Per Channel interrupt */
@@ -22,12 +22,17 @@
 *  1.3  rsp  02/11/19 Add top level submit XMcDma_Chan_Sideband_Submit() API
 *                     to program BD control and sideband information.
 *  1.4  rsp  09/17/19 Prefer using dmb in XMcdma_UpdateChanTDesc.
+*       10/19/26 Added XMcDma_SubmitMulti() and XMcDma_ToHwMulti().
+*       10/19/26 Added XMcdma_BdChainFromHWPkt().
 ******************************************************************************/
 
 #include "xmcdma.h"
 #include "xmcdma_hw.h"
 #include "xmcdma_bd.h"
 
+static int XMcdma_BdChainFromHWLimit(XMcdma_ChanCtrl *Chan, u32 BdLimit,
+				     u32 WholePkt, XMcdma_Bd **BdSetPtr);
+
 
 /******************************************************************************
  * Move the BdPtr argument ahead an arbitrary number of BDs wrapping around
@@ -433,6 +438,281 @@ u32 XMcDma_ChanToHw(XMcdma_ChanCtrl *Chan)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* Flush the BDs queued on a channel since it was last given to hardware. The
+* BDs are flushed as one range, or two if they wrap around the end of the
+* chain.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+*
+* @return	None
+*
+*****************************************************************************/
+static void XMcdma_ChanFlushPending(XMcdma_ChanCtrl *Chan)
+{
+	UINTPTR Start;
+	UINTPTR End = Chan->LastBdAddr + Chan->Separation;
+	u32 Len = Chan->BdPendingCnt * Chan->Separation;
+
+	if (Len == 0)
+		return;
+
+	Start = (UINTPTR)Chan->BdRestart - Len;
+	if ((Start < Chan->FirstBdAddr) || (Start > (UINTPTR)Chan->BdRestart)) {
+		Start += Chan->Length;
+	}
+
+	if (Start + Len > End) {
+		XMCDMA_CACHE_FLUSH_RANGE(Start, End - Start);
+		XMCDMA_CACHE_FLUSH_RANGE(Chan->FirstBdAddr,
+					 Len - (End - Start));
+	} else {
+		XMCDMA_CACHE_FLUSH_RANGE(Start, Len);
+	}
+}
+
+/*****************************************************************************/
+/**
+* Populate the BD chain of a channel for one transfer without flushing the
+* BDs. Used by XMcDma_SubmitMulti(), the BDs are flushed by
+* XMcDma_ToHwMulti().
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	BufAddr is the buffer address to which data should send/recv.
+* @param	Len is the Amount of data user requested to send/recv.
+*
+* @return
+*		- XST_SUCCESS if the BDs were populated
+*		- XST_FAILURE if not enough BDs are free
+*
+*****************************************************************************/
+static u32 XMcDma_ChanQueue(XMcdma_ChanCtrl *Chan, UINTPTR BufAddr, u32 Len)
+{
+	u32 BdCount = 1;
+	XMcdma_Bd *BdCurPtr = Chan->BdRestart;
+	u32 i;
+	u32 Bdlen = Len;
+
+	if (Len > Chan->MaxTransferLen) {
+		BdCount = (Len + (Chan->MaxTransferLen - 1)) /
+			   Chan->MaxTransferLen;
+		Bdlen = Chan->MaxTransferLen;
+	}
+
+	if (BdCount > Chan->BdCnt)
+		return XST_FAILURE;
+
+	for (i = 0; i < BdCount; i++) {
+		XMcdma_BdClear(BdCurPtr);
+
+		XMcdma_BdSetBufAddr(BdCurPtr, BufAddr);
+
+		if (Len < Chan->MaxTransferLen)
+			Bdlen = Len;
+
+		XMcdma_BdWrite(BdCurPtr, XMCDMA_BD_CTRL_OFFSET, Bdlen);
+
+		Chan->BdTail = BdCurPtr;
+		BdCurPtr = (XMcdma_Bd *)XMcdma_BdChainNextBd(Chan, BdCurPtr);
+		BufAddr += Bdlen;
+		Len -= Bdlen;
+	}
+
+	Chan->BdRestart = BdCurPtr;
+	Chan->BdPendingCnt += BdCount;
+	Chan->BdCnt -= BdCount;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+* This function populates the BD chains of several channels in one call. It
+* is the multi channel equivalent of calling XMcDma_ChanSubmit() once per
+* transfer, the BDs are given to hardware with XMcDma_ToHwMulti().
+*
+* Transfers are queued in order. Queuing stops at the first transfer with an
+* invalid channel number or for which not enough BDs are free; the transfers
+* before it stay queued.
+*
+* @param	InstancePtr is a pointer to the XMcdma instance.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S channels or
+*		XMCDMA_DEV_TO_MEM for S2MM channels.
+* @param	XferPtr is the array of transfers to queue.
+* @param	NumXfers is the number of entries in XferPtr.
+* @param	ChanMaskPtr is an output parameter, it is set to the mask of
+*		the channels that got new BDs, bit 0 being channel 1. Pass it
+*		to XMcDma_ToHwMulti().
+*
+* @return	The number of transfers queued.
+*
+* @note		Unlike XMcDma_ChanSubmit(), the BDs are not flushed here but
+*		once per channel in XMcDma_ToHwMulti().
+*
+*****************************************************************************/
+u32 XMcDma_SubmitMulti(XMcdma *InstancePtr, u32 Direction,
+		       const XMcdma_Xfer *XferPtr, u32 NumXfers,
+		       u32 *ChanMaskPtr)
+{
+	XMcdma_ChanCtrl *Chan;
+	u32 NumChans;
+	u32 ChanMask = 0;
+	u32 i;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(XferPtr != NULL);
+	Xil_AssertNonvoid(ChanMaskPtr != NULL);
+
+	if (Direction == XMCDMA_MEM_TO_DEV)
+		NumChans = InstancePtr->Config.TxNumChannels;
+	else
+		NumChans = InstancePtr->Config.RxNumChannels;
+
+	for (i = 0; i < NumXfers; i++) {
+		if ((XferPtr[i].Chan_id == 0) ||
+		    (XferPtr[i].Chan_id > NumChans)) {
+			xil_printf("Invalid channel %x\n\r",
+				   XferPtr[i].Chan_id);
+			break;
+		}
+
+		if (Direction == XMCDMA_MEM_TO_DEV)
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr,
+						     XferPtr[i].Chan_id);
+		else
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr,
+						     XferPtr[i].Chan_id);
+
+		if (XMcDma_ChanQueue(Chan, XferPtr[i].BufAddr,
+				     XferPtr[i].Len) != XST_SUCCESS) {
+			break;
+		}
+
+		ChanMask |= 1U << (XferPtr[i].Chan_id - 1);
+	}
+
+	*ChanMaskPtr = ChanMask;
+
+	return i;
+}
+
+/*****************************************************************************/
+/**
+* This function gives the BDs queued on several channels to the hardware. It
+* is the multi channel equivalent of calling XMcDma_ChanToHw() once per
+* channel: the queued BDs of each channel are flushed, the current
+* descriptor of idle channels is programmed, then all tail descriptors are
+* written in a single pass and the channels are enabled with one write to
+* the channel enable register.
+*
+* @param	InstancePtr is a pointer to the XMcdma instance.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S channels or
+*		XMCDMA_DEV_TO_MEM for S2MM channels.
+* @param	ChanMask is the mask of channels to start, bit 0 being
+*		channel 1, as returned by XMcDma_SubmitMulti().
+*
+* @return
+*		- XST_SUCCESS if the BDs were given to hardware
+*		- XST_DMA_ERROR if the DMA fails to start or none of the
+*		channels in ChanMask has queued BDs
+*
+*****************************************************************************/
+u32 XMcDma_ToHwMulti(XMcdma *InstancePtr, u32 Direction, u32 ChanMask)
+{
+	XMcdma_ChanCtrl *Chan = NULL;
+	u32 NumChans;
+	u32 KickMask = 0;
+	u32 Chan_id;
+	u32 Offset;
+	u32 Reg;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (Direction == XMCDMA_MEM_TO_DEV)
+		NumChans = InstancePtr->Config.TxNumChannels;
+	else
+		NumChans = InstancePtr->Config.RxNumChannels;
+
+	for (Chan_id = 1; Chan_id <= NumChans; Chan_id++) {
+		if (!(ChanMask & (1U << (Chan_id - 1))))
+			continue;
+
+		if (Direction == XMCDMA_MEM_TO_DEV)
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+		else
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, Chan_id);
+
+		if (Chan->BdPendingCnt == 0)
+			continue;
+
+		/* The engine is shared by all channels, start it once */
+		if (KickMask == 0 && !XMcdma_HwIsStarted(Chan)) {
+			if (XMcdma_Start(Chan) != XST_SUCCESS) {
+				xil_printf("Failed to start the DMA\n\r");
+				return XST_DMA_ERROR;
+			}
+		}
+
+		XMcdma_ChanFlushPending(Chan);
+
+		/* Program current descriptor and run bit of idle channels */
+		if (Chan->ChanState != XMCDMA_CHAN_BUSY) {
+			XMcdma_UpdateChanCDesc(Chan);
+
+			Offset = (Chan_id - 1) * XMCDMA_NXTCHAN_OFFSET;
+			Reg = XMcdma_ReadReg(Chan->ChanBase,
+					     XMCDMA_CR_OFFSET + Offset);
+			if (!(Reg & XMCDMA_CCR_RUNSTOP_MASK)) {
+				XMcdma_WriteReg(Chan->ChanBase,
+						XMCDMA_CR_OFFSET + Offset,
+						Reg | XMCDMA_CCR_RUNSTOP_MASK);
+			}
+
+			Chan->ChanState = XMCDMA_CHAN_BUSY;
+		}
+
+		KickMask |= 1U << (Chan_id - 1);
+	}
+
+	if (KickMask == 0)
+		return XST_DMA_ERROR;
+
+	DATA_SYNC;
+
+	/* Update all tail descriptors in one pass */
+	for (Chan_id = 1; Chan_id <= NumChans; Chan_id++) {
+		if (!(KickMask & (1U << (Chan_id - 1))))
+			continue;
+
+		if (Direction == XMCDMA_MEM_TO_DEV)
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+		else
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, Chan_id);
+
+		Offset = (Chan_id - 1) * XMCDMA_NXTCHAN_OFFSET;
+		XMcdma_WriteReg(Chan->ChanBase,
+				(XMCDMA_TDESC_OFFSET + Offset),
+				LOWER_32_BITS((UINTPTR)Chan->BdTail));
+		if (Chan->ext_addr) {
+			XMcdma_WriteReg(Chan->ChanBase,
+				  (XMCDMA_TDESC_MSB_OFFSET + Offset),
+				  UPPER_32_BITS((UINTPTR)Chan->BdTail));
+		}
+		Chan->BdSubmitCnt += Chan->BdPendingCnt;
+		Chan->BdPendingCnt = 0;
+	}
+
+	/* Enable all the channels at once */
+	Reg = XMcdma_ReadReg(Chan->ChanBase, XMCDMA_CHEN_OFFSET);
+	if ((Reg & KickMask) != KickMask) {
+		XMcdma_WriteReg(Chan->ChanBase, XMCDMA_CHEN_OFFSET,
+				Reg | KickMask);
+	}
+
+	return XST_SUCCESS;
+}
+
 /*****************************************************************************/
 /**
 * Returns a set of BD(s) that have been processed by hardware. The returned
@@ -456,6 +736,53 @@ u32 XMcDma_ChanToHw(XMcdma_ChanCtrl *Chan)
 *
 *****************************************************************************/
 int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPtr)
+{
+	return XMcdma_BdChainFromHWLimit(Chan, BdLimit, FALSE, BdSetPtr);
+}
+
+/*****************************************************************************/
+/**
+* Returns a set of BD(s) that have been processed by hardware, like
+* XMcdma_BdChainFromHW(), except that a completed packet is never split: if
+* BdLimit ends in the middle of a completed packet, the set is extended to
+* the end of that packet.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	BdLimit is the number of BDs to return in the set, extended
+*		to the end of the packet it falls in.
+* @param	BdSetPtr is an output parameter, it points to the first BD
+*		available for examination.
+*
+* @return	The number of BDs processed by hardware. A value of 0 indicates
+*		that no data is available. May be more than BdLimit.
+*
+* @note	Treat BDs returned by this function as read-only.
+*
+*****************************************************************************/
+int XMcdma_BdChainFromHWPkt(XMcdma_ChanCtrl *Chan, u32 BdLimit,
+			    XMcdma_Bd **BdSetPtr)
+{
+	return XMcdma_BdChainFromHWLimit(Chan, BdLimit, TRUE, BdSetPtr);
+}
+
+/*****************************************************************************/
+/**
+* Walks the completed BDs of a channel and returns the whole packets among
+* the first BdLimit of them. With WholePkt set, the walk continues past
+* BdLimit to the end of the packet BdLimit falls in. Each BD is invalidated
+* and read once.
+*
+* @param	Chan is the MCDMA Channel to be worked on.
+* @param	BdLimit is the maximum number of BDs to return in the set.
+* @param	WholePkt is TRUE to extend BdLimit to a packet boundary.
+* @param	BdSetPtr is an output parameter, it points to the first BD
+*		available for examination.
+*
+* @return	The number of BDs processed by hardware.
+*
+*****************************************************************************/
+static int XMcdma_BdChainFromHWLimit(XMcdma_ChanCtrl *Chan, u32 BdLimit,
+				     u32 WholePkt, XMcdma_Bd **BdSetPtr)
 {
 	XMcdma_Bd *CurBdPtr;
 	u32 BdCount;
@@ -479,7 +806,9 @@ int XMcdma_BdChainFromHW(XMcdma_ChanCtrl *Chan, u32 BdLimit, XMcdma_Bd **BdSetPt
 		BdLimit = Chan->BdSubmitCnt;
 	}
 
-	while (BdCount < BdLimit) {
+	while ((BdCount < BdLimit) ||
+	       (WholePkt && (BdPartialCount > 0) &&
+		(BdCount < Chan->BdSubmitCnt))) {
 		XMCDMA_CACHE_INVALIDATE((UINTPTR)(CurBdPtr));
 
 		if(!(Chan->IsRxChan)) {
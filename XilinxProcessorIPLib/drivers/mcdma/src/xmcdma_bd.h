@@ -16,6 +16,7 @@
 * 1.0	adk  18/07/17 Initial version.
 * 1.2	mj   05/03/18 Added macro XMcdma_BdSetSwId and XMcdma_BdGetSwId to set
 *                     and get Sw ID field from BD.
+*            10/19/26 Added XMCDMA_CACHE_FLUSH_RANGE for a run of BDs.
 *****************************************************************************/
 
 #ifndef XMCDMA_BD_H_
@@ -34,10 +35,14 @@ typedef u32 XMcdma_Bd[16];
 #ifdef __aarch64__
 #define XMCDMA_CACHE_FLUSH(BdPtr)
 #define XMCDMA_CACHE_INVALIDATE(BdPtr)
+#define XMCDMA_CACHE_FLUSH_RANGE(Addr, Len)
 #else
 #define XMCDMA_CACHE_FLUSH(BdPtr) \
         Xil_DCacheFlushRange((UINTPTR)(BdPtr), XMCDMA_BD_HW_NUM_BYTES)
 
+#define XMCDMA_CACHE_FLUSH_RANGE(Addr, Len) \
+        Xil_DCacheFlushRange((UINTPTR)(Addr), (Len))
+
 #define XMCDMA_CACHE_INVALIDATE(BdPtr) \
         Xil_DCacheInvalidateRange((UINTPTR)(BdPtr), XMCDMA_BD_HW_NUM_BYTES)
 #endif
@@ -18,6 +18,9 @@
 * Ver   Who     Date     Changes
 * ----- ------  -------- ------------------------------------------------------
 * 1.0    adk    18/07/17 Initial version.
+*               10/19/26 Added XMcdma_DrainServiced().
+*               10/19/26 Extend the drain limit to a packet boundary.
+*               10/19/26 Walk the completed BDs once per drain.
 *
 ******************************************************************************/
 
@@ -314,6 +317,163 @@ out:
 	return;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function drains the completed BDs of all serviced channels of one
+* direction in a single call, typically from the interrupt handler.
+*
+* The serviced channel register is read once and the interrupts of each
+* serviced channel are acknowledged. Completed BDs are then retrieved round
+* robin: per round each pending channel returns up to
+* DrainWeight * XMCDMA_DRAIN_QUANTUM BDs, which are passed to Handler and
+* freed once it returns. Packets are never split, so the limit is extended
+* to the end of the packet it falls in when that packet has completed. A
+* channel stops being pending when it returns fewer BDs than allowed.
+* Channels still pending when Budget is used up are kept for the next call,
+* which also starts the round robin one channel later.
+*
+* Error and packet drop interrupts are reported through the error and packet
+* drop callbacks installed with XMcdma_SetCallBack(), if any. The done
+* callbacks are not called.
+*
+* @param	InstancePtr is a pointer to the XMcdma instance to be worked on.
+* @param	Direction is XMCDMA_MEM_TO_DEV for MM2S channels or
+*		XMCDMA_DEV_TO_MEM for S2MM channels.
+* @param	Budget is the maximum number of BDs to drain.
+* @param	Handler is called for each set of BDs retrieved.
+* @param	CallBackRef is a user data item passed to Handler.
+*
+* @return	The number of BDs drained. It can exceed Budget by less than
+*		one packet.
+*
+* @note		Handler must not keep pointers to the BDs, they are cleared
+*		when freed.
+*
+******************************************************************************/
+u32 XMcdma_DrainServiced(XMcdma *InstancePtr, u32 Direction, u32 Budget,
+			 XMcdma_DrainHandler Handler, void *CallBackRef)
+{
+	XMcdma_ChanCtrl *Chan;
+	XMcdma_Bd *BdSetPtr;
+	u32 *PendingPtr;
+	u32 *NextPtr;
+	u32 NumChans;
+	u32 Chan_SerMask;
+	u32 Pending;
+	u32 IrqStatus;
+	u32 Chan_id;
+	u32 Start;
+	u32 Limit;
+	u32 Drained = 0;
+	u32 i;
+	int BdCount;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(Handler != NULL);
+
+	if (Direction == XMCDMA_MEM_TO_DEV) {
+		NumChans = InstancePtr->Config.TxNumChannels;
+		PendingPtr = &InstancePtr->TxDrainMask;
+		NextPtr = &InstancePtr->TxDrainNext;
+		Chan_SerMask = XMcdma_ReadReg(InstancePtr->Config.BaseAddress,
+					      XMCDMA_TXINT_SER_OFFSET);
+	} else {
+		NumChans = InstancePtr->Config.RxNumChannels;
+		PendingPtr = &InstancePtr->RxDrainMask;
+		NextPtr = &InstancePtr->RxDrainNext;
+		Chan_SerMask = XMcdma_ReadReg(InstancePtr->Config.BaseAddress,
+					      XMCDMA_RX_OFFSET +
+					      XMCDMA_RXINT_SER_OFFSET);
+	}
+
+	if (NumChans == 0)
+		return 0;
+
+	/* Acknowledge the interrupts of all serviced channels */
+	for (Chan_id = 1; Chan_id <= NumChans; Chan_id++) {
+		if (!(Chan_SerMask & (1U << (Chan_id - 1))))
+			continue;
+
+		if (Direction == XMCDMA_MEM_TO_DEV)
+			Chan = XMcdma_GetMcdmaTxChan(InstancePtr, Chan_id);
+		else
+			Chan = XMcdma_GetMcdmaRxChan(InstancePtr, Chan_id);
+
+		IrqStatus = XMcdma_ChanGetIrq(Chan);
+		XMcdma_ChanAckIrq(Chan, IrqStatus);
+
+		if ((IrqStatus & (XMCDMA_IRQ_DELAY_MASK | XMCDMA_IRQ_IOC_MASK)))
+			Chan->ChanState = XMCDMA_CHAN_IDLE;
+
+		if ((IrqStatus & XMCDMA_IRQ_PKTDROP_MASK) &&
+		    (Direction == XMCDMA_DEV_TO_MEM)) {
+			Chan->ChanState = XMCDMA_CHAN_IDLE;
+			if (InstancePtr->PktDropHandler)
+				InstancePtr->PktDropHandler(
+					InstancePtr->PktDropRef, Chan_id);
+		}
+
+		if ((IrqStatus & XMCDMA_IRQ_ERROR_MASK)) {
+			Chan->ChanState = XMCDMA_CHAN_PAUSE;
+			if (Direction == XMCDMA_MEM_TO_DEV) {
+				if (InstancePtr->TxErrorHandler)
+					InstancePtr->TxErrorHandler(
+						InstancePtr->TxErrorRef,
+						Chan_id, IrqStatus);
+			} else if (InstancePtr->ErrorHandler) {
+				InstancePtr->ErrorHandler(
+					InstancePtr->ErrorRef, Chan_id,
+					IrqStatus);
+			}
+		}
+	}
+
+	Pending = *PendingPtr | Chan_SerMask;
+
+	Start = *NextPtr;
+	if ((Start == 0) || (Start > NumChans))
+		Start = 1;
+
+	/* Weighted round robin over the pending channels */
+	while (Pending && (Drained < Budget)) {
+		for (i = 0; (i < NumChans) && (Drained < Budget); i++) {
+			Chan_id = ((Start - 1 + i) % NumChans) + 1;
+			if (!(Pending & (1U << (Chan_id - 1))))
+				continue;
+
+			if (Direction == XMCDMA_MEM_TO_DEV)
+				Chan = XMcdma_GetMcdmaTxChan(InstancePtr,
+							     Chan_id);
+			else
+				Chan = XMcdma_GetMcdmaRxChan(InstancePtr,
+							     Chan_id);
+
+			Limit = Chan->DrainWeight * XMCDMA_DRAIN_QUANTUM;
+			if (Limit > Budget - Drained)
+				Limit = Budget - Drained;
+			BdCount = XMcdma_BdChainFromHWPkt(Chan, Limit,
+							  &BdSetPtr);
+			if (BdCount > 0) {
+				Handler(CallBackRef, Chan_id, BdSetPtr,
+					BdCount);
+				XMcdma_BdChainFree(Chan, BdCount, BdSetPtr);
+				Drained += BdCount;
+			}
+
+			/* Fewer BDs than allowed, the channel is drained */
+			if ((u32)BdCount < Limit)
+				Pending &= ~(1U << (Chan_id - 1));
+		}
+	}
+
+	*PendingPtr = Pending;
+	*NextPtr = (Start % NumChans) + 1;
+
+	return Drained;
+}
+
 /*****************************************************************************/
 /**
 *
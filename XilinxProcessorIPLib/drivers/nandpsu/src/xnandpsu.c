@@ -88,6 +88,10 @@
 * 1.10  akm    10/20/21    Fix gcc warnings.
 * 1.10  akm    12/21/21    Validate input parameters before use.
 * 1.10  akm    01/05/22    Remove assert checks form static and internal APIs.
+*              10/19/26    Use the bad block bitmap to skip bad blocks and
+*                          read runs of full pages with ONFI read cache
+*                          sequential commands.
+*              10/19/26    End an abandoned cache read with 3Fh.
 *
 * </pre>
 *
@@ -175,6 +179,18 @@ static s32 XNandPsu_ProgramPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 							u32 Col, u8 *Buf);
 
+static s32 XNandPsu_ReadPageCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u32 Col, u8 *Buf, u8 Cmd1, u8 Cmd2,
+				u8 AddrCycles, u32 ProgMask);
+
+static s32 XNandPsu_ReadCacheStart(XNandPsu *InstancePtr, u32 Target,
+							u32 Page);
+
+static s32 XNandPsu_ReadCachePages(XNandPsu *InstancePtr, u32 Target,
+					u32 Page, u32 NumPages, u8 *Buf);
+
+static void XNandPsu_ReadCacheAbort(XNandPsu *InstancePtr, u32 Target);
+
 static s32 XNandPsu_CheckOnDie(XNandPsu *InstancePtr, OnfiParamPage *Param);
 
 static void XNandPsu_SetEccAddrSize(XNandPsu *InstancePtr);
@@ -572,6 +588,8 @@ static void XNandPsu_InitFeatures(XNandPsu *InstancePtr, OnfiParamPage *Param)
 								1U : 0U;
 	InstancePtr->Features.ExtPrmPage = ((Param->Features & (1U << 7)) != 0U) ?
 								1U : 0U;
+	InstancePtr->Features.ReadCache =
+			((Param->OptionalCmds & (1U << 1)) != 0U) ? 1U : 0U;
 }
 
 /*****************************************************************************/
@@ -1362,24 +1380,26 @@ static s32 XNandPsu_CalculateLength(XNandPsu *InstancePtr, u64 Offset,
 	u32 BlockSize;
 	u32 BlockLen;
 	u32 Block;
+	u32 GoodBlock;
 	u64 TempLen = 0;
 	u64 OffsetVar = Offset;
 
 	BlockSize = InstancePtr->Geometry.BlockSize;
 
 	while (TempLen < Length) {
-		Block = (u32)(OffsetVar/BlockSize);
-		BlockLen = BlockSize - (u32)(OffsetVar % BlockSize);
 		if (OffsetVar >= InstancePtr->Geometry.DeviceSize) {
 			Status = XST_FAILURE;
 			goto Out;
 		}
-		/* Check if the block is bad */
-		Status = XNandPsu_IsBlockBad(InstancePtr, Block);
-		if (Status != XST_SUCCESS) {
-			/* Good block */
-			TempLen += BlockLen;
+		Block = (u32)(OffsetVar/BlockSize);
+		/* Skip a run of bad blocks in one step */
+		GoodBlock = XNandPsu_NextGoodBlock(InstancePtr, Block);
+		if (GoodBlock != Block) {
+			OffsetVar = (u64)GoodBlock * BlockSize;
+			continue;
 		}
+		BlockLen = BlockSize - (u32)(OffsetVar % BlockSize);
+		TempLen += BlockLen;
 		OffsetVar += BlockLen;
 	}
 
@@ -1420,6 +1440,7 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 	u32 Col;
 	u32 Target;
 	u32 Block;
+	u32 GoodBlock;
 	u32 PartialBytes = 0;
 	u32 NumBytes;
 	u32 RemLen;
@@ -1440,12 +1461,14 @@ s32 XNandPsu_Write(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *SrcBuf)
 	while (LengthVar > 0U) {
 		Block = (u32) (OffsetVar/InstancePtr->Geometry.BlockSize);
 		/*
-		 * Skip the bad blocks. Increment the offset by block size.
-		 * For better results, always program the flash starting at
-		 * a block boundary.
+		 * Skip the bad blocks. Increment the offset by block size
+		 * for each bad block. For better results, always program the
+		 * flash starting at a block boundary.
 		 */
-		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
+		GoodBlock = XNandPsu_NextGoodBlock(InstancePtr, Block);
+		if (GoodBlock != Block) {
+			OffsetVar += (u64)(GoodBlock - Block) *
+					InstancePtr->Geometry.BlockSize;
 			continue;
 		}
 		/* Calculate Page and Column address values */
@@ -1535,6 +1558,8 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 	u32 Col;
 	u32 Target;
 	u32 Block;
+	u32 GoodBlock;
+	u32 NumPages;
 	u32 PartialBytes = 0U;
 	u32 RemLen;
 	u32 NumBytes;
@@ -1555,12 +1580,15 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 	while (LengthVar > 0U) {
 		Block = (u32)(OffsetVar/InstancePtr->Geometry.BlockSize);
 		/*
-		 * Skip the bad block. Increment the offset by block size.
-		 * The flash programming utility must make sure to start
-		 * writing always at a block boundary and skip blocks if any.
+		 * Skip the bad blocks. Increment the offset by block size
+		 * for each bad block. The flash programming utility must make
+		 * sure to start writing always at a block boundary and skip
+		 * blocks if any.
 		 */
-		if (XNandPsu_IsBlockBad(InstancePtr, Block) == XST_SUCCESS) {
-			OffsetVar += (u64)InstancePtr->Geometry.BlockSize;
+		GoodBlock = XNandPsu_NextGoodBlock(InstancePtr, Block);
+		if (GoodBlock != Block) {
+			OffsetVar += (u64)(GoodBlock - Block) *
+					InstancePtr->Geometry.BlockSize;
 			continue;
 		}
 		/* Calculate Page and Column address values */
@@ -1594,9 +1622,31 @@ s32 XNandPsu_Read(XNandPsu *InstancePtr, u64 Offset, u64 Length, u8 *DestBuf)
 					InstancePtr->Geometry.BytesPerPage :
 					(u32)LengthVar;
 		}
-		/* Read page */
-		Status = XNandPsu_ReadPage(InstancePtr, Target, Page, 0U,
-								BufPtr);
+		/*
+		 * Read a run of full pages within the block with read cache
+		 * commands when the device supports them.
+		 */
+		NumPages = 1U;
+		if ((PartialBytes == 0U) &&
+			(InstancePtr->Features.ReadCache != 0U)) {
+			NumPages = InstancePtr->Geometry.PagesPerBlock -
+				(Page % InstancePtr->Geometry.PagesPerBlock);
+			if (LengthVar < ((u64)NumPages *
+					InstancePtr->Geometry.BytesPerPage)) {
+				NumPages = (u32)(LengthVar /
+					InstancePtr->Geometry.BytesPerPage);
+			}
+		}
+		if (NumPages > 1U) {
+			Status = XNandPsu_ReadCachePages(InstancePtr, Target,
+						Page, NumPages, BufPtr);
+			NumBytes = NumPages *
+					InstancePtr->Geometry.BytesPerPage;
+		} else {
+			/* Read page */
+			Status = XNandPsu_ReadPage(InstancePtr, Target, Page,
+							0U, BufPtr);
+		}
 		if (Status != XST_SUCCESS) {
 			goto Out;
 		}
@@ -1943,13 +1993,47 @@ Out:
 ******************************************************************************/
 static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 							u32 Col, u8 *Buf)
+{
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+				InstancePtr->Geometry.ColAddrCycles;
+
+	return XNandPsu_ReadPageCmd(InstancePtr, Target, Page, Col, Buf,
+				ONFI_CMD_RD1, ONFI_CMD_RD2, (u8)AddrCycles,
+				XNANDPSU_PROG_RD_MASK);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sends a read command which transfers one page of data from
+* flash, either the ONFI Read Page command or one of the read cache commands.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the page address value to read.
+* @param	Col is the column address value to read.
+* @param	Buf is the data buffer to fill in.
+* @param	Cmd1 is the first ONFI command.
+* @param	Cmd2 is the second ONFI command.
+* @param	AddrCycles is the number of address cycles, 0 for the read
+*		cache sequential and end commands.
+* @param	ProgMask is the Program Register operation to start.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadPageCmd(XNandPsu *InstancePtr, u32 Target, u32 Page,
+				u32 Col, u8 *Buf, u8 Cmd1, u8 Cmd2,
+				u8 AddrCycles, u32 ProgMask)
 {
 	u32 PktSize;
 	u32 PktCount;
 	s32 Status = XST_FAILURE;
 	u32 RegVal;
-	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
-				InstancePtr->Geometry.ColAddrCycles;
 
 	if (InstancePtr->EccCfg.CodeWordSize > 9U) {
 		PktSize = 1024U;
@@ -1958,8 +2042,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	}
 	PktCount = InstancePtr->Geometry.BytesPerPage/PktSize;
 
-	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
-					1U, 1U, (u8)AddrCycles);
+	XNandPsu_Prepare_Cmd(InstancePtr, Cmd1, Cmd2, 1U, 1U, AddrCycles);
 
 	if (InstancePtr->DmaMode == XNANDPSU_MDMA) {
 		RegVal = XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK |
@@ -1996,7 +2079,7 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 
 	/* Set Read command in Program Register */
 	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
-				XNANDPSU_PROG_OFFSET,XNANDPSU_PROG_RD_MASK);
+				XNANDPSU_PROG_OFFSET, ProgMask);
 
 	Status = XNandPsu_Data_ReadWrite(InstancePtr, Buf, PktCount, PktSize, 0, 1);
 
@@ -2049,6 +2132,152 @@ static s32 XNandPsu_ReadPage(XNandPsu *InstancePtr, u32 Target, u32 Page,
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function sends the ONFI Read Page command which starts a cache read.
+* The page is loaded into the data register of the flash and no data is
+* transferred.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page address value to read.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		None
+*
+******************************************************************************/
+static s32 XNandPsu_ReadCacheStart(XNandPsu *InstancePtr, u32 Target,
+							u32 Page)
+{
+	u32 AddrCycles = InstancePtr->Geometry.RowAddrCycles +
+				InstancePtr->Geometry.ColAddrCycles;
+
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD1, ONFI_CMD_RD2,
+					0U, 0U, (u8)AddrCycles);
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_INTR_STS_EN_OFFSET,
+			XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK);
+	/* Program Page Size */
+	XNandPsu_SetPageSize(InstancePtr);
+	/* Program Column, Page, Block address */
+	XNandPsu_SetPageColAddr(InstancePtr, Page, 0U);
+	/* No data is transferred */
+	XNandPsu_SetPktSzCnt(InstancePtr, 0U, 0U);
+	/* Program Memory Address Register2 for chip select */
+	XNandPsu_SelectChip(InstancePtr, Target);
+	/* Set Read Cache Start command in Program Register */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_CACHE_START_MASK);
+
+	return XNandPsu_WaitFor_Transfer_Complete(InstancePtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function reads a run of full pages within one block using the ONFI
+* read cache commands. After the first page is loaded, each read cache
+* sequential command (31h) moves the loaded page to the cache register and
+* starts loading the next page while the cached page is transferred. The last
+* page is transferred with the read cache end command (3Fh). Compared to
+* XNandPsu_ReadPage, the array read time of every page but the first is
+* hidden behind the transfer of the previous page.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+* @param	Page is the first page address value to read.
+* @param	NumPages is the number of pages to read, at least 2.
+* @param	Buf is the data buffer to fill in, NumPages pages long.
+*
+* @return
+*		- XST_SUCCESS if successful.
+*		- XST_FAILURE if failed.
+*
+* @note		The pages must not cross a block boundary.
+*
+******************************************************************************/
+static s32 XNandPsu_ReadCachePages(XNandPsu *InstancePtr, u32 Target,
+					u32 Page, u32 NumPages, u8 *Buf)
+{
+	s32 Status;
+	u32 Index;
+	u8 Cmd;
+	u32 ProgMask;
+	u8 *BufPtr = Buf;
+
+	Status = XNandPsu_ReadCacheStart(InstancePtr, Target, Page);
+	if (Status != XST_SUCCESS) {
+		goto Out;
+	}
+
+	for (Index = 0U; Index < NumPages; Index++) {
+		if (Index < (NumPages - 1U)) {
+			Cmd = ONFI_CMD_RD_CACHE_SEQ;
+			ProgMask = XNANDPSU_PROG_RD_CACHE_SEQ_MASK;
+		} else {
+			Cmd = ONFI_CMD_RD_CACHE_END;
+			ProgMask = XNANDPSU_PROG_RD_CACHE_END_MASK;
+		}
+		Status = XNandPsu_ReadPageCmd(InstancePtr, Target,
+				Page + Index, 0U, BufPtr, Cmd, 0U, 0U,
+				ProgMask);
+		if (Status != XST_SUCCESS) {
+			/* 31h leaves the flash in cache read mode */
+			if (Cmd == ONFI_CMD_RD_CACHE_SEQ) {
+				XNandPsu_ReadCacheAbort(InstancePtr, Target);
+			}
+			goto Out;
+		}
+		BufPtr += InstancePtr->Geometry.BytesPerPage;
+	}
+
+Out:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function ends a cache read abandoned after a read cache sequential
+* command (31h). The read cache end command (3Fh) is sent without
+* transferring data. If it does not complete, the flash is reset.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+* @param	Target is the chip select value.
+*
+* @return	None
+*
+* @note		The caller's error status is kept, the flash is only brought
+*		out of cache read mode.
+*
+******************************************************************************/
+static void XNandPsu_ReadCacheAbort(XNandPsu *InstancePtr, u32 Target)
+{
+	s32 Status;
+
+	XNandPsu_Prepare_Cmd(InstancePtr, ONFI_CMD_RD_CACHE_END,
+				ONFI_CMD_INVALID, 0U, 0U, 0U);
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_INTR_STS_EN_OFFSET,
+			XNANDPSU_INTR_STS_EN_TRANS_COMP_STS_EN_MASK);
+	/* No data is transferred */
+	XNandPsu_SetPktSzCnt(InstancePtr, 0U, 0U);
+	/* Program Memory Address Register2 for chip select */
+	XNandPsu_SelectChip(InstancePtr, Target);
+	/* Set Read Cache End command in Program Register */
+	XNandPsu_WriteReg((InstancePtr)->Config.BaseAddress,
+			XNANDPSU_PROG_OFFSET, XNANDPSU_PROG_RD_CACHE_END_MASK);
+
+	Status = XNandPsu_WaitFor_Transfer_Complete(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		(void)XNandPsu_OnfiReset(InstancePtr, Target);
+	}
+}
+
 /*****************************************************************************/
 /**
 *
@@ -63,6 +63,18 @@
 * the control is returned back to user only after the read operation is
 * completed successfully or an error is reported.
 *
+* When the device reports ONFI read cache support, runs of two or more full
+* pages within one block are read with the read cache sequential command
+* (31h) and finished with the read cache end command (3Fh), so the array read
+* of the next page overlaps the transfer of the current page. Full pages are
+* transferred directly into the user buffer. The cache read path can be
+* disabled by clearing Features.ReadCache in the instance after
+* initialization.
+*
+* Bad blocks are looked up in a bitmap kept in RAM next to the bad block
+* table, one bit per block, which also lets the read and write calls skip a
+* run of bad blocks in one step.
+*
 * <b>Erase Operation</b>
 *
 * The erase operations are provided to erase a Block in the Flash memory. The
@@ -152,6 +164,8 @@
 * 1.10  akm    10/20/21    Fix gcc warnings.
 * 1.10  akm    12/21/21    Validate input parameters before use.
 * 1.10  akm    01/05/22    Remove assert checks form static and internal APIs.
+*              10/19/26    Added the RAM bad block bitmap and the ONFI read
+*                          cache path for sequential reads.
 *
 * </pre>
 *
@@ -337,6 +351,7 @@ typedef struct {
 	u32 EzNand;
 	u32 OnDie;
 	u32 ExtPrmPage;
+	u32 ReadCache;	/**< Read cache commands supported */
 } XNandPsu_Features;
 
 /**
@@ -396,6 +411,9 @@ typedef struct {
 	XNandPsu_BadBlockPattern BbPattern;	/**< Bad block pattern to
 						  search */
 	u8 Bbt[XNANDPSU_MAX_BLOCKS >> 2];	/**< Bad block table array */
+	u32 BadBlockMap[XNANDPSU_MAX_BLOCKS >> 5];	/**< One bit per block,
+							  set if the block is
+							  bad */
 } XNandPsu;
 
 /******************* Macro Definitions (Inline Functions) *******************/
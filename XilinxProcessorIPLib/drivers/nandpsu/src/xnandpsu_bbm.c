@@ -29,6 +29,8 @@
 *	                   data access.
 * 1.4	nsk    04/10/18    Added ICCARM compiler support.
 * 1.10	akm    01/05/22    Remove assert checks form static and internal APIs.
+*              10/19/26    Mirror bad blocks in a bitmap for XNandPsu_IsBlockBad
+*                          and added XNandPsu_NextGoodBlock.
 * </pre>
 *
 ******************************************************************************/
@@ -64,6 +66,8 @@ static s32 XNandPsu_MarkBbt(XNandPsu* InstancePtr, XNandPsu_BbtDesc *Desc,
 
 static s32 XNandPsu_UpdateBbt(XNandPsu *InstancePtr, u32 Target);
 
+static void XNandPsu_BuildBadBlockMap(XNandPsu *InstancePtr);
+
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
@@ -263,6 +267,8 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 	BbtLen = InstancePtr->Geometry.NumBlocks >>
 					XNANDPSU_BBT_BLOCK_SHIFT;
 	(void)memset(&InstancePtr->Bbt[0], 0, BbtLen);
+	(void)memset(&InstancePtr->BadBlockMap[0], 0,
+			sizeof(InstancePtr->BadBlockMap));
 
 	for (Index = 0U; Index < InstancePtr->Geometry.NumTargets; Index++) {
 
@@ -302,11 +308,48 @@ s32 XNandPsu_ScanBbt(XNandPsu *InstancePtr)
 		}
 	}
 
+	XNandPsu_BuildBadBlockMap(InstancePtr);
+
 	Status = XST_SUCCESS;
 Out:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* This function builds the bad block bitmap from the RAM based Bad Block
+* Table(BBT). Blocks marked bad or factory bad get their bit set; good and
+* reserved blocks are left clear.
+*
+* @param	InstancePtr is a pointer to the XNandPsu instance.
+*
+* @return
+*		- NONE.
+*
+******************************************************************************/
+static void XNandPsu_BuildBadBlockMap(XNandPsu *InstancePtr)
+{
+	u32 Block;
+	u32 Word;
+	u8 BlockType;
+
+	for (Block = 0U; Block < InstancePtr->Geometry.NumBlocks; Block++) {
+		Word = Block >> XNANDPSU_BB_MAP_WORD_SHIFT;
+		if ((Block & XNANDPSU_BB_MAP_BIT_MASK) == 0U) {
+			InstancePtr->BadBlockMap[Word] = 0U;
+		}
+		BlockType = (InstancePtr->Bbt[Block >>
+				XNANDPSU_BBT_BLOCK_SHIFT] >>
+				XNandPsu_BbtBlockShift(Block)) &
+				XNANDPSU_BLOCK_TYPE_MASK;
+		if ((BlockType != XNANDPSU_BLOCK_GOOD) &&
+			(BlockType != XNANDPSU_BLOCK_RESERVED)) {
+			InstancePtr->BadBlockMap[Word] |= (u32)1U <<
+					(Block & XNANDPSU_BB_MAP_BIT_MASK);
+		}
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function converts the Bad Block Table(BBT) read from the flash to the
@@ -836,19 +879,10 @@ s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block)
 	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY)
 	Xil_AssertNonvoid(Block < InstancePtr->Geometry.NumBlocks);
 
-	u8 Data;
-	u8 BlockShift;
-	u8 BlockType;
-	u32 BlockOffset;
 	s32 Status;
 
-	BlockOffset = Block >> XNANDPSU_BBT_BLOCK_SHIFT;
-	BlockShift = XNandPsu_BbtBlockShift(Block);
-	Data = InstancePtr->Bbt[BlockOffset];	/* Block information in BBT */
-	BlockType = (Data >> BlockShift) & XNANDPSU_BLOCK_TYPE_MASK;
-
-	if ((BlockType != XNANDPSU_BLOCK_GOOD) &&
-		(BlockType != XNANDPSU_BLOCK_RESERVED)) {
+	if ((InstancePtr->BadBlockMap[Block >> XNANDPSU_BB_MAP_WORD_SHIFT] &
+		((u32)1U << (Block & XNANDPSU_BB_MAP_BIT_MASK))) != 0U) {
 		Status = XST_SUCCESS;
 	}
 	else {
@@ -857,6 +891,50 @@ s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+*
+* This function returns the first good block at or after the given block.
+* Whole words of the bad block bitmap are skipped at once, so a run of bad
+* blocks costs one test per 32 blocks.
+*
+* @param	InstancePtr is the pointer to the XNandPsu instance.
+* @param	Block is the block number to start from.
+*
+* @return
+*		- The first good block number, or the total number of blocks
+*		  if there is no good block left.
+*
+******************************************************************************/
+u32 XNandPsu_NextGoodBlock(XNandPsu *InstancePtr, u32 Block)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY)
+
+	u32 NumBlocks = InstancePtr->Geometry.NumBlocks;
+	u32 BlockVar = Block;
+	u32 Map;
+
+	while (BlockVar < NumBlocks) {
+		Map = InstancePtr->BadBlockMap[BlockVar >>
+					XNANDPSU_BB_MAP_WORD_SHIFT] >>
+				(BlockVar & XNANDPSU_BB_MAP_BIT_MASK);
+		if ((Map & 1U) == 0U) {
+			goto Out;
+		}
+		if (Map == (0xFFFFFFFFU >> (BlockVar &
+					XNANDPSU_BB_MAP_BIT_MASK))) {
+			/* Rest of this word is bad, move to the next word */
+			BlockVar = (BlockVar | XNANDPSU_BB_MAP_BIT_MASK) + 1U;
+		} else {
+			BlockVar++;
+		}
+	}
+	BlockVar = NumBlocks;
+Out:
+	return BlockVar;
+}
+
 /*****************************************************************************/
 /**
 * This function marks a block as bad in the RAM based Bad Block Table(BBT). It
@@ -896,6 +974,8 @@ s32 XNandPsu_MarkBlockBad(XNandPsu *InstancePtr, u32 Block)
 	Data |= (XNANDPSU_BLOCK_BAD << BlockShift);
 	NewVal = Data;
 	InstancePtr->Bbt[BlockOffset] = Data;
+	InstancePtr->BadBlockMap[Block >> XNANDPSU_BB_MAP_WORD_SHIFT] |=
+			(u32)1U << (Block & XNANDPSU_BB_MAP_BIT_MASK);
 
 	/* Update the Bad Block Table(BBT) in flash */
 	if (OldVal != NewVal) {
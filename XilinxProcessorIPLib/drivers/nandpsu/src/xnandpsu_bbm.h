@@ -52,6 +52,12 @@
 * XNandPsu_IsBlockBad and take the action based on the return value. Also user
 * can update the bad block table using XNandPsu_MarkBlockBad API.
 *
+* The bad and factory bad entries of the RAM based table are mirrored in a
+* bitmap with one bit per block, so XNandPsu_IsBlockBad is a single bit test.
+* XNandPsu_NextGoodBlock uses the bitmap to find the first good block at or
+* after a given block, skipping 32 bad blocks per word, for mapping logical
+* offsets to physical blocks.
+*
 * @note		None
 *
 * <pre>
@@ -64,6 +70,8 @@
 *			   in page section by enabling XNANDPSU_BBT_NO_OOB.
 *			   Modified Bbt Signature and Version Offset value for
 *			   Oob and No-Oob region.
+*              10/19/26    Added the bad block bitmap and
+*                          XNandPsu_NextGoodBlock.
 * </pre>
 *
 ******************************************************************************/
@@ -117,6 +125,12 @@ extern "C" {
 							  for a block in BBT */
 #define XNANDPSU_BBT_ENTRY_NUM_BLOCKS		4U	/**< Num of blocks in
 							  one BBT entry */
+#define XNANDPSU_BB_MAP_WORD_SHIFT		5U	/**< Block shift value
+							  for a word in the
+							  bad block bitmap */
+#define XNANDPSU_BB_MAP_BIT_MASK		0x1FU	/**< Bit index mask for
+							  a block in the bad
+							  block bitmap */
 #define XNANDPSU_BB_PTRN_OFF_SML_PAGE	5U	/**< Bad block pattern
 							  offset in a page */
 #define XNANDPSU_BB_PTRN_LEN_SML_PAGE	1U	/**< Bad block pattern
@@ -172,6 +186,8 @@ void XNandPsu_InitBbtDesc(XNandPsu *InstancePtr);
 
 s32 XNandPsu_IsBlockBad(XNandPsu *InstancePtr, u32 Block);
 
+u32 XNandPsu_NextGoodBlock(XNandPsu *InstancePtr, u32 Block);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,165 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xospipsv_readcache.c
+* @addtogroup Overview
+* @{
+*
+* This file implements the OSPIPSV transport of the flash read cache. See
+* xospipsv_readcache.h for a description of the read cache.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.6       10/19/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xospipsv_readcache.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 XOspiPsv_RcStart(void *CallBackRef, u32 Address, u8 *BfrPtr,
+			    u32 ByteCount);
+static u32 XOspiPsv_RcIsDone(void *CallBackRef);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ *
+ * Initializes a read cache on top of an initialized OSPIPSV instance. The
+ * flash must already be selected and set up for the configured read command.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	OspiPsvPtr is a pointer to the XOspiPsv instance.
+ * @param	CfgPtr is a pointer to the read command and flash geometry.
+ * @param	LineMem is DMA capable memory for the lines, aligned to
+ *		XOSPIPSV_RC_LINE_ALIGN bytes.
+ * @param	LineMemSize is the size of LineMem in bytes. Up to
+ *		XOSPIPSV_RC_MAX_LINES lines of CfgPtr->LineSize bytes are used.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if the configuration is not supported or
+ *		  the controller is not in IDAC mode.
+ *
+ * @note	Read-ahead is enabled and reads of at least one line bypass the
+ *		lines by default, see XOspiPsv_ReadCacheSetReadAhead().
+ *
+ ******************************************************************************/
+u32 XOspiPsv_ReadCacheInit(XOspiPsv_ReadCache *CachePtr,
+			   XOspiPsv *OspiPsvPtr,
+			   const XOspiPsv_ReadCacheCfg *CfgPtr,
+			   u8 *LineMem, u32 LineMemSize)
+{
+	XFlashRc_Transport Xport;
+	u32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(OspiPsvPtr != NULL);
+	Xil_AssertNonvoid(OspiPsvPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+
+	if (((CfgPtr->AddrBytes != 3U) && (CfgPtr->AddrBytes != 4U)) ||
+	    (OspiPsvPtr->Config.ConnectionMode ==
+	     XOSPIPSV_CONNECTION_MODE_STACKED) ||
+	    (OspiPsvPtr->OpMode != XOSPIPSV_IDAC_MODE)) {
+		Status = (u32)XST_INVALID_PARAM;
+		goto END;
+	}
+
+	CachePtr->OspiPsvPtr = OspiPsvPtr;
+	CachePtr->Cfg = *CfgPtr;
+
+	Xport.Start = XOspiPsv_RcStart;
+	Xport.IsDone = XOspiPsv_RcIsDone;
+	Xport.CallBackRef = CachePtr;
+	Xport.DmaBytesMax = XOSPIPSV_RC_DMA_BYTES_MAX;
+	Status = XFlashRc_Init(&CachePtr->Rc, &Xport, CfgPtr->FlashSize,
+			       CfgPtr->LineSize, LineMem, LineMemSize);
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Builds the read message and starts the transfer. This is the Start
+ * function of the transport.
+ *
+ * @param	CallBackRef is a pointer to the read cache instance.
+ * @param	Address is the linear flash address to read from.
+ * @param	BfrPtr is the word aligned buffer to fill in.
+ * @param	ByteCount is the number of bytes to read, a multiple of 4.
+ *
+ * @return	Status returned by XOspiPsv_StartDmaTransfer().
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XOspiPsv_RcStart(void *CallBackRef, u32 Address, u8 *BfrPtr,
+			    u32 ByteCount)
+{
+	XOspiPsv_ReadCache *CachePtr = (XOspiPsv_ReadCache *)CallBackRef;
+	const XOspiPsv_ReadCacheCfg *CfgPtr = &CachePtr->Cfg;
+	XOspiPsv_Msg *MsgPtr = &CachePtr->Msg;
+
+	/* The driver updates the message, so it is rebuilt for each read */
+	MsgPtr->Opcode = CfgPtr->ReadCmd;
+	MsgPtr->Addrsize = CfgPtr->AddrBytes;
+	MsgPtr->Addrvalid = 1U;
+	MsgPtr->Addr = Address;
+	MsgPtr->TxBfrPtr = NULL;
+	MsgPtr->RxBfrPtr = BfrPtr;
+	MsgPtr->ByteCount = ByteCount;
+	MsgPtr->Flags = XOSPIPSV_MSG_FLAG_RX;
+	MsgPtr->Proto = CfgPtr->Proto;
+	MsgPtr->Dummy = CfgPtr->Dummy + CachePtr->OspiPsvPtr->Extra_DummyCycle;
+	MsgPtr->IsDDROpCode = CfgPtr->IsDDROpCode;
+	MsgPtr->Xfer64bit = 0U;
+	if (CachePtr->OspiPsvPtr->DualByteOpcodeEn != 0U) {
+		MsgPtr->ExtendedOpcode = (u8)(~MsgPtr->Opcode);
+	}
+
+	return XOspiPsv_StartDmaTransfer(CachePtr->OspiPsvPtr, MsgPtr);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Checks whether the transfer in progress has completed. This is the IsDone
+ * function of the transport.
+ *
+ * @param	CallBackRef is a pointer to the read cache instance.
+ *
+ * @return	Status returned by XOspiPsv_CheckDmaDone().
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XOspiPsv_RcIsDone(void *CallBackRef)
+{
+	const XOspiPsv_ReadCache *CachePtr =
+		(const XOspiPsv_ReadCache *)CallBackRef;
+
+	return XOspiPsv_CheckDmaDone(CachePtr->OspiPsvPtr);
+}
+/** @} */
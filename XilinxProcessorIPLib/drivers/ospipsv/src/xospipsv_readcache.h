@@ -0,0 +1,233 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ *
+ * @file xospipsv_readcache.h
+ * @addtogroup Overview
+ * @{
+ *
+ * This is the header file for the flash read cache layered on top of the
+ * OSPIPSV driver. The lines, read-ahead and streaming are implemented by the
+ * flash_readcache library, see xflash_readcache.h. This layer supplies the
+ * transport, which issues the configured read command with
+ * XOspiPsv_StartDmaTransfer() and polls XOspiPsv_CheckDmaDone().
+ *
+ * The read command, address width, dummy cycles and protocol are taken from
+ * the configuration, so any read command supported by the flash can be used
+ * in SDR or DDR mode. The controller must be in IDAC mode since transfers
+ * use XOspiPsv_StartDmaTransfer(). Dual stacked connections and reads
+ * crossing a die boundary of multi die flashes are not handled; use the
+ * driver directly for those.
+ *
+ * The cache is not coherent with writes to the flash. Call
+ * XOspiPsv_ReadCacheSync() before using the OSPIPSV instance directly and
+ * XOspiPsv_ReadCacheInvalidate() after programming or erasing flash. The
+ * statistics counters are in the Rc member of the instance.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.6       10/19/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#ifndef XOSPIPSV_READCACHE_H_		/**< prevent circular inclusions */
+#define XOSPIPSV_READCACHE_H_		/**< by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xospipsv.h"
+#include "xflash_readcache.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XOSPIPSV_RC_MAX_LINES	XFLASHRC_MAX_LINES /**< Maximum lines */
+#define XOSPIPSV_RC_LINE_ALIGN	XFLASHRC_LINE_ALIGN /**< Line alignment */
+#define XOSPIPSV_RC_NONE	XFLASHRC_NONE	/**< No line / no address */
+#define XOSPIPSV_RC_DMA_BYTES_MAX	0x10000000U	/**< Maximum bytes of
+							  *  one DMA transfer */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Read command and flash geometry used by the read cache.
+ */
+typedef struct {
+	u32 FlashSize;		/**< Linear flash size in bytes */
+	u32 LineSize;		/**< Line size and read-ahead window in
+				  *  bytes, a power of 2 and a multiple of
+				  *  XOSPIPSV_RC_LINE_ALIGN */
+	u8 ReadCmd;		/**< Read command opcode */
+	u8 AddrBytes;		/**< Number of address bytes, 3 or 4 */
+	u8 Dummy;		/**< Dummy cycles of the read command, the
+				  *  instance's extra dummy cycles are
+				  *  added */
+	u8 Proto;		/**< XOSPIPSV_READ_* protocol */
+	u8 IsDDROpCode;		/**< 1 if the opcode is a DDR command */
+} XOspiPsv_ReadCacheCfg;
+
+/**
+ * The read cache instance.
+ */
+typedef struct {
+	XFlashRc Rc;		/**< Lines, stream state and statistics */
+	XOspiPsv *OspiPsvPtr;	/**< Driver instance used for transfers */
+	XOspiPsv_ReadCacheCfg Cfg;	/**< Read command and geometry */
+	XOspiPsv_Msg Msg;	/**< Read message */
+} XOspiPsv_ReadCache;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/****************************************************************************/
+/**
+*
+* Configures read-ahead and the size from which reads bypass the lines, see
+* XFlashRc_SetReadAhead().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Enable is TRUE to enable read-ahead, FALSE otherwise.
+* @param	DirectMin is the minimum read size which is read straight into
+*		the caller's buffer, 0 to always read through the lines.
+*
+* @return	None.
+*
+* @note		C-Style signature:
+*		void XOspiPsv_ReadCacheSetReadAhead(
+*				XOspiPsv_ReadCache *CachePtr, u32 Enable,
+*				u32 DirectMin)
+*
+*****************************************************************************/
+#define XOspiPsv_ReadCacheSetReadAhead(CachePtr, Enable, DirectMin) \
+	XFlashRc_SetReadAhead(&(CachePtr)->Rc, (Enable), (DirectMin))
+
+/****************************************************************************/
+/**
+*
+* Reads from flash through the read cache, see XFlashRc_Read().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Address is the linear flash address to read from.
+* @param	ReadBfrPtr is the buffer to fill in.
+* @param	ByteCount is the number of bytes to read.
+*
+* @return	XST_SUCCESS, XST_DEVICE_BUSY or XST_FAILURE.
+*
+* @note		C-Style signature:
+*		u32 XOspiPsv_ReadCacheRead(XOspiPsv_ReadCache *CachePtr,
+*					   u32 Address, u8 *ReadBfrPtr,
+*					   u32 ByteCount)
+*
+*****************************************************************************/
+#define XOspiPsv_ReadCacheRead(CachePtr, Address, ReadBfrPtr, ByteCount) \
+	XFlashRc_Read(&(CachePtr)->Rc, (Address), (ReadBfrPtr), (ByteCount))
+
+/****************************************************************************/
+/**
+*
+* Waits for a read-ahead transfer in progress, see XFlashRc_Sync(). Call
+* this before using the OSPIPSV instance directly.
+*
+* @param	CachePtr is a pointer to the read cache instance.
+*
+* @return	XST_SUCCESS or XST_DEVICE_BUSY if a stream is in progress.
+*
+* @note		C-Style signature:
+*		u32 XOspiPsv_ReadCacheSync(XOspiPsv_ReadCache *CachePtr)
+*
+*****************************************************************************/
+#define XOspiPsv_ReadCacheSync(CachePtr) \
+	XFlashRc_Sync(&(CachePtr)->Rc)
+
+/****************************************************************************/
+/**
+*
+* Drops the lines overlapping a programmed or erased flash region, see
+* XFlashRc_Invalidate().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Address is the linear flash address of the region.
+* @param	ByteCount is the size of the region in bytes.
+*
+* @return	XST_SUCCESS always.
+*
+* @note		C-Style signature:
+*		u32 XOspiPsv_ReadCacheInvalidate(XOspiPsv_ReadCache *CachePtr,
+*						 u32 Address, u32 ByteCount)
+*
+*****************************************************************************/
+#define XOspiPsv_ReadCacheInvalidate(CachePtr, Address, ByteCount) \
+	XFlashRc_Invalidate(&(CachePtr)->Rc, (Address), (ByteCount))
+
+/****************************************************************************/
+/**
+*
+* Starts reading a flash region into two buffers in turn, see
+* XFlashRc_StreamStart().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Address is the word aligned linear flash address to read from.
+* @param	ByteCount is the number of bytes to read.
+* @param	Bfr0Ptr is the first word aligned buffer of ChunkSize bytes.
+* @param	Bfr1Ptr is the second word aligned buffer of ChunkSize bytes.
+* @param	ChunkSize is the size of each chunk, a multiple of 4.
+*
+* @return	XST_SUCCESS, XST_DEVICE_BUSY or XST_FAILURE.
+*
+* @note		C-Style signature:
+*		u32 XOspiPsv_ReadCacheStreamStart(XOspiPsv_ReadCache *CachePtr,
+*				u32 Address, u32 ByteCount, u8 *Bfr0Ptr,
+*				u8 *Bfr1Ptr, u32 ChunkSize)
+*
+*****************************************************************************/
+#define XOspiPsv_ReadCacheStreamStart(CachePtr, Address, ByteCount, \
+				      Bfr0Ptr, Bfr1Ptr, ChunkSize) \
+	XFlashRc_StreamStart(&(CachePtr)->Rc, (Address), (ByteCount), \
+			     (Bfr0Ptr), (Bfr1Ptr), (ChunkSize))
+
+/****************************************************************************/
+/**
+*
+* Returns the completed stream chunk and starts the next one, see
+* XFlashRc_StreamNext().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	BfrPtr is filled with the buffer holding the chunk.
+* @param	ByteCountPtr is filled with the number of bytes in the chunk.
+*
+* @return	XST_SUCCESS, XST_NO_DATA or XST_FAILURE.
+*
+* @note		C-Style signature:
+*		u32 XOspiPsv_ReadCacheStreamNext(XOspiPsv_ReadCache *CachePtr,
+*						 u8 **BfrPtr,
+*						 u32 *ByteCountPtr)
+*
+*****************************************************************************/
+#define XOspiPsv_ReadCacheStreamNext(CachePtr, BfrPtr, ByteCountPtr) \
+	XFlashRc_StreamNext(&(CachePtr)->Rc, (BfrPtr), (ByteCountPtr))
+
+/************************** Function Prototypes ******************************/
+
+u32 XOspiPsv_ReadCacheInit(XOspiPsv_ReadCache *CachePtr,
+			   XOspiPsv *OspiPsvPtr,
+			   const XOspiPsv_ReadCacheCfg *CfgPtr,
+			   u8 *LineMem, u32 LineMemSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XOSPIPSV_READCACHE_H_ */
+/** @} */
@@ -0,0 +1,194 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xqspipsu_readcache.c
+* @addtogroup Overview
+* @{
+*
+* This file implements the QSPIPSU transport of the flash read cache. See
+* xqspipsu_readcache.h for a description of the read cache.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who Date     Changes
+* ----- --- -------- -----------------------------------------------
+* 1.15      10/19/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu_readcache.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+static u32 XQspiPsu_RcStart(void *CallBackRef, u32 Address, u8 *BfrPtr,
+			    u32 ByteCount);
+static u32 XQspiPsu_RcIsDone(void *CallBackRef);
+
+/************************** Variable Definitions *****************************/
+
+/*****************************************************************************/
+/**
+ *
+ * Initializes a read cache on top of an initialized QSPIPSU instance. The
+ * flash must already be selected and set up for the configured read command.
+ *
+ * @param	CachePtr is a pointer to the read cache instance.
+ * @param	QspiPsuPtr is a pointer to the XQspiPsu instance.
+ * @param	CfgPtr is a pointer to the read command and flash geometry.
+ * @param	LineMem is DMA capable memory for the lines, aligned to
+ *		XQSPIPSU_RC_LINE_ALIGN bytes.
+ * @param	LineMemSize is the size of LineMem in bytes. Up to
+ *		XQSPIPSU_RC_MAX_LINES lines of CfgPtr->LineSize bytes are used.
+ *
+ * @return
+ *		- XST_SUCCESS if successful.
+ *		- XST_INVALID_PARAM if the configuration is not supported.
+ *
+ * @note	Read-ahead is enabled and reads of at least one line bypass the
+ *		lines by default, see XQspiPsu_ReadCacheSetReadAhead().
+ *
+ ******************************************************************************/
+s32 XQspiPsu_ReadCacheInit(XQspiPsu_ReadCache *CachePtr,
+			   XQspiPsu *QspiPsuPtr,
+			   const XQspiPsu_ReadCacheCfg *CfgPtr,
+			   u8 *LineMem, u32 LineMemSize)
+{
+	XFlashRc_Transport Xport;
+	s32 Status;
+
+	Xil_AssertNonvoid(CachePtr != NULL);
+	Xil_AssertNonvoid(QspiPsuPtr != NULL);
+	Xil_AssertNonvoid(QspiPsuPtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(CfgPtr != NULL);
+
+	if (((CfgPtr->AddrBytes != 3U) && (CfgPtr->AddrBytes != 4U)) ||
+	    (QspiPsuPtr->Config.ConnectionMode ==
+	     XQSPIPSU_CONNECTION_MODE_STACKED)) {
+		Status = (s32)XST_INVALID_PARAM;
+		goto END;
+	}
+
+	CachePtr->QspiPsuPtr = QspiPsuPtr;
+	CachePtr->Cfg = *CfgPtr;
+
+	Xport.Start = XQspiPsu_RcStart;
+	Xport.IsDone = XQspiPsu_RcIsDone;
+	Xport.CallBackRef = CachePtr;
+	Xport.DmaBytesMax = XQSPIPSU_DMA_BYTES_MAX;
+	Status = (s32)XFlashRc_Init(&CachePtr->Rc, &Xport, CfgPtr->FlashSize,
+				    CfgPtr->LineSize, LineMem, LineMemSize);
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Builds the command, dummy and data messages of a read and starts the
+ * transfer. This is the Start function of the transport.
+ *
+ * @param	CallBackRef is a pointer to the read cache instance.
+ * @param	Address is the linear flash address to read from.
+ * @param	BfrPtr is the word aligned buffer to fill in.
+ * @param	ByteCount is the number of bytes to read, a multiple of 4.
+ *
+ * @return	Status returned by XQspiPsu_StartDmaTransfer().
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XQspiPsu_RcStart(void *CallBackRef, u32 Address, u8 *BfrPtr,
+			    u32 ByteCount)
+{
+	XQspiPsu_ReadCache *CachePtr = (XQspiPsu_ReadCache *)CallBackRef;
+	const XQspiPsu_ReadCacheCfg *CfgPtr = &CachePtr->Cfg;
+	XQspiPsu_Msg *MsgPtr = CachePtr->Msg;
+	u32 RealAddr = Address;
+	u32 CmdLen = 0U;
+	u32 MsgCnt = 0U;
+
+	if (CachePtr->QspiPsuPtr->Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		RealAddr = Address >> 1U;
+	}
+
+	CachePtr->CmdBfr[CmdLen] = CfgPtr->ReadCmd;
+	CmdLen++;
+	if (CfgPtr->AddrBytes == 4U) {
+		CachePtr->CmdBfr[CmdLen] = (u8)(RealAddr >> 24U);
+		CmdLen++;
+	}
+	CachePtr->CmdBfr[CmdLen] = (u8)(RealAddr >> 16U);
+	CachePtr->CmdBfr[CmdLen + 1U] = (u8)(RealAddr >> 8U);
+	CachePtr->CmdBfr[CmdLen + 2U] = (u8)RealAddr;
+	CmdLen += 3U;
+
+	MsgPtr[MsgCnt].TxBfrPtr = CachePtr->CmdBfr;
+	MsgPtr[MsgCnt].RxBfrPtr = NULL;
+	MsgPtr[MsgCnt].ByteCount = CmdLen;
+	MsgPtr[MsgCnt].BusWidth = XQSPIPSU_SELECT_MODE_SPI;
+	MsgPtr[MsgCnt].Flags = XQSPIPSU_MSG_FLAG_TX;
+	MsgCnt++;
+
+	/* It is recommended to have a separate entry for dummy */
+	if (CfgPtr->DummyClocks != 0U) {
+		MsgPtr[MsgCnt].TxBfrPtr = NULL;
+		MsgPtr[MsgCnt].RxBfrPtr = NULL;
+		MsgPtr[MsgCnt].ByteCount = CfgPtr->DummyClocks;
+		MsgPtr[MsgCnt].BusWidth = CfgPtr->BusWidth;
+		MsgPtr[MsgCnt].Flags = 0U;
+		MsgCnt++;
+	}
+
+	MsgPtr[MsgCnt].TxBfrPtr = NULL;
+	MsgPtr[MsgCnt].RxBfrPtr = BfrPtr;
+	MsgPtr[MsgCnt].ByteCount = ByteCount;
+	MsgPtr[MsgCnt].BusWidth = CfgPtr->BusWidth;
+	MsgPtr[MsgCnt].Flags = XQSPIPSU_MSG_FLAG_RX;
+	if (CachePtr->QspiPsuPtr->Config.ConnectionMode ==
+	    XQSPIPSU_CONNECTION_MODE_PARALLEL) {
+		MsgPtr[MsgCnt].Flags |= XQSPIPSU_MSG_FLAG_STRIPE;
+	}
+	MsgCnt++;
+
+	return (u32)XQspiPsu_StartDmaTransfer(CachePtr->QspiPsuPtr, MsgPtr,
+					      MsgCnt);
+}
+
+/*****************************************************************************/
+/**
+ *
+ * Checks whether the transfer in progress has completed. This is the IsDone
+ * function of the transport.
+ *
+ * @param	CallBackRef is a pointer to the read cache instance.
+ *
+ * @return	Status returned by XQspiPsu_CheckDmaDone().
+ *
+ * @note	None.
+ *
+ ******************************************************************************/
+static u32 XQspiPsu_RcIsDone(void *CallBackRef)
+{
+	const XQspiPsu_ReadCache *CachePtr =
+		(const XQspiPsu_ReadCache *)CallBackRef;
+
+	return (u32)XQspiPsu_CheckDmaDone(CachePtr->QspiPsuPtr);
+}
+/** @} */
@@ -0,0 +1,231 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+
+/*****************************************************************************/
+/**
+ *
+ * @file xqspipsu_readcache.h
+ * @addtogroup Overview
+ * @{
+ *
+ * This is the header file for the flash read cache layered on top of the
+ * QSPIPSU driver. The lines, read-ahead and streaming are implemented by the
+ * flash_readcache library, see xflash_readcache.h. This layer supplies the
+ * transport, which issues the configured read command with
+ * XQspiPsu_StartDmaTransfer() and polls XQspiPsu_CheckDmaDone().
+ *
+ * The read command, address width, dummy clocks and bus width are taken from
+ * the configuration, so any read command supported by the flash can be used.
+ * Single and dual parallel connections are supported. In dual parallel mode
+ * the flash address sent is half of the linear address and data is striped.
+ * Dual stacked connections and reads crossing a die boundary of multi die
+ * flashes are not handled; use the driver directly for those.
+ *
+ * The cache is not coherent with writes to the flash. Call
+ * XQspiPsu_ReadCacheSync() before using the QSPIPSU instance directly and
+ * XQspiPsu_ReadCacheInvalidate() after programming or erasing flash. The
+ * statistics counters are in the Rc member of the instance.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who Date     Changes
+ * ----- --- -------- -----------------------------------------------
+ * 1.15      10/19/26 First release
+ *
+ * </pre>
+ *
+ ******************************************************************************/
+
+#ifndef XQSPIPSU_READCACHE_H_		/**< prevent circular inclusions */
+#define XQSPIPSU_READCACHE_H_		/**< by using protection macros */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+
+#include "xqspipsu.h"
+#include "xflash_readcache.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XQSPIPSU_RC_MAX_LINES	XFLASHRC_MAX_LINES /**< Maximum lines */
+#define XQSPIPSU_RC_LINE_ALIGN	XFLASHRC_LINE_ALIGN /**< Line alignment */
+#define XQSPIPSU_RC_NONE	XFLASHRC_NONE	/**< No line / no address */
+
+/**************************** Type Definitions *******************************/
+
+/**
+ * Read command and flash geometry used by the read cache.
+ */
+typedef struct {
+	u32 FlashSize;		/**< Linear flash size in bytes */
+	u32 LineSize;		/**< Line size and read-ahead window in
+				  *  bytes, a power of 2 and a multiple of
+				  *  XQSPIPSU_RC_LINE_ALIGN */
+	u8 ReadCmd;		/**< Read command opcode */
+	u8 AddrBytes;		/**< Number of address bytes, 3 or 4 */
+	u8 DummyClocks;		/**< Dummy clocks after the address */
+	u8 BusWidth;		/**< XQSPIPSU_SELECT_MODE_* of the data and
+				  *  dummy phases */
+} XQspiPsu_ReadCacheCfg;
+
+/**
+ * The read cache instance.
+ */
+typedef struct {
+	XFlashRc Rc;		/**< Lines, stream state and statistics */
+	XQspiPsu *QspiPsuPtr;	/**< Driver instance used for transfers */
+	XQspiPsu_ReadCacheCfg Cfg;	/**< Read command and geometry */
+	XQspiPsu_Msg Msg[3];	/**< Command, dummy and data messages */
+	u8 CmdBfr[8];		/**< Command and address bytes */
+} XQspiPsu_ReadCache;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/****************************************************************************/
+/**
+*
+* Configures read-ahead and the size from which reads bypass the lines, see
+* XFlashRc_SetReadAhead().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Enable is TRUE to enable read-ahead, FALSE otherwise.
+* @param	DirectMin is the minimum read size which is read straight into
+*		the caller's buffer, 0 to always read through the lines.
+*
+* @return	None.
+*
+* @note		C-Style signature:
+*		void XQspiPsu_ReadCacheSetReadAhead(
+*				XQspiPsu_ReadCache *CachePtr, u32 Enable,
+*				u32 DirectMin)
+*
+*****************************************************************************/
+#define XQspiPsu_ReadCacheSetReadAhead(CachePtr, Enable, DirectMin) \
+	XFlashRc_SetReadAhead(&(CachePtr)->Rc, (Enable), (DirectMin))
+
+/****************************************************************************/
+/**
+*
+* Reads from flash through the read cache, see XFlashRc_Read().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Address is the linear flash address to read from.
+* @param	ReadBfrPtr is the buffer to fill in.
+* @param	ByteCount is the number of bytes to read.
+*
+* @return	XST_SUCCESS, XST_DEVICE_BUSY or XST_FAILURE.
+*
+* @note		C-Style signature:
+*		s32 XQspiPsu_ReadCacheRead(XQspiPsu_ReadCache *CachePtr,
+*					   u32 Address, u8 *ReadBfrPtr,
+*					   u32 ByteCount)
+*
+*****************************************************************************/
+#define XQspiPsu_ReadCacheRead(CachePtr, Address, ReadBfrPtr, ByteCount) \
+	((s32)XFlashRc_Read(&(CachePtr)->Rc, (Address), (ReadBfrPtr), \
+			    (ByteCount)))
+
+/****************************************************************************/
+/**
+*
+* Waits for a read-ahead transfer in progress, see XFlashRc_Sync(). Call
+* this before using the QSPIPSU instance directly.
+*
+* @param	CachePtr is a pointer to the read cache instance.
+*
+* @return	XST_SUCCESS or XST_DEVICE_BUSY if a stream is in progress.
+*
+* @note		C-Style signature:
+*		s32 XQspiPsu_ReadCacheSync(XQspiPsu_ReadCache *CachePtr)
+*
+*****************************************************************************/
+#define XQspiPsu_ReadCacheSync(CachePtr) \
+	((s32)XFlashRc_Sync(&(CachePtr)->Rc))
+
+/****************************************************************************/
+/**
+*
+* Drops the lines overlapping a programmed or erased flash region, see
+* XFlashRc_Invalidate().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Address is the linear flash address of the region.
+* @param	ByteCount is the size of the region in bytes.
+*
+* @return	XST_SUCCESS always.
+*
+* @note		C-Style signature:
+*		s32 XQspiPsu_ReadCacheInvalidate(XQspiPsu_ReadCache *CachePtr,
+*						 u32 Address, u32 ByteCount)
+*
+*****************************************************************************/
+#define XQspiPsu_ReadCacheInvalidate(CachePtr, Address, ByteCount) \
+	((s32)XFlashRc_Invalidate(&(CachePtr)->Rc, (Address), (ByteCount)))
+
+/****************************************************************************/
+/**
+*
+* Starts reading a flash region into two buffers in turn, see
+* XFlashRc_StreamStart().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	Address is the word aligned linear flash address to read from.
+* @param	ByteCount is the number of bytes to read.
+* @param	Bfr0Ptr is the first word aligned buffer of ChunkSize bytes.
+* @param	Bfr1Ptr is the second word aligned buffer of ChunkSize bytes.
+* @param	ChunkSize is the size of each chunk, a multiple of 4.
+*
+* @return	XST_SUCCESS, XST_DEVICE_BUSY or XST_FAILURE.
+*
+* @note		C-Style signature:
+*		s32 XQspiPsu_ReadCacheStreamStart(XQspiPsu_ReadCache *CachePtr,
+*				u32 Address, u32 ByteCount, u8 *Bfr0Ptr,
+*				u8 *Bfr1Ptr, u32 ChunkSize)
+*
+*****************************************************************************/
+#define XQspiPsu_ReadCacheStreamStart(CachePtr, Address, ByteCount, \
+				      Bfr0Ptr, Bfr1Ptr, ChunkSize) \
+	((s32)XFlashRc_StreamStart(&(CachePtr)->Rc, (Address), (ByteCount), \
+				   (Bfr0Ptr), (Bfr1Ptr), (ChunkSize)))
+
+/****************************************************************************/
+/**
+*
+* Returns the completed stream chunk and starts the next one, see
+* XFlashRc_StreamNext().
+*
+* @param	CachePtr is a pointer to the read cache instance.
+* @param	BfrPtr is filled with the buffer holding the chunk.
+* @param	ByteCountPtr is filled with the number of bytes in the chunk.
+*
+* @return	XST_SUCCESS, XST_NO_DATA or XST_FAILURE.
+*
+* @note		C-Style signature:
+*		s32 XQspiPsu_ReadCacheStreamNext(XQspiPsu_ReadCache *CachePtr,
+*						 u8 **BfrPtr,
+*						 u32 *ByteCountPtr)
+*
+*****************************************************************************/
+#define XQspiPsu_ReadCacheStreamNext(CachePtr, BfrPtr, ByteCountPtr) \
+	((s32)XFlashRc_StreamNext(&(CachePtr)->Rc, (BfrPtr), (ByteCountPtr)))
+
+/************************** Function Prototypes ******************************/
+
+s32 XQspiPsu_ReadCacheInit(XQspiPsu_ReadCache *CachePtr,
+			   XQspiPsu *QspiPsuPtr,
+			   const XQspiPsu_ReadCacheCfg *CfgPtr,
+			   u8 *LineMem, u32 LineMemSize);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XQSPIPSU_READCACHE_H_ */
+/** @} */
@@ -8,6 +8,33 @@
 #include "xsdfec.h"
 
 /************************** Function Implementation *************************/
+// Ranges overlap
+static int XSdFecOverlap(u32 Offset0, u32 Size0, u32 Offset1, u32 Size1) {
+  return (Offset0 < Offset1 + Size1) && (Offset1 < Offset0 + Size0);
+}
+
+// Mark CodeId and every resident code using any of the specified table words as not resident
+static void XSdFecLdpcInvalidate(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 SCSize, u32 LAOffset, u32 LASize,
+                                 u32 QCOffset, u32 QCSize) {
+  InstancePtr->LdpcResident[CodeId] = 0;
+  for (u32 idx = 0; idx < 128; idx++) {
+    if (InstancePtr->LdpcResident[idx] &&
+        (XSdFecOverlap(SCOffset, SCSize, InstancePtr->SCOffset[idx], InstancePtr->SCSize[idx]) ||
+         XSdFecOverlap(LAOffset, LASize, InstancePtr->LAOffset[idx], InstancePtr->LASize[idx]) ||
+         XSdFecOverlap(QCOffset, QCSize, InstancePtr->QCOffset[idx], InstancePtr->QCSize[idx]))) {
+      InstancePtr->LdpcResident[idx] = 0;
+    }
+  }
+}
+
+// Write NumData consecutive words starting at register address Addr
+static void XSdFecWriteBlock(UINTPTR BaseAddress, u32 Addr, const u32 *DataArrayPtr, u32 NumData) {
+  u32 idx;
+  for (idx = 0; idx < NumData; idx++) {
+    XSdFecWriteReg(BaseAddress, Addr + idx*4, DataArrayPtr[idx]);
+  }
+}
+
 int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
     Xil_AssertNonvoid(InstancePtr != NULL);
     Xil_AssertNonvoid(ConfigPtr != NULL);
@@ -20,6 +47,9 @@ int XSdFecCfgInitialize(XSdFec *InstancePtr, XSdFec_Config *ConfigPtr) {
       u32 wdata = ConfigPtr->Initialization[i+1];
       XSdFecWriteReg(InstancePtr->BaseAddress, addr, wdata);
     }
+    for (int i=0;i<128;i++) {
+      InstancePtr->LdpcResident[i] = 0;
+    }
     InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
     return XST_SUCCESS;
@@ -31,39 +61,29 @@ void XSdFecAddLdpcParams(XSdFec *InstancePtr, u32 CodeId, u32 SCOffset, u32 LAOf
   Xil_AssertVoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
   Xil_AssertVoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
 
-  u32 wr_data = 0;
+  u32 Regs[4];
   if (CodeId < 128) {
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
-    XSdFecWrite_LDPC_CODE_REG0_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG1_PSIZE_MASK       & (ParamsPtr->PSize      << XSDFEC_LDPC_CODE_REG1_PSIZE_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG1_NO_PACKING_MASK  & (ParamsPtr->NoPacking  << XSDFEC_LDPC_CODE_REG1_NO_PACKING_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG1_NM_MASK          & (ParamsPtr->NM         << XSDFEC_LDPC_CODE_REG1_NM_LSB));
-    XSdFecWrite_LDPC_CODE_REG1_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NLAYERS_MASK               & (ParamsPtr->NLayers        << XSDFEC_LDPC_CODE_REG2_NLAYERS_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NMQC_MASK                  & (ParamsPtr->NMQC           << XSDFEC_LDPC_CODE_REG2_NMQC_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NORM_TYPE_MASK             & (ParamsPtr->NormType       << XSDFEC_LDPC_CODE_REG2_NORM_TYPE_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_MASK            & (ParamsPtr->SpecialQC      << XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_MASK & (ParamsPtr->NoFinalParity  << XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_MASK          & (ParamsPtr->MaxSchedule    << XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_LSB));
-    XSdFecWrite_LDPC_CODE_REG2_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
-    wr_data = 0;
-    wr_data |= (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK & (SCOffset << XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB));
-    wr_data |= (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
-    XSdFecWrite_LDPC_CODE_REG3_Words(InstancePtr->BaseAddress,CodeId,&wr_data,1);
+    u32 SCSize, LASize, QCSize;
+    XSdFecShareTableSize(ParamsPtr, &SCSize, &LASize, &QCSize);
+    XSdFecLdpcInvalidate(InstancePtr, CodeId, SCOffset, SCSize, LAOffset, LASize, QCOffset, QCSize);
+
+    XSdFecLdpcCodeRegs(ParamsPtr, SCOffset, LAOffset, QCOffset, Regs);
+    XSdFecWrite_LDPC_CODE_REG0_Words(InstancePtr->BaseAddress,CodeId,&Regs[0],1);
+    XSdFecWrite_LDPC_CODE_REG1_Words(InstancePtr->BaseAddress,CodeId,&Regs[1],1);
+    XSdFecWrite_LDPC_CODE_REG2_Words(InstancePtr->BaseAddress,CodeId,&Regs[2],1);
+    XSdFecWrite_LDPC_CODE_REG3_Words(InstancePtr->BaseAddress,CodeId,&Regs[3],1);
 
     XSdFecWrite_LDPC_SC_TABLE_Words(InstancePtr->BaseAddress,SCOffset  , ParamsPtr->SCTable,(ParamsPtr->NLayers+3)>>2); // Scale is packed, 4 per reg
     XSdFecWrite_LDPC_LA_TABLE_Words(InstancePtr->BaseAddress,LAOffset*4, ParamsPtr->LATable,ParamsPtr->NLayers); // Further 4x applied to offset in function
     XSdFecWrite_LDPC_QC_TABLE_Words(InstancePtr->BaseAddress,QCOffset*4, ParamsPtr->QCTable,ParamsPtr->NQC);
 
-    // Store offsets
+    // Store offsets and sizes
     InstancePtr->SCOffset[CodeId] = SCOffset;
     InstancePtr->LAOffset[CodeId] = LAOffset;
     InstancePtr->QCOffset[CodeId] = QCOffset;
+    InstancePtr->SCSize[CodeId]   = SCSize;
+    InstancePtr->LASize[CodeId]   = LASize;
+    InstancePtr->QCSize[CodeId]   = QCSize;
   }
 }
 
@@ -89,6 +109,71 @@ void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* Para
   XSdFecSet_TURBO_SCALE_FACTOR(InstancePtr->BaseAddress,ParamsPtr->Scale);
 }
 
+int XSdFecLdpcImageLoad(XSdFec *InstancePtr, const u32* ImagePtr, u32 ImageWords, u32* NumLoadedPtr) {
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(ImagePtr    != NULL);
+  Xil_AssertNonvoid(InstancePtr->IsReady  == XIL_COMPONENT_IS_READY);
+  Xil_AssertNonvoid(InstancePtr->Standard == XSDFEC_STANDARD_OTHER);
+
+  u32 NumLoaded = 0;
+  if (NumLoadedPtr) {
+    *NumLoadedPtr = 0;
+  }
+  if (XSdFecLdpcImageCheck(ImagePtr, ImageWords) != XST_SUCCESS) {
+    return XST_FAILURE;
+  }
+
+  const XSdFecLdpcImageHdr  *HdrPtr  = (const XSdFecLdpcImageHdr *)ImagePtr;
+  const XSdFecLdpcImageCode *CodePtr = (const XSdFecLdpcImageCode *)(ImagePtr + XSDFEC_LDPC_IMAGE_HDR_WORDS);
+  const u32 *SCPtr = ImagePtr + XSDFEC_LDPC_IMAGE_HDR_WORDS + HdrPtr->NumCodes*XSDFEC_LDPC_IMAGE_CODE_WORDS;
+  const u32 *LAPtr = SCPtr + HdrPtr->SCWords;
+  const u32 *QCPtr = LAPtr + HdrPtr->LAWords;
+
+  for (u32 idx = 0; idx < HdrPtr->NumCodes; idx++) {
+    u32 CodeId   = CodePtr[idx].CodeId;
+    u32 SCOffset = (CodePtr[idx].Reg[3] & XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB;
+    u32 LAOffset = (CodePtr[idx].Reg[3] & XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB;
+    u32 QCOffset = (CodePtr[idx].Reg[3] & XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB;
+    // The checksum covers the code registers, which hold the offsets, and all table words of the code
+    if (InstancePtr->LdpcResident[CodeId] && InstancePtr->LdpcSum[CodeId] == CodePtr[idx].Sum) {
+      continue;
+    }
+    XSdFecLdpcInvalidate(InstancePtr, CodeId, SCOffset, CodePtr[idx].SCSize, LAOffset, CodePtr[idx].LASize,
+                         QCOffset, CodePtr[idx].QCSize);
+
+    // Table words are consecutive and the four code registers of a code are adjacent, see xsdfec_hw.h
+    XSdFecWriteBlock(InstancePtr->BaseAddress, XSDFEC_LDPC_SC_TABLE_ADDR_BASE + SCOffset*XSDFEC_LDPC_SC_TABLE_STEP,
+                     &SCPtr[SCOffset], CodePtr[idx].SCSize);
+    XSdFecWriteBlock(InstancePtr->BaseAddress, XSDFEC_LDPC_LA_TABLE_ADDR_BASE + LAOffset*4*XSDFEC_LDPC_LA_TABLE_STEP,
+                     &LAPtr[LAOffset*4], CodePtr[idx].LASize*4);
+    XSdFecWriteBlock(InstancePtr->BaseAddress, XSDFEC_LDPC_QC_TABLE_ADDR_BASE + QCOffset*4*XSDFEC_LDPC_QC_TABLE_STEP,
+                     &QCPtr[QCOffset*4], CodePtr[idx].QCSize*4);
+    XSdFecWriteBlock(InstancePtr->BaseAddress, XSDFEC_LDPC_CODE_REG0_ADDR_BASE + CodeId*XSDFEC_LDPC_CODE_REG0_STEP,
+                     CodePtr[idx].Reg, 4);
+
+    InstancePtr->SCOffset[CodeId]     = SCOffset;
+    InstancePtr->LAOffset[CodeId]     = LAOffset;
+    InstancePtr->QCOffset[CodeId]     = QCOffset;
+    InstancePtr->SCSize[CodeId]       = CodePtr[idx].SCSize;
+    InstancePtr->LASize[CodeId]       = CodePtr[idx].LASize;
+    InstancePtr->QCSize[CodeId]       = CodePtr[idx].QCSize;
+    InstancePtr->LdpcSum[CodeId]      = CodePtr[idx].Sum;
+    InstancePtr->LdpcResident[CodeId] = 1;
+    NumLoaded++;
+  }
+  if (NumLoadedPtr) {
+    *NumLoadedPtr = NumLoaded;
+  }
+  return XST_SUCCESS;
+}
+
+void XSdFecLdpcImageInvalidate(XSdFec *InstancePtr) {
+  Xil_AssertVoid(InstancePtr != NULL);
+  for (u32 idx = 0; idx < 128; idx++) {
+    InstancePtr->LdpcResident[idx] = 0;
+  }
+}
+
 XSdFecInterruptClass XSdFecInterruptClassifier(XSdFec *InstancePtr) {
   XSdFecInterruptClass IntClass;
 
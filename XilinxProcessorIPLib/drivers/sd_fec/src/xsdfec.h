@@ -31,6 +31,8 @@
  * - XSdFecSetTurboParams(InstancePtr, ParamsPtr)                                        - Set Turbo parameters on a device
  * - XSdFecadd_ldpc_params(InstancePtr, CodeId, SCOffset, LAOffset, QCOffset, ParamsPtr) - Add LDPC parameters to a device
  * - XSdFecShareTableSize(ParamsPtr, SCSizePtr, LASizePtr, QCSizePtr)                    - Calculate share table size for a LDPC code
+ * - XSdFecLdpcImageBuild(CodeIdPtr, ParamsPtr, NumCodes, ImagePtr, ImageWords, SizePtr)  - Pack LDPC codes into a table image
+ * - XSdFecLdpcImageLoad(InstancePtr, ImagePtr, ImageWords, NumLoadedPtr)                 - Load a table image, skipping resident codes
  * - XSdFecInterruptClassifier(InstancePtr)                                              - Classify interrupts
  *
  * In addition, the driver provides set and get functions for all the individual registers defined for the SD-FEC.
@@ -83,6 +85,11 @@ typedef struct {
     u32 SCOffset[128]; /**< Lookup to SC table offsets for each code ID */
     u32 LAOffset[128]; /**< Lookup to LA table offsets for each code ID */
     u32 QCOffset[128]; /**< Lookup to QC table offsets for each code ID */
+    u8  LdpcResident[128]; /**< Set when the code ID was loaded from a table image and is still intact */
+    u32 LdpcSum[128];      /**< Table image checksum of the resident code for each code ID */
+    u16 SCSize[128];       /**< Lookup to SC table sizes for each code ID */
+    u16 LASize[128];       /**< Lookup to LA table sizes for each code ID */
+    u16 QCSize[128];       /**< Lookup to QC table sizes for each code ID */
 } XSdFec;
 
 /** \brief Struct defining LDPC code parameters
@@ -107,6 +114,39 @@ typedef struct {
   u32* QCTable;
 } XSdFecLdpcParameters;
 
+// LDPC table image constants
+#define XSDFEC_LDPC_IMAGE_MAGIC      0x49464453 // "SDFI"
+#define XSDFEC_LDPC_IMAGE_MAX_CODES  128
+#define XSDFEC_LDPC_IMAGE_HDR_WORDS  (sizeof(XSdFecLdpcImageHdr)  / sizeof(u32))
+#define XSDFEC_LDPC_IMAGE_CODE_WORDS (sizeof(XSdFecLdpcImageCode) / sizeof(u32))
+
+/** \brief LDPC table image header
+ *
+ * First words of a table image built by XSdFecLdpcImageBuild. The header is followed by NumCodes XSdFecLdpcImageCode
+ * entries and then by the SC, LA and QC table contents, each laid out exactly as the table memory from word 0.
+ */
+typedef struct {
+  u32 Magic;    /**< XSDFEC_LDPC_IMAGE_MAGIC                                   */
+  u32 NumCodes; /**< Number of LDPC codes in the image                         */
+  u32 SCWords;  /**< Number of SC table words in the image                     */
+  u32 LAWords;  /**< Number of LA table words in the image                     */
+  u32 QCWords;  /**< Number of QC table words in the image                     */
+  u32 Checksum; /**< CRC-32 of all other words of the header and of the image  */
+} XSdFecLdpcImageHdr;
+
+/** \brief LDPC table image code entry
+ *
+ * Resolved code registers and share table allocation of one LDPC code in a table image
+ */
+typedef struct {
+  u32 CodeId;   /**< Code number                                               */
+  u32 Reg[4];   /**< LDPC_CODE_REG0..3 words, REG3 holds the table offsets     */
+  u32 SCSize;   /**< SC table size, in the units of XSdFecShareTableSize       */
+  u32 LASize;   /**< LA table size, in the units of XSdFecShareTableSize       */
+  u32 QCSize;   /**< QC table size, in the units of XSdFecShareTableSize       */
+  u32 Sum;      /**< CRC-32 of Reg and of the table words used by the code     */
+} XSdFecLdpcImageCode;
+
 /** \brief Struct defining Turbo Decode parameters
  *
  * Member values defined in device specific header x<ipinst_name>_turbo_params.h as per IP GUI configuration
@@ -194,6 +234,82 @@ void XSdFecSetTurboParams(XSdFec *InstancePtr, const XSdFecTurboParameters* Para
  */
 void XSdFecShareTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr, u32* LASizePtr, u32* QCSizePtr);
 
+/**\brief Calculate LDPC code register words
+ *
+ * Populates RegPtr[0..3] with the LDPC_CODE_REG0..3 words for the specified LDPC code and table offsets, as written by
+ * XSdFecAddLdpcParams. No registers are accessed.
+ *
+ * @param ParamsPtr   Pointer to parameters struct for the LDPC code
+ * @param SCOffset    Scale table offset of the LDPC code
+ * @param LAOffset    LA table offset of the LDPC code
+ * @param QCOffset    QC table offset of the LDPC code
+ * @param RegPtr      Pointer to an array of 4 words to populate
+ *
+ */
+void XSdFecLdpcCodeRegs(const XSdFecLdpcParameters* ParamsPtr, u32 SCOffset, u32 LAOffset, u32 QCOffset, u32* RegPtr);
+
+/**\brief Build an LDPC table image
+ *
+ * Packs a set of LDPC codes into one table image. Table offsets are allocated in the order the codes are given, the code
+ * registers are resolved and a checksum is added for the image and for each code. No registers are accessed and no
+ * assertions are used, so the function can be built into a host tool with the parameter headers output for the IP
+ * and the image stored with the application.
+ *
+ * To let XSdFecLdpcImageLoad skip codes shared by several images, list the shared codes first and in the same order
+ * when building each image, so they are given the same code IDs and offsets.
+ *
+ * @param CodeIdPtr      Pointer to array of code numbers, each less than XSDFEC_LDPC_IMAGE_MAX_CODES and used once
+ * @param ParamsPtr      Pointer to array of pointers to the parameters struct of each code
+ * @param NumCodes       Number of codes
+ * @param ImagePtr       Pointer to the image buffer, or NULL to only calculate the image size
+ * @param ImageWords     Size of the image buffer in words
+ * @param ImageWordsPtr  Pointer to variable to populate with the image size in words, may be NULL
+ *
+ * @returns XST_SUCCESS, XST_INVALID_PARAM for an invalid or repeated code ID, XST_FAILURE when the codes do not fit in
+ *          the share tables, or XST_BUFFER_TOO_SMALL when the image does not fit in ImageWords
+ */
+int XSdFecLdpcImageBuild(const u32* CodeIdPtr, const XSdFecLdpcParameters* const* ParamsPtr, u32 NumCodes,
+                         u32* ImagePtr, u32 ImageWords, u32* ImageWordsPtr);
+
+/**\brief Check an LDPC table image
+ *
+ * Checks the header, the code entries and the checksum of a table image. No registers are accessed.
+ *
+ * @param ImagePtr    Pointer to the image
+ * @param ImageWords  Size of the image buffer in words
+ *
+ * @returns XST_SUCCESS, or XST_FAILURE when the image is not valid
+ */
+int XSdFecLdpcImageCheck(const u32* ImagePtr, u32 ImageWords);
+
+/**\brief Load an LDPC table image to a device
+ *
+ * Checks the image and writes the share tables and code registers of each code that is not already resident. A code
+ * is resident when the same code ID was loaded from an image with the same code entry checksum and no code written
+ * since then has used any of its table words. Table slices and the four code registers of a code are contiguous on the
+ * device and are written as blocks. The offsets arrays in the given XSdFec instance are updated.
+ *
+ * Codes added with XSdFecAddLdpcParams and codes whose tables are overwritten by the image are no longer resident, and
+ * must not be used until they are loaded again. Call XSdFecLdpcImageInvalidate after the device has been reset or
+ * reprogrammed.
+ *
+ * @param InstancePtr    Pointer to device instance struct
+ * @param ImagePtr       Pointer to the image
+ * @param ImageWords     Size of the image buffer in words
+ * @param NumLoadedPtr   Pointer to variable to populate with the number of codes written, may be NULL
+ *
+ * @returns XST_SUCCESS, or XST_FAILURE when the image is not valid
+ */
+int XSdFecLdpcImageLoad(XSdFec *InstancePtr, const u32* ImagePtr, u32 ImageWords, u32* NumLoadedPtr);
+
+/**\brief Forget resident LDPC codes
+ *
+ * Marks all codes as not resident, so that the next XSdFecLdpcImageLoad writes every code of its image.
+ *
+ * @param InstancePtr Pointer to device instance struct
+ */
+void XSdFecLdpcImageInvalidate(XSdFec *InstancePtr);
+
 /**\brief Classify interrupts
  * 
  * Queries interrupt status registers and classifies interrupt and reports recovery action
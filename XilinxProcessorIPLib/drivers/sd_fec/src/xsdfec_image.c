@@ -0,0 +1,200 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+// LDPC table image builder and checker. Nothing in this file accesses registers or uses assertions, so it can also be
+// built into a host tool that packs the codes of an application into table images.
+
+/***************************** Include Files *********************************/
+#include "xsdfec.h"
+
+/************************** Function Implementation *************************/
+// CRC-32 (IEEE 802.3) of NumData words, least significant byte first, continuing from Crc
+static u32 XSdFecCrc32(u32 Crc, const u32 *DataArrayPtr, u32 NumData) {
+  static const u32 CrcNibble[16] = {
+    0x00000000, 0x1db71064, 0x3b6e20c8, 0x26d930ac, 0x76dc4190, 0x6b6b51f4, 0x4db26158, 0x5005713c,
+    0xedb88320, 0xf00f9344, 0xd6d6a3e8, 0xcb61b38c, 0x9b64c2b0, 0x86d3d2d4, 0xa00ae278, 0xbdbdf21c
+  };
+  u32 idx;
+  for (idx = 0; idx < NumData; idx++) {
+    Crc ^= DataArrayPtr[idx];
+    for (int n = 0; n < 8; n++) {
+      Crc = (Crc >> 4) ^ CrcNibble[Crc & 0xf];
+    }
+  }
+  return Crc;
+}
+
+// Share table sizes of a code, as XSdFecShareTableSize
+static void XSdFecLdpcTableSize(const XSdFecLdpcParameters* ParamsPtr, u32* SCSizePtr, u32* LASizePtr, u32* QCSizePtr) {
+  *SCSizePtr = (ParamsPtr->NLayers+3)>>2;
+  *LASizePtr = ((ParamsPtr->NLayers<<2)+15)>>4;
+  *QCSizePtr = ((ParamsPtr->NQC<<2)+15)>>4;
+}
+
+// Checksum of a code entry: its registers and the table words allocated to it
+static u32 XSdFecLdpcCodeSum(const XSdFecLdpcImageCode *CodePtr, const u32 *SCPtr, const u32 *LAPtr, const u32 *QCPtr) {
+  u32 SCOffset = (CodePtr->Reg[3] & XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB;
+  u32 LAOffset = (CodePtr->Reg[3] & XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB;
+  u32 QCOffset = (CodePtr->Reg[3] & XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB;
+  u32 Crc = 0xffffffff;
+  Crc = XSdFecCrc32(Crc, CodePtr->Reg, 4);
+  Crc = XSdFecCrc32(Crc, &SCPtr[SCOffset], CodePtr->SCSize);
+  Crc = XSdFecCrc32(Crc, &LAPtr[LAOffset*4], CodePtr->LASize*4); // LA and QC offsets and sizes are in units of 4 words
+  Crc = XSdFecCrc32(Crc, &QCPtr[QCOffset*4], CodePtr->QCSize*4);
+  return ~Crc;
+}
+
+// Checksum of an image: every word except the header checksum
+static u32 XSdFecLdpcImageSum(const u32 *ImagePtr, u32 NumData) {
+  const XSdFecLdpcImageHdr *HdrPtr = (const XSdFecLdpcImageHdr *)ImagePtr;
+  u32 Crc = 0xffffffff;
+  Crc = XSdFecCrc32(Crc, ImagePtr, (u32)((const u32 *)&HdrPtr->Checksum - ImagePtr));
+  Crc = XSdFecCrc32(Crc, ImagePtr + XSDFEC_LDPC_IMAGE_HDR_WORDS, NumData - XSDFEC_LDPC_IMAGE_HDR_WORDS);
+  return ~Crc;
+}
+
+void XSdFecLdpcCodeRegs(const XSdFecLdpcParameters* ParamsPtr, u32 SCOffset, u32 LAOffset, u32 QCOffset, u32* RegPtr) {
+  u32 wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG0_N_MASK & (ParamsPtr->N << XSDFEC_LDPC_CODE_REG0_N_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG0_K_MASK & (ParamsPtr->K << XSDFEC_LDPC_CODE_REG0_K_LSB));
+  RegPtr[0] = wr_data;
+  wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG1_PSIZE_MASK       & (ParamsPtr->PSize      << XSDFEC_LDPC_CODE_REG1_PSIZE_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG1_NO_PACKING_MASK  & (ParamsPtr->NoPacking  << XSDFEC_LDPC_CODE_REG1_NO_PACKING_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG1_NM_MASK          & (ParamsPtr->NM         << XSDFEC_LDPC_CODE_REG1_NM_LSB));
+  RegPtr[1] = wr_data;
+  wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NLAYERS_MASK               & (ParamsPtr->NLayers        << XSDFEC_LDPC_CODE_REG2_NLAYERS_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NMQC_MASK                  & (ParamsPtr->NMQC           << XSDFEC_LDPC_CODE_REG2_NMQC_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NORM_TYPE_MASK             & (ParamsPtr->NormType       << XSDFEC_LDPC_CODE_REG2_NORM_TYPE_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_MASK            & (ParamsPtr->SpecialQC      << XSDFEC_LDPC_CODE_REG2_SPECIAL_QC_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_MASK & (ParamsPtr->NoFinalParity  << XSDFEC_LDPC_CODE_REG2_NO_FINAL_PARITY_CHECK_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_MASK          & (ParamsPtr->MaxSchedule    << XSDFEC_LDPC_CODE_REG2_MAX_SCHEDULE_LSB));
+  RegPtr[2] = wr_data;
+  wr_data = 0;
+  wr_data |= (XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK & (SCOffset << XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK & (LAOffset << XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB));
+  wr_data |= (XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK & (QCOffset << XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB));
+  RegPtr[3] = wr_data;
+}
+
+int XSdFecLdpcImageBuild(const u32* CodeIdPtr, const XSdFecLdpcParameters* const* ParamsPtr, u32 NumCodes,
+                         u32* ImagePtr, u32 ImageWords, u32* ImageWordsPtr) {
+  u8  Used[XSDFEC_LDPC_IMAGE_MAX_CODES] = {0};
+  u32 SCWords = 0;
+  u32 LAWords = 0;
+  u32 QCWords = 0;
+  u32 SCSize, LASize, QCSize;
+  u32 idx;
+
+  if (CodeIdPtr == NULL || ParamsPtr == NULL || NumCodes == 0 || NumCodes > XSDFEC_LDPC_IMAGE_MAX_CODES) {
+    return XST_INVALID_PARAM;
+  }
+  // Allocate the tables in the order of the codes
+  for (idx = 0; idx < NumCodes; idx++) {
+    if (ParamsPtr[idx] == NULL || CodeIdPtr[idx] >= XSDFEC_LDPC_IMAGE_MAX_CODES || Used[CodeIdPtr[idx]]) {
+      return XST_INVALID_PARAM;
+    }
+    Used[CodeIdPtr[idx]] = 1;
+    XSdFecLdpcTableSize(ParamsPtr[idx], &SCSize, &LASize, &QCSize);
+    SCWords += SCSize;
+    LAWords += LASize*4;
+    QCWords += QCSize*4;
+  }
+  if (SCWords > XSDFEC_LDPC_SC_TABLE_DEPTH || LAWords > XSDFEC_LDPC_LA_TABLE_DEPTH ||
+      QCWords > XSDFEC_LDPC_QC_TABLE_DEPTH) {
+    return XST_FAILURE;
+  }
+
+  u32 TotalWords = XSDFEC_LDPC_IMAGE_HDR_WORDS + NumCodes*XSDFEC_LDPC_IMAGE_CODE_WORDS + SCWords + LAWords + QCWords;
+  if (ImageWordsPtr) {
+    *ImageWordsPtr = TotalWords;
+  }
+  if (ImagePtr == NULL) {
+    return XST_SUCCESS;
+  }
+  if (ImageWords < TotalWords) {
+    return XST_BUFFER_TOO_SMALL;
+  }
+
+  XSdFecLdpcImageHdr  *HdrPtr  = (XSdFecLdpcImageHdr *)ImagePtr;
+  XSdFecLdpcImageCode *CodePtr = (XSdFecLdpcImageCode *)(ImagePtr + XSDFEC_LDPC_IMAGE_HDR_WORDS);
+  u32 *SCPtr = ImagePtr + XSDFEC_LDPC_IMAGE_HDR_WORDS + NumCodes*XSDFEC_LDPC_IMAGE_CODE_WORDS;
+  u32 *LAPtr = SCPtr + SCWords;
+  u32 *QCPtr = LAPtr + LAWords;
+
+  // Table words past the end of a code are unused by the device and left zero
+  for (idx = 0; idx < SCWords + LAWords + QCWords; idx++) {
+    SCPtr[idx] = 0;
+  }
+  u32 SCOffset = 0;
+  u32 LAOffset = 0;
+  u32 QCOffset = 0;
+  for (idx = 0; idx < NumCodes; idx++) {
+    const XSdFecLdpcParameters *CodeParamsPtr = ParamsPtr[idx];
+    u32 n;
+    XSdFecLdpcTableSize(CodeParamsPtr, &SCSize, &LASize, &QCSize);
+    for (n = 0; n < SCSize; n++) {
+      SCPtr[SCOffset + n] = CodeParamsPtr->SCTable[n]; // Scale is packed, 4 per reg
+    }
+    for (n = 0; n < CodeParamsPtr->NLayers; n++) {
+      LAPtr[LAOffset*4 + n] = CodeParamsPtr->LATable[n];
+    }
+    for (n = 0; n < CodeParamsPtr->NQC; n++) {
+      QCPtr[QCOffset*4 + n] = CodeParamsPtr->QCTable[n];
+    }
+    CodePtr[idx].CodeId = CodeIdPtr[idx];
+    XSdFecLdpcCodeRegs(CodeParamsPtr, SCOffset, LAOffset, QCOffset, CodePtr[idx].Reg);
+    CodePtr[idx].SCSize = SCSize;
+    CodePtr[idx].LASize = LASize;
+    CodePtr[idx].QCSize = QCSize;
+    CodePtr[idx].Sum    = XSdFecLdpcCodeSum(&CodePtr[idx], SCPtr, LAPtr, QCPtr);
+    SCOffset += SCSize;
+    LAOffset += LASize;
+    QCOffset += QCSize;
+  }
+
+  HdrPtr->Magic    = XSDFEC_LDPC_IMAGE_MAGIC;
+  HdrPtr->NumCodes = NumCodes;
+  HdrPtr->SCWords  = SCWords;
+  HdrPtr->LAWords  = LAWords;
+  HdrPtr->QCWords  = QCWords;
+  HdrPtr->Checksum = XSdFecLdpcImageSum(ImagePtr, TotalWords);
+
+  return XST_SUCCESS;
+}
+
+int XSdFecLdpcImageCheck(const u32* ImagePtr, u32 ImageWords) {
+  const XSdFecLdpcImageHdr *HdrPtr = (const XSdFecLdpcImageHdr *)ImagePtr;
+
+  if (ImagePtr == NULL || ImageWords < XSDFEC_LDPC_IMAGE_HDR_WORDS) {
+    return XST_FAILURE;
+  }
+  if (HdrPtr->Magic != XSDFEC_LDPC_IMAGE_MAGIC || HdrPtr->NumCodes == 0 ||
+      HdrPtr->NumCodes > XSDFEC_LDPC_IMAGE_MAX_CODES || HdrPtr->SCWords > XSDFEC_LDPC_SC_TABLE_DEPTH ||
+      HdrPtr->LAWords > XSDFEC_LDPC_LA_TABLE_DEPTH || HdrPtr->QCWords > XSDFEC_LDPC_QC_TABLE_DEPTH) {
+    return XST_FAILURE;
+  }
+  u32 TotalWords = XSDFEC_LDPC_IMAGE_HDR_WORDS + HdrPtr->NumCodes*XSDFEC_LDPC_IMAGE_CODE_WORDS +
+                   HdrPtr->SCWords + HdrPtr->LAWords + HdrPtr->QCWords;
+  if (ImageWords < TotalWords || HdrPtr->Checksum != XSdFecLdpcImageSum(ImagePtr, TotalWords)) {
+    return XST_FAILURE;
+  }
+  // The loader relies on every code lying inside the tables of the image
+  const XSdFecLdpcImageCode *CodePtr = (const XSdFecLdpcImageCode *)(ImagePtr + XSDFEC_LDPC_IMAGE_HDR_WORDS);
+  u32 idx;
+  for (idx = 0; idx < HdrPtr->NumCodes; idx++) {
+    u32 SCOffset = (CodePtr[idx].Reg[3] & XSDFEC_LDPC_CODE_REG3_SC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_SC_OFF_LSB;
+    u32 LAOffset = (CodePtr[idx].Reg[3] & XSDFEC_LDPC_CODE_REG3_LA_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_LA_OFF_LSB;
+    u32 QCOffset = (CodePtr[idx].Reg[3] & XSDFEC_LDPC_CODE_REG3_QC_OFF_MASK) >> XSDFEC_LDPC_CODE_REG3_QC_OFF_LSB;
+    if (CodePtr[idx].CodeId >= XSDFEC_LDPC_IMAGE_MAX_CODES ||
+        SCOffset + CodePtr[idx].SCSize > HdrPtr->SCWords ||
+        (LAOffset + CodePtr[idx].LASize)*4 > HdrPtr->LAWords ||
+        (QCOffset + CodePtr[idx].QCSize)*4 > HdrPtr->QCWords) {
+      return XST_FAILURE;
+    }
+  }
+  return XST_SUCCESS;
+}
@@ -20,6 +20,7 @@
  * 1.4   BK  12/01/18  Renamed the file and added changes to have a common
  *		       example for all USB IPs.
  * 1.5   vak 03/25/19  Fixed incorrect data_alignment pragma directive for IAR
+ * 1.11      10/19/26  Abandon a queued READ/WRITE on SET_CONFIGURATION
  *
  *</pre>
  *
@@ -572,6 +573,7 @@ s32 Usb_SetConfigurationApp(struct Usb_DevData *InstancePtr,
 
 		/* Reset the Phase to default COMMAND STATE */
 		Phase = USB_EP_STATE_COMMAND;
+		StorageXferReset(InstancePtr);
 
 		/*
 		 * As per Mass storage specification we receive 31 byte length
@@ -600,6 +602,7 @@ s32 Usb_SetConfigurationApp(struct Usb_DevData *InstancePtr,
 
 		/* Reset the Phase to default COMMAND STATE */
 		Phase = USB_EP_STATE_COMMAND;
+		StorageXferReset(InstancePtr);
 	}
 
 	return XST_SUCCESS;
@@ -24,6 +24,11 @@
  * 1.5	  vak 13/02/19  Added support for versal
  * 1.5    vak 03/25/19 Fixed incorrect data_alignment pragma directive for IAR
  * 1.8   pm   15/09/20 Fixed C++ Compilation error.
+ * 1.11       10/19/26 Moved READ/WRITE data through queued storage buffers
+ *		       so the storage back end overlaps with the bus.
+ *            10/19/26 Only lock out the USB interrupt around endpoint calls
+ *                     made from the main loop and stop queued transfers on
+ *                     reset
  *
  * </pre>
  *
@@ -40,11 +45,27 @@
 
 /**************************** Type Definitions *******************************/
 
+/*
+ * State of the READ or WRITE command being moved through the storage
+ * buffers. Done and DoneLen are written by StorageXferDone() from the
+ * endpoint handler, the rest by the main loop only.
+ */
+typedef struct {
+	u32 Offset;			/* Next storage offset to read/write */
+	u32 Left;			/* Bytes not queued on the endpoint */
+	u32 Queued;			/* Buffers queued on the endpoint */
+	u32 Retired;			/* Received buffers written */
+	volatile u32 Done;		/* Buffers completed on the endpoint */
+	volatile u32 DoneLen[STORAGE_NUM_BUFFERS];	/* Bytes moved */
+	volatile u8 State;		/* Data phase or COMMAND if idle */
+} STORAGE_XFER;
+
 /************************** Function Prototypes ******************************/
+static void StorageStart(struct Usb_DevData *InstancePtr, u8 State,
+				u32 Offset, u32 Length);
 
 /************************** Variable Definitions *****************************/
 extern u8 Phase;
-extern u8 VirtFlash[];
 
 /*
  * Pre-manufactured response to the SCSI Inquiry command.
@@ -96,8 +117,6 @@ static u8 MaxLUN ALIGNMENT_CACHELINE = 0;
 extern USB_CBW CBW;
 extern USB_CSW CSW;
 
-extern u32	rxBytesLeft;
-extern u8	*VirtFlashWritePointer;
 
 /* Local transmit buffer for simple replies. */
 #ifdef __ICCARM__
@@ -106,6 +125,30 @@ static u8 txBuffer[128];
 static u8 txBuffer[128] ALIGNMENT_CACHELINE;
 #endif
 
+/* Buffers for READ and WRITE data. */
+#ifdef __ICCARM__
+#if defined (PLATFORM_ZYNQMP) || defined (versal)
+#pragma data_alignment = 64
+#else
+#pragma data_alignment = 32
+#endif
+static u8 StorageBuf[STORAGE_NUM_BUFFERS][STORAGE_XFER_SIZE];
+#else
+static u8 StorageBuf[STORAGE_NUM_BUFFERS][STORAGE_XFER_SIZE]
+							ALIGNMENT_CACHELINE;
+#endif
+
+static STORAGE_XFER Xfer;
+
+/* Serialize main loop endpoint calls with the USB interrupt handler */
+static void (*EpLock)(void);
+static void (*EpUnlock)(void);
+
+#define STORAGE_EP_LOCK() \
+	do { if (EpLock != NULL) { EpLock(); } } while (0)
+#define STORAGE_EP_UNLOCK() \
+	do { if (EpUnlock != NULL) { EpUnlock(); } } while (0)
+
 /*****************************************************************************/
 /**
 * This function is class handler for Mass storage and is called when
@@ -127,6 +170,7 @@ void ClassReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData)
 
 	switch(SetupData->bRequest) {
 	case USB_CLASSREQ_MASS_STORAGE_RESET:
+		StorageXferReset(InstancePtr);
 		/* For Control transfers, Status Phase is handled by driver */
 
 		EpBufferSend(InstancePtr->PrivateData, 0, NULL, 0);
@@ -153,7 +197,8 @@ void ClassReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData)
 *
 * @return	None.
 *
-* @note		None.
+* @note		Runs with the endpoint lock held. READ and WRITE data is
+*		moved by the next StorageService() call, outside the lock.
 *
 ******************************************************************************/
 void ParseCBW(struct Usb_DevData *InstancePtr)
@@ -163,6 +208,8 @@ void ParseCBW(struct Usb_DevData *InstancePtr)
 	u8 Index;
 	s32 Status;
 
+	STORAGE_EP_LOCK();
+
 	switch (CBW.CBWCB[0]) {
 	case USB_RBC_INQUIRY:
 	{
@@ -231,16 +278,9 @@ void ParseCBW(struct Usb_DevData *InstancePtr)
 		printf("SCSI: READ Offset 0x%08x\r\n", Offset);
 #endif
 
-		Phase = USB_EP_STATE_DATA_IN;
-		u32 RetVal = EpBufferSend(InstancePtr->PrivateData, 1,
-				&VirtFlash[Offset],
+		StorageStart(InstancePtr, USB_EP_STATE_DATA_IN, Offset,
 				htons(((SCSI_READ_WRITE *) &CBW.CBWCB)->
 				 length) * VFLASH_BLOCK_SIZE);
-		if (RetVal != XST_SUCCESS) {
-			xil_printf("Failed: READ Offset 0x%08x\n",
-								Offset);
-			return;
-		}
 		break;
 	}
 	case USB_RBC_MODE_SENSE:
@@ -294,14 +334,10 @@ void ParseCBW(struct Usb_DevData *InstancePtr)
 #ifdef CLASS_STORAGE_DEBUG
 		printf("SCSI: WRITE Offset 0x%08x\r\n", Offset);
 #endif
-		VirtFlashWritePointer = &VirtFlash[Offset];
-
-		rxBytesLeft = htons(((SCSI_READ_WRITE *) &CBW.CBWCB)->length)
-						* VFLASH_BLOCK_SIZE;
 
-		Phase = USB_EP_STATE_DATA_OUT;
-		EpBufferRecv(InstancePtr->PrivateData, 1,
-				&VirtFlash[Offset], rxBytesLeft);
+		StorageStart(InstancePtr, USB_EP_STATE_DATA_OUT, Offset,
+				htons(((SCSI_READ_WRITE *) &CBW.CBWCB)->
+				 length) * VFLASH_BLOCK_SIZE);
 		break;
 	}
 	case USB_RBC_STARTSTOP_UNIT:
@@ -337,6 +373,8 @@ void ParseCBW(struct Usb_DevData *InstancePtr)
 		break;
 	}
 	}
+
+	STORAGE_EP_UNLOCK();
 }
 
 /****************************************************************************/
@@ -360,3 +398,192 @@ void SendCSW(struct Usb_DevData *InstancePtr, u32 Length)
 	Phase = USB_EP_STATE_STATUS;
 	EpBufferSend(InstancePtr->PrivateData, 1, (u8 *) &CSW, 13);
 }
+
+/****************************************************************************/
+/**
+* This function starts the data phase of a READ or WRITE command. The data
+* is moved by StorageService() from the main loop.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+* @param	State is USB_EP_STATE_DATA_IN for READ and USB_EP_STATE_DATA_OUT
+*		for WRITE.
+* @param	Offset is the storage offset in bytes.
+* @param	Length is the number of bytes to move.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void StorageStart(struct Usb_DevData *InstancePtr, u8 State,
+				u32 Offset, u32 Length)
+{
+	Xfer.Offset = Offset;
+	Xfer.Left = Length;
+	Xfer.Queued = 0;
+	Xfer.Retired = 0;
+	Xfer.Done = 0;
+	Phase = State;
+
+	if (Length == 0) {
+		SendCSW(InstancePtr, 0);
+		return;
+	}
+
+	Xfer.State = State;
+}
+
+/****************************************************************************/
+/**
+* This function moves READ and WRITE data between the storage back end and
+* the storage buffers, queues the buffers on the bulk endpoints and sends
+* the status once all data has been moved. It is called from the main loop,
+* so the storage back end never runs in the endpoint handler.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+*
+* @return	None
+*
+* @note		For READ, a buffer is read from storage while the previous
+*		ones are sent to the host. For WRITE, received buffers are
+*		written to storage while the next ones are received. The
+*		endpoint lock is only held around the endpoint calls, never
+*		across the storage back end.
+*
+*****************************************************************************/
+void StorageService(struct Usb_DevData *InstancePtr)
+{
+	u32 Index;
+	u32 Length;
+	s32 Status;
+
+	if (Xfer.State == USB_EP_STATE_DATA_IN) {
+		while ((Xfer.Left > 0) &&
+			((Xfer.Queued - Xfer.Done) < STORAGE_NUM_BUFFERS)) {
+			Index = Xfer.Queued % STORAGE_NUM_BUFFERS;
+			Length = (Xfer.Left > STORAGE_XFER_SIZE) ?
+					STORAGE_XFER_SIZE : Xfer.Left;
+			StorageRead(Xfer.Offset, StorageBuf[Index], Length);
+			STORAGE_EP_LOCK();
+			Status = EpQueueSend(InstancePtr->PrivateData, 1,
+					StorageBuf[Index], Length);
+			STORAGE_EP_UNLOCK();
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+			Xfer.Offset += Length;
+			Xfer.Left -= Length;
+			Xfer.Queued++;
+		}
+
+		if ((Xfer.Left == 0) && (Xfer.Done == Xfer.Queued)) {
+			Xfer.State = USB_EP_STATE_COMMAND;
+			STORAGE_EP_LOCK();
+			SendCSW(InstancePtr, 0);
+			STORAGE_EP_UNLOCK();
+		}
+	} else if (Xfer.State == USB_EP_STATE_DATA_OUT) {
+		while (Xfer.Retired != Xfer.Done) {
+			Index = Xfer.Retired % STORAGE_NUM_BUFFERS;
+			StorageWrite(Xfer.Offset, StorageBuf[Index],
+					Xfer.DoneLen[Index]);
+			Xfer.Offset += Xfer.DoneLen[Index];
+			Xfer.Retired++;
+		}
+
+		while ((Xfer.Left > 0) &&
+			((Xfer.Queued - Xfer.Retired) < STORAGE_NUM_BUFFERS)) {
+			Index = Xfer.Queued % STORAGE_NUM_BUFFERS;
+			Length = (Xfer.Left > STORAGE_XFER_SIZE) ?
+					STORAGE_XFER_SIZE : Xfer.Left;
+			STORAGE_EP_LOCK();
+			Status = EpQueueRecv(InstancePtr->PrivateData, 1,
+					StorageBuf[Index], Length);
+			STORAGE_EP_UNLOCK();
+			if (Status != XST_SUCCESS) {
+				break;
+			}
+			Xfer.Left -= Length;
+			Xfer.Queued++;
+		}
+
+		if ((Xfer.Left == 0) && (Xfer.Retired == Xfer.Queued)) {
+			Xfer.State = USB_EP_STATE_COMMAND;
+			STORAGE_EP_LOCK();
+			SendCSW(InstancePtr, 0);
+			STORAGE_EP_UNLOCK();
+		}
+	}
+}
+
+/****************************************************************************/
+/**
+* This function is called from the bulk endpoint handlers in the data phase
+* and accounts a completed storage buffer.
+*
+* @param	BytesTxed is the number of bytes moved on the bus.
+*
+* @return	TRUE if the buffer belongs to a READ or WRITE command, FALSE
+*		otherwise.
+*
+* @note		The buffer is processed by the next StorageService() call.
+*
+*****************************************************************************/
+u32 StorageXferDone(u32 BytesTxed)
+{
+	if (Xfer.State == USB_EP_STATE_COMMAND) {
+		return FALSE;
+	}
+
+	Xfer.DoneLen[Xfer.Done % STORAGE_NUM_BUFFERS] = BytesTxed;
+	Xfer.Done++;
+
+	return TRUE;
+}
+
+/****************************************************************************/
+/**
+* This function abandons the READ or WRITE command in progress. Storage
+* buffers still queued on the bulk endpoint are dropped with its transfer.
+*
+* @param	InstancePtr is pointer to Usb_DevData instance.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+void StorageXferReset(struct Usb_DevData *InstancePtr)
+{
+	if (Xfer.State == USB_EP_STATE_DATA_IN) {
+		StopTransfer(InstancePtr->PrivateData, 1, USB_EP_DIR_IN);
+	} else if (Xfer.State == USB_EP_STATE_DATA_OUT) {
+		StopTransfer(InstancePtr->PrivateData, 1, USB_EP_DIR_OUT);
+	}
+
+	Xfer.State = USB_EP_STATE_COMMAND;
+	Xfer.Left = 0;
+	Xfer.Queued = 0;
+	Xfer.Retired = 0;
+	Xfer.Done = 0;
+}
+
+/****************************************************************************/
+/**
+* This function registers the functions that serialize the endpoint calls
+* made from the main loop with the USB interrupt handler. Without them,
+* ParseCBW() and StorageService() must not race the interrupt handler.
+*
+* @param	Lock is called before an endpoint call, NULL if not needed.
+* @param	Unlock is called after an endpoint call, NULL if not needed.
+*
+* @return	None
+*
+* @note		The storage back end runs without the lock held.
+*
+*****************************************************************************/
+void StorageSetEpLock(void (*Lock)(void), void (*Unlock)(void))
+{
+	EpLock = Lock;
+	EpUnlock = Unlock;
+}
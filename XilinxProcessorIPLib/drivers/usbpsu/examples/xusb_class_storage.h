@@ -18,6 +18,10 @@
  * 1.0   sg  06/06/16  First release
  * 1.4   BK  12/01/18 Renamed the file and added changes to have a common
  *		      example for all USB IPs.
+ * 1.11      10/19/26 Added the queued READ/WRITE pipeline and the storage
+ *		      back end hooks.
+ *           10/19/26 Added StorageSetEpLock(), StorageXferReset() takes
+ *		      the instance.
  *
  * </pre>
  *
@@ -64,6 +68,18 @@ extern "C" {
 #define VFLASH_BLOCK_SIZE	0x200
 #define VFLASH_NUM_BLOCKS	(VFLASH_SIZE/VFLASH_BLOCK_SIZE)
 
+/* READ and WRITE data is moved through STORAGE_NUM_BUFFERS buffers of
+ * STORAGE_XFER_SIZE bytes, so the storage back end works on one buffer while
+ * the others are on the bus. STORAGE_NUM_BUFFERS must not exceed the number
+ * of TRBs per endpoint.
+ */
+#ifndef STORAGE_XFER_SIZE
+#define STORAGE_XFER_SIZE	(64 * 1024)
+#endif
+#ifndef STORAGE_NUM_BUFFERS
+#define STORAGE_NUM_BUFFERS	2
+#endif
+
 /* Class request opcodes.
  */
 #define USB_CLASSREQ_MASS_STORAGE_RESET	0xFF
@@ -158,6 +174,14 @@ typedef struct {
 void ClassReq(struct Usb_DevData *InstancePtr, SetupPacket *SetupData);
 void ParseCBW(struct Usb_DevData *InstancePtr);
 void SendCSW(struct Usb_DevData *InstancePtr, u32 Length);
+void StorageService(struct Usb_DevData *InstancePtr);
+u32 StorageXferDone(u32 BytesTxed);
+void StorageXferReset(struct Usb_DevData *InstancePtr);
+void StorageSetEpLock(void (*Lock)(void), void (*Unlock)(void));
+
+/* Storage back end, implemented by the application */
+void StorageRead(u32 Offset, u8 *BufferPtr, u32 Length);
+void StorageWrite(u32 Offset, const u8 *BufferPtr, u32 Length);
 
 #ifdef __cplusplus
 }
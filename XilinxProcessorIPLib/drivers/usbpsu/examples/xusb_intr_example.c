@@ -25,6 +25,10 @@
  *		      example.
  * 1.5	 vak 13/02/19 Added support for versal
  * 1.8   pm  15/09/20 Fixed C++ Compilation error.
+ * 1.11      10/19/26 Moved SCSI command handling out of the interrupt
+ *		      handler and queued READ/WRITE data on the bulk endpoints.
+ *           10/19/26 Mask the USB interrupt while the main loop issues
+ *		      endpoint commands, but not across the storage back end.
  *
  * </pre>
  *
@@ -35,6 +39,7 @@
 #include "xil_printf.h"
 #include "sleep.h"
 #include <stdio.h>
+#include <string.h>
 #include "xusb_ch9_storage.h"
 #include "xusb_class_storage.h"
 #include "xusb_wrapper.h"
@@ -72,6 +77,8 @@ void BulkInHandler(void *CallBackRef, u32 RequestedBytes,
 							u32 BytesTxed);
 static s32 SetupInterruptSystem(struct XUsbPsu *InstancePtr, u16 IntcDeviceID,
 		u16 USB_INTR_ID, void *IntcPtr);
+static void UsbIntrDisable(void);
+static void UsbIntrEnable(void);
 
 /************************** Variable Definitions *****************************/
 struct Usb_DevData UsbInstance;
@@ -124,8 +131,7 @@ USB_CSW CSW ALIGNMENT_CACHELINE;
 #endif
 
 u8 Phase;
-u32	rxBytesLeft;
-u8 *VirtFlashWritePointer = VirtFlash;
+volatile u8 CbwPending;
 
 /* Initialize a DFU data structure */
 static USBCH9_DATA storage_data = {
@@ -228,11 +234,26 @@ int main(void)
 		return XST_FAILURE;
 	}
 
+	/*
+	 * Mask the USB interrupt only while the main loop issues endpoint
+	 * commands, the storage back end runs with it unmasked
+	 */
+	StorageSetEpLock(UsbIntrDisable, UsbIntrEnable);
+
 	/* Start the controller so that Host can see our device */
 	Usb_Start(UsbInstance.PrivateData);
 
 	while(1) {
-		/* Rest is taken care by interrupts */
+		/*
+		 * SCSI commands and storage access run here, not in the ISR.
+		 * The endpoint commands they issue are made under the lock
+		 * registered with StorageSetEpLock().
+		 */
+		if (CbwPending != 0) {
+			CbwPending = 0;
+			ParseCBW(&UsbInstance);
+		}
+		StorageService(&UsbInstance);
 	}
 
 	return XST_SUCCESS;
@@ -258,18 +279,13 @@ void BulkOutHandler(void *CallBackRef, u32 RequestedBytes,
 	struct Usb_DevData *InstancePtr = (struct Usb_DevData *)CallBackRef;
 
 	if (Phase == USB_EP_STATE_COMMAND) {
-		ParseCBW(InstancePtr);
+		/* The CBW is parsed by the main loop */
+		CbwPending = 1;
 	} else if (Phase == USB_EP_STATE_DATA_OUT) {
-		/* WRITE command */
-		switch (CBW.CBWCB[0]) {
-		case USB_RBC_WRITE:
-			VirtFlashWritePointer += BytesTxed;
-			rxBytesLeft -= BytesTxed;
-			break;
-		default:
-			break;
+		/* WRITE data is written to storage by the main loop */
+		if (StorageXferDone(BytesTxed) == FALSE) {
+			SendCSW(InstancePtr, 0);
 		}
-		SendCSW(InstancePtr, 0);
 	}
 }
 
@@ -293,8 +309,10 @@ void BulkInHandler(void *CallBackRef, u32 RequestedBytes,
 	struct Usb_DevData *InstancePtr = (struct Usb_DevData *)CallBackRef;
 
 	if (Phase == USB_EP_STATE_DATA_IN) {
-		/* Send the status */
-		SendCSW(InstancePtr, 0);
+		/* Send the status unless more READ data is pending */
+		if (StorageXferDone(BytesTxed) == FALSE) {
+			SendCSW(InstancePtr, 0);
+		}
 	} else if (Phase == USB_EP_STATE_STATUS) {
 		Phase = USB_EP_STATE_COMMAND;
 		/* Receive next CBW */
@@ -302,6 +320,88 @@ void BulkInHandler(void *CallBackRef, u32 RequestedBytes,
 	}
 }
 
+/****************************************************************************/
+/**
+* This function is the storage back end used for READ commands.
+*
+* @param	Offset is the storage offset in bytes.
+* @param	BufferPtr is the buffer to fill in.
+* @param	Length is the number of bytes to read.
+*
+* @return	None
+*
+* @note		Replace with the read function of the real storage device.
+*
+*****************************************************************************/
+void StorageRead(u32 Offset, u8 *BufferPtr, u32 Length)
+{
+	memcpy(BufferPtr, &VirtFlash[Offset], Length);
+}
+
+/****************************************************************************/
+/**
+* This function is the storage back end used for WRITE commands.
+*
+* @param	Offset is the storage offset in bytes.
+* @param	BufferPtr is the data to write.
+* @param	Length is the number of bytes to write.
+*
+* @return	None
+*
+* @note		Replace with the write function of the real storage device.
+*
+*****************************************************************************/
+void StorageWrite(u32 Offset, const u8 *BufferPtr, u32 Length)
+{
+	memcpy(&VirtFlash[Offset], BufferPtr, Length);
+}
+
+/****************************************************************************/
+/**
+* This function masks the USB interrupt at the interrupt controller so that
+* the main loop can call the driver without racing its interrupt handler.
+*
+* @param	None.
+*
+* @return	None
+*
+* @note		The controller keeps moving data, only the handling of its
+*		events is delayed until UsbIntrEnable() is called.
+*
+*****************************************************************************/
+static void UsbIntrDisable(void)
+{
+#ifdef __MICROBLAZE__
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc_Disable(&InterruptController, USB_INT_ID);
+#endif /* XPAR_INTC_0_DEVICE_ID */
+#elif defined (PLATFORM_ZYNQMP) || defined (versal)
+	XScuGic_Disable(&InterruptController, USB_INT_ID);
+#endif
+}
+
+/****************************************************************************/
+/**
+* This function unmasks the USB interrupt masked by UsbIntrDisable().
+*
+* @param	None.
+*
+* @return	None
+*
+* @note		None.
+*
+*****************************************************************************/
+static void UsbIntrEnable(void)
+{
+#ifdef __MICROBLAZE__
+#ifdef XPAR_INTC_0_DEVICE_ID
+	XIntc_Enable(&InterruptController, USB_INT_ID);
+#endif /* XPAR_INTC_0_DEVICE_ID */
+#elif defined (PLATFORM_ZYNQMP) || defined (versal)
+	XScuGic_Enable(&InterruptController, USB_INT_ID);
+#endif
+}
+
 /****************************************************************************/
 /**
 * This function setups the interrupt system such that interrupts can occur.
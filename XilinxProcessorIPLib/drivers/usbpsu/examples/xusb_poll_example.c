@@ -18,6 +18,8 @@
  * 1.5   vak  06/02/19 First release
  * 1.5   vak  03/25/19 Fixed incorrect data_alignment pragma directive for IAR
  * 1.8   pm  15/09/20 Fixed C++ Compilation error.
+ * 1.11      10/19/26 Moved SCSI command handling out of the endpoint
+ *		      handler and queued READ/WRITE data on the bulk endpoints.
  *
  * </pre>
  *
@@ -28,6 +30,7 @@
 #include "xil_printf.h"
 #include "sleep.h"
 #include <stdio.h>
+#include <string.h>
 #include "xusb_ch9_storage.h"
 #include "xusb_class_storage.h"
 #include "xusb_wrapper.h"
@@ -84,8 +87,7 @@ USB_CSW CSW ALIGNMENT_CACHELINE;
 #endif
 
 u8	Phase;
-u32	rxBytesLeft;
-u8	*VirtFlashWritePointer = VirtFlash;
+volatile u8	CbwPending;
 
 /* Initialize a DFU data structure */
 static USBCH9_DATA storage_data = {
@@ -198,6 +200,12 @@ int main(void)
 	while(1U) {
 		/* Call Poll Handler for any valid events */
 		UsbPollHandler((struct XUsbPsu *)UsbInstance.PrivateData);
+
+		if (CbwPending != 0U) {
+			CbwPending = 0U;
+			ParseCBW(&UsbInstance);
+		}
+		StorageService(&UsbInstance);
 	}
 
 	return XST_SUCCESS;
@@ -223,18 +231,13 @@ void BulkOutHandler(void *CallBackRef, u32 RequestedBytes,
 	struct Usb_DevData *InstancePtr = (struct Usb_DevData *)CallBackRef;
 
 	if (Phase == USB_EP_STATE_COMMAND) {
-		ParseCBW(InstancePtr);
+		/* The CBW is parsed by the main loop */
+		CbwPending = 1U;
 	} else if (Phase == USB_EP_STATE_DATA_OUT) {
-		/* WRITE command */
-		switch (CBW.CBWCB[0U]) {
-		case USB_RBC_WRITE:
-			VirtFlashWritePointer += BytesTxed;
-			rxBytesLeft -= BytesTxed;
-			break;
-		default:
-			break;
+		/* WRITE data is written to storage by the main loop */
+		if (StorageXferDone(BytesTxed) == FALSE) {
+			SendCSW(InstancePtr, 0U);
 		}
-		SendCSW(InstancePtr, 0U);
 	}
 }
 
@@ -258,8 +261,10 @@ void BulkInHandler(void *CallBackRef, u32 RequestedBytes,
 	struct Usb_DevData *InstancePtr = (struct Usb_DevData *)CallBackRef;
 
 	if (Phase == USB_EP_STATE_DATA_IN) {
-		/* Send the status */
-		SendCSW(InstancePtr, 0U);
+		/* Send the status unless more READ data is pending */
+		if (StorageXferDone(BytesTxed) == FALSE) {
+			SendCSW(InstancePtr, 0U);
+		}
 	} else if (Phase == USB_EP_STATE_STATUS) {
 		Phase = USB_EP_STATE_COMMAND;
 		/* Receive next CBW */
@@ -267,3 +272,39 @@ void BulkInHandler(void *CallBackRef, u32 RequestedBytes,
 							(u8*)&CBW, sizeof(CBW));
 	}
 }
+
+/****************************************************************************/
+/**
+* This function is the storage back end used for READ commands.
+*
+* @param	Offset is the storage offset in bytes.
+* @param	BufferPtr is the buffer to fill in.
+* @param	Length is the number of bytes to read.
+*
+* @return	None
+*
+* @note		Replace with the read function of the real storage device.
+*
+*****************************************************************************/
+void StorageRead(u32 Offset, u8 *BufferPtr, u32 Length)
+{
+	memcpy(BufferPtr, &VirtFlash[Offset], Length);
+}
+
+/****************************************************************************/
+/**
+* This function is the storage back end used for WRITE commands.
+*
+* @param	Offset is the storage offset in bytes.
+* @param	BufferPtr is the data to write.
+* @param	Length is the number of bytes to write.
+*
+* @return	None
+*
+* @note		Replace with the write function of the real storage device.
+*
+*****************************************************************************/
+void StorageWrite(u32 Offset, const u8 *BufferPtr, u32 Length)
+{
+	memcpy(&VirtFlash[Offset], BufferPtr, Length);
+}
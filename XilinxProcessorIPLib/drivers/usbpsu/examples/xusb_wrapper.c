@@ -23,6 +23,7 @@
  *			 UsbEnableEvent API's
  *	 vak	02/07/19 Modified the code to issue XUsbPsu_Ep0StallRestart()
  *			 for Endpoint Zero
+ * 1.11		10/19/26 Added EpQueueSend, EpQueueRecv and EpQueueFree
  *
  * </pre>
  *
@@ -138,6 +139,25 @@ s32 EpBufferRecv(void *InstancePtr, u8 UsbEp,
 			BufferPtr, Length);
 }
 
+s32 EpQueueSend(void *InstancePtr, u8 UsbEp,
+			u8 *BufferPtr, u32 BufferLen)
+{
+	return XUsbPsu_EpQueueSend((struct XUsbPsu *)InstancePtr, UsbEp,
+			BufferPtr, BufferLen);
+}
+
+s32 EpQueueRecv(void *InstancePtr, u8 UsbEp,
+				u8 *BufferPtr, u32 Length)
+{
+	return XUsbPsu_EpQueueRecv((struct XUsbPsu *)InstancePtr, UsbEp,
+			BufferPtr, Length);
+}
+
+u32 EpQueueFree(void *InstancePtr, u8 UsbEp, u8 Dir)
+{
+	return XUsbPsu_EpQueueFree((struct XUsbPsu *)InstancePtr, UsbEp, Dir);
+}
+
 void EpSetStall(void *InstancePtr, u8 Epnum, u8 Dir)
 {
 	if (!Epnum) {
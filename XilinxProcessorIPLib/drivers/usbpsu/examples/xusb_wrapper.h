@@ -22,6 +22,7 @@
  *			 example.
  *  1.5  vak	02/06/19 Add UsbPollHandler and UsbEnableEvent API's
  *  1.7  pm	02/03/20 Add closure bracket for "extern c" c++ compilation
+ *  1.11	10/19/26 Add EpQueueSend, EpQueueRecv and EpQueueFree
  *
  * </pre>
  *
@@ -141,6 +142,11 @@ s32 EpBufferSend(void *InstancePtr, u8 UsbEp,
 			u8 *BufferPtr, u32 BufferLen);
 s32 EpBufferRecv(void *InstancePtr, u8 UsbEp,
 				u8 *BufferPtr, u32 Length);
+s32 EpQueueSend(void *InstancePtr, u8 UsbEp,
+			u8 *BufferPtr, u32 BufferLen);
+s32 EpQueueRecv(void *InstancePtr, u8 UsbEp,
+				u8 *BufferPtr, u32 Length);
+u32 EpQueueFree(void *InstancePtr, u8 UsbEp, u8 Dir);
 void EpSetStall(void *InstancePtr, u8 Epnum, u8 Dir);
 void SetBits(void *InstancePtr, u32 TestSel);
 s32 SetDeviceAddress(void *InstancePtr, u16 Addr);
@@ -91,6 +91,9 @@
 * 1.8	pm    24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.9	pm    03/21/21 Fixed doxygen warnings
 * 1.10	pm    08/30/21 Update MACRO to fix plm compilation warnings
+* 1.11	      10/19/26 Added XUsbPsu_EpQueueSend(), XUsbPsu_EpQueueRecv() and
+*		       XUsbPsu_EpQueueFree() to keep several bulk transfers
+*		       outstanding on the TRB ring of an endpoint
 *
 * </pre>
 *
@@ -444,6 +447,12 @@ typedef struct {
  * @param Interval: Data transfer service interval
  * @param TrbEnqueue: number of TRB enqueue
  * @param TrbDequeue: number of TRB dequeue
+ * @param TrbBufferPtr: Buffer of each TRB queued with XUsbPsu_EpQueueSend()
+ *		or XUsbPsu_EpQueueRecv()
+ * @param TrbRequested: Bytes programmed in each queued TRB
+ * @param TrbSubmitted: Number of TRBs queued, written by the submitter only
+ * @param TrbCompleted: Number of queued TRBs completed, written by the
+ *		event handler only
  * @param MaxSize: Size of endpoint
  * @param CurUf: current microframe
  * @param BufferPtr: Buffer location
@@ -480,6 +489,14 @@ struct XUsbPsu_Ep {
 	u32	Interval;	/**< Data transfer service interval */
 	u32	TrbEnqueue;	/**< number of TRB enqueue */
 	u32	TrbDequeue;	/**< number of TRB dequeue */
+	u8	*TrbBufferPtr[NO_OF_TRB_PER_EP];	/**< Buffer of each
+							 *   queued TRB
+							 */
+	u32	TrbRequested[NO_OF_TRB_PER_EP];	/**< Bytes programmed in
+							 *   each queued TRB
+							 */
+	u32	TrbSubmitted;	/**< Number of TRBs queued */
+	u32	TrbCompleted;	/**< Number of queued TRBs completed */
 	u16	MaxSize;	/**< Size of endpoint */
 	u16	CurUf;		/**< current microframe */
 	u8	*BufferPtr;	/**< Buffer location */
@@ -917,6 +934,11 @@ s32 XUsbPsu_EpBufferSend(struct XUsbPsu *InstancePtr, u8 UsbEp,
 				u8 *BufferPtr, u32 BufferLen);
 s32 XUsbPsu_EpBufferRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
 				u8 *BufferPtr, u32 Length);
+s32 XUsbPsu_EpQueueSend(struct XUsbPsu *InstancePtr, u8 UsbEp,
+				u8 *BufferPtr, u32 BufferLen);
+s32 XUsbPsu_EpQueueRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
+				u8 *BufferPtr, u32 Length);
+u32 XUsbPsu_EpQueueFree(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir);
 void XUsbPsu_EpSetStall(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_EpClearStall(struct XUsbPsu *InstancePtr, u8 Epnum, u8 Dir);
 void XUsbPsu_SetEpHandler(struct XUsbPsu *InstancePtr, u8 Epnum,
@@ -19,6 +19,8 @@
 * 1.0   pm  03/03/20 First release
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
 * 1.10	pm  24/07/21 Fixed MISRA-C and Coverity warnings
+* 1.11	    10/19/26 Reset the queued TRB counters on endpoint enable
+*		    10/19/26 Clear HWO on the TRBs of a disabled endpoint
 *
 * </pre>
 *
@@ -108,6 +110,8 @@ s32 XUsbPsu_EpEnable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
 	if (InstancePtr->IsHibernated == (u8)FALSE) {
 		Ept->TrbEnqueue	= 0U;
 		Ept->TrbDequeue	= 0U;
+		Ept->TrbSubmitted = 0U;
+		Ept->TrbCompleted = 0U;
 	}
 
 	if (((Ept->EpStatus & XUSBPSU_EP_ENABLED) == 0U)
@@ -204,8 +208,7 @@ s32 XUsbPsu_EpDisable(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir)
 	Ept->Type = 0U;
 	Ept->EpStatus = 0U;
 	Ept->MaxSize = 0U;
-	Ept->TrbEnqueue	= 0U;
-	Ept->TrbDequeue	= 0U;
+	XUsbPsu_EpDropTrbs(InstancePtr, Ept);
 
 	return (s32)XST_SUCCESS;
 }
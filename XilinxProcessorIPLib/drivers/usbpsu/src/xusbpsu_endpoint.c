@@ -26,6 +26,8 @@
 *	pm  28/08/19 Removed 80-character warnings
 * 1.7 	pm  23/03/20 Restructured the code for more readability and modularity
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
+* 1.11	    10/19/26 Enabled XferInProgress events on bulk endpoints for
+*		     queued TRBs
 *
 * </pre>
 *
@@ -194,6 +196,14 @@ s32 XUsbPsu_SetEpConfig(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
 		Params->Param1 |= XUSBPSU_DEPCFG_XFER_IN_PROGRESS_EN;
 	}
 
+	/*
+	 * TRBs queued by XUsbPsu_EpQueueSend()/XUsbPsu_EpQueueRecv() are
+	 * not last TRBs, their completion is reported by XferInProgress
+	 */
+	if (Ept->Type == XUSBPSU_ENDPOINT_XFER_BULK) {
+		Params->Param1 |= XUSBPSU_DEPCFG_XFER_IN_PROGRESS_EN;
+	}
+
 	return XUsbPsu_SendEpCmd(InstancePtr, UsbEpNum, Dir,
 						 XUSBPSU_DEPCMD_SETEPCONFIG,
 						 Params);
@@ -18,6 +18,9 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.0   pm  03/23/20 First release
 * 1.8	pm  24/07/20 Fixed MISRA-C and Coverity warnings
+* 1.11	    10/19/26 Added queued bulk transfers with per TRB completion
+*		    10/19/26 Hand dropped TRBs back to software on stop and
+*			     deactivate
 *
 * </pre>
 *
@@ -92,6 +95,42 @@ void XUsbPsu_StopTransfer(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 
 	Ept->EpStatus &= ~XUSBPSU_EP_BUSY;
 	XUsbPsu_Sleep(100U);
+
+	/* TRBs not completed are dropped with the transfer */
+	XUsbPsu_EpDropTrbs(InstancePtr, Ept);
+}
+
+/****************************************************************************/
+/**
+* Takes back all TRBs of an Endpoint from the controller after its transfer
+* has ended. HWO is cleared on every TRB of the ring so that the next Start
+* Transfer does not run TRBs of the dropped transfer, and the ring restarts
+* at its first TRB.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+*
+* @return	None.
+*
+* @note		None.
+*
+****************************************************************************/
+void XUsbPsu_EpDropTrbs(struct XUsbPsu *InstancePtr, struct XUsbPsu_Ep *Ept)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < NO_OF_TRB_PER_EP; Index++) {
+		Ept->EpTrb[Index].Ctrl &= ~XUSBPSU_TRB_CTRL_HWO;
+	}
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheFlushRange((INTPTR)Ept->EpTrb,
+			sizeof(struct XUsbPsu_Trb) * NO_OF_TRB_PER_EP);
+	}
+
+	Ept->TrbEnqueue = 0U;
+	Ept->TrbDequeue = 0U;
+	Ept->TrbCompleted = Ept->TrbSubmitted;
 }
 
 /****************************************************************************/
@@ -133,8 +172,9 @@ void XUsbPsu_EpTransferDeactive(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 		Ept->Type = 0U;
 		Ept->EpStatus = 0U;
 		Ept->MaxSize = 0U;
-		Ept->TrbEnqueue = 0U;
-		Ept->TrbDequeue = 0U;
+		XUsbPsu_EpDropTrbs(InstancePtr, Ept);
+		Ept->TrbSubmitted = 0U;
+		Ept->TrbCompleted = 0U;
 	}
 }
 
@@ -514,6 +554,232 @@ s32 XUsbPsu_EpBufferRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
 	return (s32)XST_SUCCESS;
 }
 
+/****************************************************************************/
+/**
+* Queues a TRB on the TRB ring of a bulk Endpoint and starts or updates the
+* transfer.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	Ept is a pointer to the Endpoint.
+* @param	BufferPtr is pointer to data. This data buffer is cache-aligned.
+* @param	Length is length of data buffer.
+*
+* @return
+*		- XST_SUCCESS if the TRB is queued.
+*		- XST_DEVICE_BUSY if all TRBs of the Endpoint are in use.
+*		- XST_FAILURE if the Endpoint command fails.
+*
+* @note		The TRB is not a last TRB, so the transfer stays active and
+*		further TRBs are added with Update Transfer.
+*
+*****************************************************************************/
+static s32 XUsbPsu_EpQueueTrb(struct XUsbPsu *InstancePtr,
+			struct XUsbPsu_Ep *Ept, u8 *BufferPtr, u32 Length)
+{
+	struct XUsbPsu_Trb	*TrbPtr;
+	struct XUsbPsu_EpParams *Params;
+	u32	Index;
+	u32	Size;
+	u32	cmd;
+	s32	RetVal;
+
+	if (Ept->Type != XUSBPSU_ENDPOINT_XFER_BULK) {
+		return (s32)XST_FAILURE;
+	}
+
+	if ((Ept->TrbSubmitted - Ept->TrbCompleted) >= NO_OF_TRB_PER_EP) {
+		return (s32)XST_DEVICE_BUSY;
+	}
+
+	/*
+	 * 8.2.5 - An OUT transfer size must be a multiple of MaxPacketSize
+	 */
+	Size = Length;
+	if ((Ept->Direction == XUSBPSU_EP_DIR_OUT) &&
+			(!IS_ALIGNED(Length, Ept->MaxSize))) {
+		Size = (u32)roundup(Length, (u32)Ept->MaxSize);
+	}
+
+	Index = Ept->TrbEnqueue;
+	TrbPtr = &Ept->EpTrb[Index];
+	Ept->TrbBufferPtr[Index] = BufferPtr;
+	Ept->TrbRequested[Index] = Size;
+
+	TrbPtr->BufferPtrLow  = (UINTPTR)BufferPtr;
+	TrbPtr->BufferPtrHigh = ((UINTPTR)BufferPtr >> 16U) >> 16U;
+	TrbPtr->Size = Size & XUSBPSU_TRB_SIZE_MASK;
+	TrbPtr->Ctrl = (XUSBPSU_TRBCTL_NORMAL
+			| XUSBPSU_TRB_CTRL_HWO
+			| XUSBPSU_TRB_CTRL_IOC
+			| XUSBPSU_TRB_CTRL_ISP_IMI);
+	if (Ept->Direction == XUSBPSU_EP_DIR_OUT) {
+		/* A short packet completes this TRB only */
+		TrbPtr->Ctrl |= XUSBPSU_TRB_CTRL_CSP;
+	}
+
+	if (InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U) {
+		Xil_DCacheFlushRange((INTPTR)TrbPtr,
+					 sizeof(struct XUsbPsu_Trb));
+		if (Ept->Direction == XUSBPSU_EP_DIR_IN) {
+			Xil_DCacheFlushRange((INTPTR)BufferPtr, Length);
+		} else {
+			Xil_DCacheInvalidateRange((INTPTR)BufferPtr, Size);
+		}
+	}
+
+	Ept->TrbEnqueue++;
+	if (Ept->TrbEnqueue == NO_OF_TRB_PER_EP) {
+		Ept->TrbEnqueue = 0U;
+	}
+	Ept->TrbSubmitted++;
+
+	Params = XUsbPsu_GetEpParams(InstancePtr);
+	Xil_AssertNonvoid(Params != NULL);
+	Params->Param0 = 0U;
+	Params->Param1 = (UINTPTR)TrbPtr;
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) != (u32)0U) {
+		cmd = XUSBPSU_DEPCMD_UPDATETRANSFER;
+		cmd |= XUSBPSU_DEPCMD_PARAM(Ept->ResourceIndex);
+	} else {
+		cmd = XUSBPSU_DEPCMD_STARTTRANSFER;
+	}
+
+	RetVal = XUsbPsu_SendEpCmd(InstancePtr, Ept->UsbEpNum, Ept->Direction,
+								cmd, Params);
+	if (RetVal != (s32)XST_SUCCESS) {
+		return (s32)XST_FAILURE;
+	}
+
+	if ((Ept->EpStatus & XUSBPSU_EP_BUSY) == (u32)0U) {
+		Ept->ResourceIndex = (u8)XUsbPsu_EpGetTransferIndex(InstancePtr,
+				Ept->UsbEpNum,
+				Ept->Direction);
+
+		Ept->EpStatus |= XUSBPSU_EP_BUSY;
+	}
+
+	return (s32)XST_SUCCESS;
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Queues data to be sent on a bulk Endpoint to Host. Up to NO_OF_TRB_PER_EP
+* buffers can be queued; the Endpoint handler is called once per buffer, in
+* the order the buffers were queued.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEp is USB endpoint number.
+* @param	BufferPtr is pointer to data. This data buffer is cache-aligned.
+* @param	BufferLen is length of data buffer.
+*
+* @return
+*		- XST_SUCCESS if the buffer is queued.
+*		- XST_DEVICE_BUSY if all TRBs of the Endpoint are in use.
+*		- XST_FAILURE otherwise.
+*
+* @note		Do not call XUsbPsu_EpBufferSend() on the same Endpoint
+*		while queued buffers are outstanding. The function may be
+*		called from the Endpoint handler.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpQueueSend(struct XUsbPsu *InstancePtr, u8 UsbEp,
+						 u8 *BufferPtr, u32 BufferLen)
+{
+	u8	PhyEpNum;
+	struct XUsbPsu_Ep *Ept;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(BufferLen <= XUSBPSU_TRB_SIZE_MASK);
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEp, XUSBPSU_EP_DIR_IN);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if (Ept->Direction != XUSBPSU_EP_DIR_IN) {
+		return (s32)XST_FAILURE;
+	}
+
+	return XUsbPsu_EpQueueTrb(InstancePtr, Ept, BufferPtr, BufferLen);
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Queues a buffer to receive data on a bulk Endpoint from Host. Up to
+* NO_OF_TRB_PER_EP buffers can be queued; the Endpoint handler is called once
+* per buffer, in the order the buffers were queued.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEp is USB endpoint number.
+* @param	BufferPtr is pointer to data. This data buffer is cache-aligned.
+* @param	Length is length of data to be received. The buffer must hold
+*		Length rounded up to the maximum packet size.
+*
+* @return
+*		- XST_SUCCESS if the buffer is queued.
+*		- XST_DEVICE_BUSY if all TRBs of the Endpoint are in use.
+*		- XST_FAILURE otherwise.
+*
+* @note		Do not call XUsbPsu_EpBufferRecv() on the same Endpoint
+*		while queued buffers are outstanding. The function may be
+*		called from the Endpoint handler.
+*
+*****************************************************************************/
+s32 XUsbPsu_EpQueueRecv(struct XUsbPsu *InstancePtr, u8 UsbEp,
+						 u8 *BufferPtr, u32 Length)
+{
+	u8	PhyEpNum;
+	struct XUsbPsu_Ep *Ept;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid((UsbEp > (u8)0U) && (UsbEp <= (u8)16U));
+	Xil_AssertNonvoid(BufferPtr != NULL);
+	Xil_AssertNonvoid(Length <= XUSBPSU_TRB_SIZE_MASK);
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEp, XUSBPSU_EP_DIR_OUT);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	if (Ept->Direction != XUSBPSU_EP_DIR_OUT) {
+		return (s32)XST_FAILURE;
+	}
+
+	return XUsbPsu_EpQueueTrb(InstancePtr, Ept, BufferPtr, Length);
+}
+
+/****************************************************************************/
+/**
+* @brief
+* Returns the number of buffers that can still be queued on an Endpoint.
+*
+* @param	InstancePtr is a pointer to the XUsbPsu instance.
+* @param	UsbEp is USB endpoint number.
+* @param	Dir is direction of endpoint
+* 				- XUSBPSU_EP_DIR_IN/XUSBPSU_EP_DIR_OUT.
+*
+* @return	Number of free TRBs.
+*
+* @note		None.
+*
+*****************************************************************************/
+u32 XUsbPsu_EpQueueFree(struct XUsbPsu *InstancePtr, u8 UsbEp, u8 Dir)
+{
+	u8	PhyEpNum;
+	struct XUsbPsu_Ep *Ept;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(UsbEp <= (u8)16U);
+	Xil_AssertNonvoid((Dir == XUSBPSU_EP_DIR_IN) ||
+						(Dir == XUSBPSU_EP_DIR_OUT));
+
+	PhyEpNum = XUSBPSU_PhysicalEp(UsbEp, Dir);
+	Ept = &InstancePtr->eps[PhyEpNum];
+
+	return NO_OF_TRB_PER_EP - (Ept->TrbSubmitted - Ept->TrbCompleted);
+}
+
 /****************************************************************************/
 /**
 * @brief
@@ -672,6 +938,7 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 	struct XUsbPsu_Trb	*TrbPtr;
 	u32	Length;
 	u32	Epnum;
+	u32	Index;
 	u8	Dir;
 
 	Xil_AssertVoid(InstancePtr != NULL);
@@ -680,7 +947,8 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 	Epnum = Event->Epnumber;
 	Ept = &InstancePtr->eps[Epnum];
 	Dir = Ept->Direction;
-	TrbPtr = &Ept->EpTrb[Ept->TrbDequeue];
+	Index = Ept->TrbDequeue;
+	TrbPtr = &Ept->EpTrb[Index];
 
 	Ept->TrbDequeue++;
 	if (Ept->TrbDequeue == NO_OF_TRB_PER_EP) {
@@ -697,6 +965,27 @@ void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
 		Ept->ResourceIndex = 0U;
 	}
 
+	if (Ept->TrbSubmitted != Ept->TrbCompleted) {
+		/* TRB queued by XUsbPsu_EpQueueSend()/XUsbPsu_EpQueueRecv() */
+		Length = TrbPtr->Size & XUSBPSU_TRB_SIZE_MASK;
+		Ept->RequestedBytes = Ept->TrbRequested[Index];
+		Ept->BytesTxed = Ept->RequestedBytes - Length;
+		Ept->BufferPtr = Ept->TrbBufferPtr[Index];
+		Ept->TrbCompleted++;
+
+		if ((Dir == XUSBPSU_EP_DIR_OUT) &&
+			(InstancePtr->ConfigPtr->IsCacheCoherent == (u8)0U)) {
+			Xil_DCacheInvalidateRange((INTPTR)Ept->BufferPtr,
+							 Ept->BytesTxed);
+		}
+
+		if (Ept->Handler != NULL) {
+			Ept->Handler(InstancePtr->AppData, Ept->RequestedBytes,
+							 Ept->BytesTxed);
+		}
+		return;
+	}
+
 	Length = TrbPtr->Size & XUSBPSU_TRB_SIZE_MASK;
 
 	if (Length == 0U) {
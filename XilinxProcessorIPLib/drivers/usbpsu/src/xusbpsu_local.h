@@ -19,6 +19,7 @@
 * ----- -----  -------- -----------------------------------------------------
 * 1.0   pm    03/23/20 First release
 * 1.9   pm    03/15/21 Fixed doxygen warnings
+* 1.11        10/19/26 Added XUsbPsu_EpDropTrbs()
 *
 * </pre>
 *
@@ -76,6 +77,7 @@ s32 XUsbPsu_SendEpCmd(struct XUsbPsu *InstancePtr, u8 UsbEpNum, u8 Dir,
  */
 void XUsbPsu_EpTransferDeactive(struct XUsbPsu *InstancePtr, u8 UsbEpNum,
 								u8 Dir);
+void XUsbPsu_EpDropTrbs(struct XUsbPsu *InstancePtr, struct XUsbPsu_Ep *Ept);
 void XUsbPsu_SaveEndpointState(struct XUsbPsu *InstancePtr,
 				struct XUsbPsu_Ep *Ept);
 void XUsbPsu_EpXferComplete(struct XUsbPsu *InstancePtr,
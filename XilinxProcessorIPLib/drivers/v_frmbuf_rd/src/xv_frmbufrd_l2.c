@@ -34,6 +34,8 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+*             10/19/26   Added XVFrmbufRd_SetFrameQueue()
+*             10/19/26   Rotate the V plane of 3 planar formats
 * </pre>
 *
 ******************************************************************************/
@@ -713,6 +715,72 @@ UINTPTR XVFrmbufRd_GetVChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr)
 	return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+ * This function attaches a frame queue to the core. Frames are then read
+ * from the buffers of the queue: on every frame done interrupt the buffer
+ * just read is released to the producer of the queue and the buffer address
+ * registers are programmed with the next ready frame before the frame done
+ * callback is called. If no frame is ready the same buffer is read again.
+ *
+ * @param  InstancePtr is a pointer to core instance to be worked upon
+ * @param  FrameQ is a pointer to an initialized frame queue, or NULL to
+ *         detach the queue
+ *
+ * @return XST_SUCCESS if the queue was attached or detached
+ *         XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED if a buffer is not aligned to
+ *         the memory width
+ *
+ * @note   Buffers are only rotated in interrupt mode with the done interrupt
+ *         enabled. The queue must be attached or detached while the core is
+ *         idle. If no frame is ready yet the buffer address registers are
+ *         left unchanged until the first frame arrives.
+ *
+ ******************************************************************************/
+int XVFrmbufRd_SetFrameQueue(XV_FrmbufRd_l2 *InstancePtr,
+		XVidC_FrameQ *FrameQ)
+{
+	XVidC_FrameBuf *Buf;
+	UINTPTR Align;
+	u8 Index;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	if (FrameQ == NULL) {
+		InstancePtr->FrameQ = NULL;
+		InstancePtr->FrameQBuf = NULL;
+		return(XST_SUCCESS);
+	}
+
+	/* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+	Align = 2 * InstancePtr->FrmbufRd.Config.PixPerClk * 4;
+	for (Index = 0; Index < FrameQ->NumBufs; Index++) {
+		if (((FrameQ->Buf[Index].Addr % Align) != 0) ||
+		    ((FrameQ->Buf[Index].ChromaAddr % Align) != 0) ||
+		    ((FrameQ->Buf[Index].VChromaAddr % Align) != 0)) {
+			return(XVFRMBUFRD_ERR_MEM_ADDR_MISALIGNED);
+		}
+	}
+
+	Buf = XVidC_FrameQGetReadBuf(FrameQ);
+	if (Buf != NULL) {
+		XV_frmbufrd_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufRd,
+				Buf->Addr);
+		if (Buf->ChromaAddr != 0) {
+			XV_frmbufrd_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufRd,
+					Buf->ChromaAddr);
+		}
+		if (Buf->VChromaAddr != 0) {
+			XV_frmbufrd_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufRd,
+					Buf->VChromaAddr);
+		}
+	}
+
+	InstancePtr->FrameQBuf = Buf;
+	InstancePtr->FrameQ = FrameQ;
+	return(XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 * This function sets the buffer address for the UV plane for semi-planar formats
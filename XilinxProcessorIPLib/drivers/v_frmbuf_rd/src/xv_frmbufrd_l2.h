@@ -70,6 +70,12 @@
 *     is done/ready. If call back is registered such function will be called and
 *     application can apply new setting updates here. Subsequently next frame
 *     processing will be triggered with new settings.
+*   - Frames can be read from a set of buffers managed by a frame queue
+*     (see xvidc_frameq.h) attached with XVFrmbufRd_SetFrameQueue(). On
+*     every frame done interrupt the buffer just read is released to the
+*     producer of the queue and the next ready frame is programmed before
+*     the frame done callback is called. If no frame is ready the same
+*     buffer is read again.
 *   - To use polling method disable interrupts using the provided API. Doing so
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
@@ -98,6 +104,8 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  kp    13/07/21   Added new 3 planar video format Y_U_V8
 * 4.60  kp    12/03/21   Added new 3 planar video format Y_U_V10
+*             10/19/26   Added XVFrmbufRd_SetFrameQueue() for frame queue
+*                        based buffer rotation
 * </pre>
 *
 ******************************************************************************/
@@ -109,6 +117,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_frameq.h"
 #include "xv_frmbufrd.h"
 
 /************************** Constant Definitions *****************************/
@@ -170,6 +179,11 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Output AXIS */
+
+    XVidC_FrameQ *FrameQ;        /**< Frame queue serviced by the frame done
+                                      interrupt, NULL if not used */
+    XVidC_FrameBuf *FrameQBuf;   /**< Frame queue buffer programmed in the
+                                      core */
 }XV_FrmbufRd_l2;
 
 /************************** Macros Definitions *******************************/
@@ -672,6 +686,8 @@ UINTPTR XVFrmbufRd_GetChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr);
 int XVFrmbufRd_SetVChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr,
                               UINTPTR Addr);
 UINTPTR XVFrmbufRd_GetVChromaBufferAddr(XV_FrmbufRd_l2 *InstancePtr);
+int XVFrmbufRd_SetFrameQueue(XV_FrmbufRd_l2 *InstancePtr,
+                             XVidC_FrameQ *FrameQ);
 int XVFrmbufRd_SetFieldID(XV_FrmbufRd_l2 *InstancePtr,
                           u32 FieldID);
 u32 XVFrmbufRd_GetFieldID(XV_FrmbufRd_l2 *InstancePtr);
@@ -23,6 +23,8 @@
 * 4.20  pg    01/31/20   Removed Frmbuf start function from Interrupt handler.
 * 4.50  pg    01/07/21   Added new registers to support fid_out interlace solution.
 *						Interrupt count support for throughput measurement.
+*             10/19/26   Rotate frame queue buffers on frame done
+*             10/19/26   Rotate the V plane of 3 planar formats
 * </pre>
 *
 ******************************************************************************/
@@ -111,6 +113,7 @@ int XVFrmbufRd_SetCallback(XV_FrmbufRd_l2 *InstancePtr, u32 HandlerType,
 void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 {
 	XV_FrmbufRd_l2 *FrmbufRdPtr = (XV_FrmbufRd_l2 *)InstancePtr;
+	XVidC_FrameBuf *Buf;
 	u32 Status;
 
 	/* Verify arguments */
@@ -124,6 +127,24 @@ void XVFrmbufRd_InterruptHandler(void *InstancePtr)
 	if(Status & XVFRMBUFRD_IRQ_DONE_MASK) {
 		/* Clear the interrupt */
 		XV_frmbufrd_InterruptClear(&FrmbufRdPtr->FrmbufRd, XVFRMBUFRD_IRQ_DONE_MASK);
+		/* Release the buffer just read and program the next frame */
+		if(FrmbufRdPtr->FrameQ) {
+			Buf = XVidC_FrameQSwapReadBuf(FrmbufRdPtr->FrameQ,
+					FrmbufRdPtr->FrameQBuf);
+			if(Buf && (Buf != FrmbufRdPtr->FrameQBuf)) {
+				XV_frmbufrd_Set_HwReg_frm_buffer_V(&FrmbufRdPtr->FrmbufRd,
+						Buf->Addr);
+				if(Buf->ChromaAddr) {
+					XV_frmbufrd_Set_HwReg_frm_buffer2_V(&FrmbufRdPtr->FrmbufRd,
+							Buf->ChromaAddr);
+				}
+				if(Buf->VChromaAddr) {
+					XV_frmbufrd_Set_HwReg_frm_buffer3_V(&FrmbufRdPtr->FrmbufRd,
+							Buf->VChromaAddr);
+				}
+				FrmbufRdPtr->FrameQBuf = Buf;
+			}
+		}
 		//Call user registered callback function, if any
 		if(FrmbufRdPtr->FrameDoneCallback) {
 			FrmbufRdPtr->FrameDoneCallback(FrmbufRdPtr->CallbackDoneRef);
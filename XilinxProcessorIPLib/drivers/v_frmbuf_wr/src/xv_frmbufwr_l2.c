@@ -34,6 +34,8 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
+*             10/19/26   Added XVFrmbufWr_SetFrameQueue()
+*             10/19/26   Rotate the V plane of 3 planar formats
 * </pre>
 *
 ******************************************************************************/
@@ -736,6 +738,73 @@ UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr)
   return(ReadVal);
 }
 
+/*****************************************************************************/
+/**
+* This function attaches a frame queue to the core. Frames are then written
+* into the buffers of the queue: on every frame done interrupt the written
+* buffer is passed to the consumer of the queue and the buffer address
+* registers are programmed with the next free buffer before the frame done
+* callback is called.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  FrameQ is a pointer to an initialized frame queue, or NULL to
+*         detach the queue
+*
+* @return XST_SUCCESS if the queue was attached or detached
+*         XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED if a buffer is not aligned to
+*         the memory width
+*         XST_FAILURE if the queue has no free buffer
+*
+* @note   Buffers are only rotated in interrupt mode with the done interrupt
+*         enabled. The queue must be attached or detached while the core is
+*         idle.
+*
+******************************************************************************/
+int XVFrmbufWr_SetFrameQueue(XV_FrmbufWr_l2 *InstancePtr,
+                             XVidC_FrameQ *FrameQ)
+{
+  XVidC_FrameBuf *Buf;
+  UINTPTR Align;
+  u8 Index;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+
+  if (FrameQ == NULL) {
+    InstancePtr->FrameQ = NULL;
+    InstancePtr->FrameQBuf = NULL;
+    return(XST_SUCCESS);
+  }
+
+  /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+  Align = 2 * InstancePtr->FrmbufWr.Config.PixPerClk * 4;
+  for (Index = 0; Index < FrameQ->NumBufs; Index++) {
+    if (((FrameQ->Buf[Index].Addr % Align) != 0) ||
+        ((FrameQ->Buf[Index].ChromaAddr % Align) != 0) ||
+        ((FrameQ->Buf[Index].VChromaAddr % Align) != 0)) {
+      return(XVFRMBUFWR_ERR_MEM_ADDR_MISALIGNED);
+    }
+  }
+
+  Buf = XVidC_FrameQGetWriteBuf(FrameQ);
+  if (Buf == NULL) {
+    return(XST_FAILURE);
+  }
+
+  XV_frmbufwr_Set_HwReg_frm_buffer_V(&InstancePtr->FrmbufWr, Buf->Addr);
+  if (Buf->ChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer2_V(&InstancePtr->FrmbufWr,
+                                        Buf->ChromaAddr);
+  }
+  if (Buf->VChromaAddr != 0) {
+    XV_frmbufwr_Set_HwReg_frm_buffer3_V(&InstancePtr->FrmbufWr,
+                                        Buf->VChromaAddr);
+  }
+
+  InstancePtr->FrameQBuf = Buf;
+  InstancePtr->FrameQ = FrameQ;
+  return(XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 * This function reads the field ID
@@ -70,6 +70,12 @@
 *     is done/ready. If call back is registered such function will be called and
 *     application can apply new setting updates here. Subsequently next frame
 *     processing will be triggered with new settings.
+*   - Frames can be written into a set of buffers managed by a frame queue
+*     (see xvidc_frameq.h) attached with XVFrmbufWr_SetFrameQueue(). On
+*     every frame done interrupt the written buffer is passed to the
+*     consumer of the queue and the next free buffer is programmed before
+*     the frame done callback is called. If no buffer is free the frame is
+*     dropped and the same buffer is written again.
 *   - To use polling method disable interrupts using the provided API. Doing so
 *     will configure the IP to keep processing frames without sw intervention.
 *   - Polling mode is the default configuration set during driver initialization
@@ -98,6 +104,8 @@
 * 4.10  vv    02/05/19   Added new pixel formats with 12 and 16 bpc.
 * 4.50  kp    12/07/21   Added new 3 planar video format Y_U_V8.
 * 4.60  kp    10/27/21   Added new 3 planar video format Y_U_V10.
+*             10/19/26   Added XVFrmbufWr_SetFrameQueue() for frame queue
+*                        based buffer rotation
 * </pre>
 *
 ******************************************************************************/
@@ -109,6 +117,7 @@ extern "C" {
 #endif
 
 #include "xvidc.h"
+#include "xvidc_frameq.h"
 #include "xv_frmbufwr.h"
 
 /************************** Constant Definitions *****************************/
@@ -170,6 +179,11 @@ typedef struct {
                                 callback */
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVidC_FrameQ *FrameQ;        /**< Frame queue serviced by the frame done
+                                      interrupt, NULL if not used */
+    XVidC_FrameBuf *FrameQBuf;   /**< Frame queue buffer programmed in the
+                                      core */
 }XV_FrmbufWr_l2;
 
 /************************** Macros Definitions *******************************/
@@ -627,6 +641,8 @@ UINTPTR XVFrmbufWr_GetChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
 int XVFrmbufWr_SetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr,
                               UINTPTR Addr);
 UINTPTR XVFrmbufWr_GetVChromaBufferAddr(XV_FrmbufWr_l2 *InstancePtr);
+int XVFrmbufWr_SetFrameQueue(XV_FrmbufWr_l2 *InstancePtr,
+                             XVidC_FrameQ *FrameQ);
 u32 XVFrmbufWr_GetFieldID(XV_FrmbufWr_l2 *InstancePtr);
 void XVFrmbufWr_DbgReportStatus(XV_FrmbufWr_l2 *InstancePtr);
 
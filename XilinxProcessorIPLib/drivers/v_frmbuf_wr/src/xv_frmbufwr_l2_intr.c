@@ -21,6 +21,8 @@
 * 1.00  vyc   04/05/17   Initial Release
 * 3.00  vyc   04/04/18   Add interrupt handler for ap_ready
 * 4.20  pg    01/31/20   Removed Frmbufwr_start function from Interrupt handler
+*             10/19/26   Rotate frame queue buffers on frame done
+*             10/19/26   Rotate the V plane of 3 planar formats
 * </pre>
 *
 ******************************************************************************/
@@ -110,6 +112,7 @@ int XVFrmbufWr_SetCallback(XV_FrmbufWr_l2 *InstancePtr, u32 HandlerType,
 void XVFrmbufWr_InterruptHandler(void *InstancePtr)
 {
   XV_FrmbufWr_l2 *FrmbufWrPtr = (XV_FrmbufWr_l2 *)InstancePtr;
+  XVidC_FrameBuf *Buf;
   u32 Status;
 
   /* Verify arguments */
@@ -123,6 +126,23 @@ void XVFrmbufWr_InterruptHandler(void *InstancePtr)
   if(Status & XVFRMBUFWR_IRQ_DONE_MASK) {
     /* Clear the interrupt */
     XV_frmbufwr_InterruptClear(&FrmbufWrPtr->FrmbufWr, XVFRMBUFWR_IRQ_DONE_MASK);
+    /* Pass the written frame on and program the next free buffer */
+    if(FrmbufWrPtr->FrameQ) {
+      Buf = XVidC_FrameQSwapWriteBuf(FrmbufWrPtr->FrameQ,
+                                     FrmbufWrPtr->FrameQBuf);
+      if(Buf != FrmbufWrPtr->FrameQBuf) {
+        XV_frmbufwr_Set_HwReg_frm_buffer_V(&FrmbufWrPtr->FrmbufWr, Buf->Addr);
+        if(Buf->ChromaAddr) {
+          XV_frmbufwr_Set_HwReg_frm_buffer2_V(&FrmbufWrPtr->FrmbufWr,
+                                              Buf->ChromaAddr);
+        }
+        if(Buf->VChromaAddr) {
+          XV_frmbufwr_Set_HwReg_frm_buffer3_V(&FrmbufWrPtr->FrmbufWr,
+                                              Buf->VChromaAddr);
+        }
+        FrmbufWrPtr->FrameQBuf = Buf;
+      }
+    }
     //Call user registered callback function, if any
     if(FrmbufWrPtr->FrameDoneCallback) {
           FrmbufWrPtr->FrameDoneCallback(FrmbufWrPtr->CallbackDoneRef);
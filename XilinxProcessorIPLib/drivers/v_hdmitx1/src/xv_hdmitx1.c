@@ -17,6 +17,7 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- -------------------------------------------------------
 * 1.00  EB     22/05/18 Initial release.
+*              10/19/26 Initialize the FRL training result cache.
 * </pre>
 *
 ******************************************************************************/
@@ -126,6 +127,9 @@ int XV_HdmiTx1_CfgInitialize(XV_HdmiTx1 *InstancePtr, XV_HdmiTx1_Config *CfgPtr,
 	/* Maximum FRL Rate Supported */
 	InstancePtr->Stream.Frl.MaxFrlRate =  InstancePtr->Config.MaxFrlRate;
 
+	/* No cached FRL training result in use */
+	InstancePtr->FrlCache.Active = -1;
+
 	/* Clear HDMI variables */
 	XV_HdmiTx1_Clear(InstancePtr);
 
@@ -96,6 +96,7 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00  EB     22/05/18 Initial release.
+*              10/19/26 Added FRL training result cache and statistics.
 * </pre>
 *
 ******************************************************************************/
@@ -410,6 +411,16 @@ typedef struct {
 						  *  MTW Start */
 	void *DynHdrMtwRef;			/**< To be passed to the
 						  *  Dynamic HDR callback */
+
+	/* FRL training */
+	XV_HdmiTx1_FrlCache FrlCache;		/**< FRL training result
+						  *  cache */
+	XV_HdmiTx1_FrlTrainingStats FrlStats;	/**< Statistics of the last
+						  *  FRL training */
+	XV_HdmiTx1_FrlTimeFunc FrlTimeFunc;	/**< Optional time source for
+						  *  the FRL statistics */
+	void *FrlTimeRef;			/**< To be passed to the FRL
+						  *  time function */
 	/* Aux peripheral specific */
 	XHdmiC_Aux Aux;                         /**< AUX peripheral information */
 	XV_HdmiC_VrrInfoFrame VrrIF;		/**< VRR infoframe SPDIF or VTEM */
@@ -1531,6 +1542,13 @@ void XV_HdmiTx1_SetFrl10MicroSecondsTimer(XV_HdmiTx1 *InstancePtr);
 void XV_HdmiTx1_SetFrlWrongLtp(XV_HdmiTx1 *InstancePtr);
 void XV_HdmiTx1_ClearFrlWrongLtp(XV_HdmiTx1 *InstancePtr);
 u8 *XV_HdmiTx1_GetScdcEdRegisters(XV_HdmiTx1 *InstancePtr);
+void XV_HdmiTx1_SetFrlSinkId(XV_HdmiTx1 *InstancePtr, u32 SinkId);
+void XV_HdmiTx1_ClearFrlSinkId(XV_HdmiTx1 *InstancePtr);
+void XV_HdmiTx1_FlushFrlCache(XV_HdmiTx1 *InstancePtr);
+void XV_HdmiTx1_SetFrlTimeFunc(XV_HdmiTx1 *InstancePtr,
+		XV_HdmiTx1_FrlTimeFunc TimeFunc, void *TimeRef);
+const XV_HdmiTx1_FrlTrainingStats *
+XV_HdmiTx1_GetFrlTrainingStats(XV_HdmiTx1 *InstancePtr);
 void  XV_HdmiTx1_Start(XV_HdmiTx1 *InstancePtr);
 void  XV_HdmiTx1_Stop(XV_HdmiTx1 *InstancePtr);
 
@@ -17,6 +17,12 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- -------------------------------------------------------
 * 1.00  EB     22/05/18 Initial release.
+*              10/19/26 Start FRL training from the cached result of the
+*                       last successful training with the same sink and
+*                       record the time spent in each training state.
+*              10/19/26 Restart from the requested rate when the cached
+*                       rate fails.
+*              10/19/26 Added XV_HdmiTx1_ClearFrlSinkId.
 * </pre>
 *
 ******************************************************************************/
@@ -48,6 +54,12 @@ static int XV_HdmiTx1_ExecFrlState_Lts3(XV_HdmiTx1 *InstancePtr);
 static int XV_HdmiTx1_ExecFrlState_Lts4(XV_HdmiTx1 *InstancePtr);
 static int XV_HdmiTx1_ExecFrlState_LtsP_Arm(XV_HdmiTx1 *InstancePtr);
 static int XV_HdmiTx1_ExecFrlState_LtsP(XV_HdmiTx1 *InstancePtr);
+static XV_HdmiTx1_FrlCacheEntry *XV_HdmiTx1_FrlCacheFind(
+		XV_HdmiTx1 *InstancePtr, u8 MaxFrlRate);
+static void XV_HdmiTx1_FrlCacheDrop(XV_HdmiTx1 *InstancePtr);
+static void XV_HdmiTx1_FrlCacheStore(XV_HdmiTx1 *InstancePtr);
+static void XV_HdmiTx1_FrlStatsUpdate(XV_HdmiTx1 *InstancePtr);
+static void XV_HdmiTx1_FrlStatsDone(XV_HdmiTx1 *InstancePtr, u8 FrlRate);
 
 /************************** Variable Definitions *****************************/
 
@@ -110,6 +122,8 @@ int XV_HdmiTx1_StartFrlTraining(XV_HdmiTx1 *InstancePtr,
 		XHdmiC_MaxFrlRate FrlRate)
 {
 	int Status = XST_FAILURE;
+	XV_HdmiTx1_FrlCacheEntry *Entry;
+	XV_HdmiTx1_FrlTrainingStats *Stats = &InstancePtr->FrlStats;
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 
@@ -120,6 +134,34 @@ int XV_HdmiTx1_StartFrlTraining(XV_HdmiTx1 *InstancePtr,
 		InstancePtr->Stream.Frl.FrlRate = FrlRate;
 	}
 
+	/* Retry the rate that passed the last time with this sink first */
+	InstancePtr->FrlCache.RequestedRate = InstancePtr->Stream.Frl.FrlRate;
+	Entry = XV_HdmiTx1_FrlCacheFind(InstancePtr,
+					InstancePtr->Stream.Frl.FrlRate);
+	if (Entry != NULL) {
+		InstancePtr->Stream.Frl.FrlRate = Entry->FrlRate;
+		InstancePtr->FrlCache.Active =
+				(s8)(Entry - InstancePtr->FrlCache.Entry);
+		InstancePtr->FrlCache.Hits++;
+	} else {
+		InstancePtr->FrlCache.Active = -1;
+		InstancePtr->FrlCache.Misses++;
+	}
+
+	(void)memset((void *)Stats->StateTime, 0, sizeof(Stats->StateTime));
+	Stats->TotalTime = 0;
+	Stats->StartRate = InstancePtr->Stream.Frl.FrlRate;
+	Stats->FrlRate = 0;
+	Stats->RateDrops = 0;
+	Stats->FfeAdjusts = 0;
+	Stats->FromCache = (Entry != NULL) ? TRUE : FALSE;
+	Stats->TimerWait = 0;
+	if (InstancePtr->FrlTimeFunc) {
+		Stats->LastStamp =
+			InstancePtr->FrlTimeFunc(InstancePtr->FrlTimeRef);
+	}
+	Stats->IsRunning = TRUE;
+
 	InstancePtr->Stream.Frl.LineRate =
 			FrlRateTable[InstancePtr->Stream.Frl.FrlRate].LineRate;
 	InstancePtr->Stream.Frl.Lanes =
@@ -130,9 +172,10 @@ int XV_HdmiTx1_StartFrlTraining(XV_HdmiTx1 *InstancePtr,
 
 #ifdef DEBUG_TX_FRL_VERBOSITY
 	xil_printf(ANSI_COLOR_CYAN "TX: Start FRL training (%d lanes "
-		   "@ %d Gbps, FRL_Rate: %d)\r\n" ANSI_COLOR_RESET,
+		   "@ %d Gbps, FRL_Rate: %d%s)\r\n" ANSI_COLOR_RESET,
 		   InstancePtr->Stream.Frl.Lanes,
-		   InstancePtr->Stream.Frl.LineRate, InstancePtr->Stream.Frl.FrlRate);
+		   InstancePtr->Stream.Frl.LineRate, InstancePtr->Stream.Frl.FrlRate,
+		   (Entry != NULL) ? ", cached" : "");
 #endif
 
 	/* Clear timer event flag*/
@@ -300,6 +343,27 @@ static int XV_HdmiTx1_ExecFrlState_Lts1(XV_HdmiTx1 *InstancePtr)
 
 	/* Make sure sink version > 0 */
 	if (Status == (XST_SUCCESS) && DdcBuf != 0) {
+		InstancePtr->FrlCache.SinkVersion = DdcBuf;
+
+		/* A cached result only applies to the same SCDC capabilities,
+		 * otherwise train from the requested rate. The FRL rate is
+		 * only written to the sink in LTS:3, so it can still be
+		 * changed here. */
+		if (InstancePtr->FrlCache.Active >= 0 &&
+		    InstancePtr->FrlCache.Entry[InstancePtr->FrlCache.Active].
+						SinkVersion != DdcBuf) {
+			XV_HdmiTx1_FrlCacheDrop(InstancePtr);
+			InstancePtr->Stream.Frl.FrlRate =
+					InstancePtr->FrlCache.RequestedRate;
+			InstancePtr->Stream.Frl.LineRate = FrlRateTable[
+				InstancePtr->Stream.Frl.FrlRate].LineRate;
+			InstancePtr->Stream.Frl.Lanes = FrlRateTable[
+				InstancePtr->Stream.Frl.FrlRate].Lanes;
+			InstancePtr->FrlStats.StartRate =
+					InstancePtr->Stream.Frl.FrlRate;
+			InstancePtr->FrlStats.FromCache = FALSE;
+		}
+
 		Status = XV_HdmiTx1_DdcWriteField(InstancePtr,
 						  XV_HDMITX1_SCDCFIELD_SOURCE_VER,
 						  1);
@@ -396,8 +460,15 @@ static int XV_HdmiTx1_ExecFrlState_Lts2(XV_HdmiTx1 *InstancePtr)
 			/* Start FRL rate with maximum supported rate */
 /*			}*/
 
-			/* Reset LaneFfeAdjReq so application can reset TxFFE */
-			InstancePtr->Stream.Frl.LaneFfeAdjReq.Data = 0;
+			/* Reset LaneFfeAdjReq so application can reset TxFFE,
+			 * or start from the TxFFE that passed with this sink */
+			if (InstancePtr->FrlCache.Active >= 0) {
+				InstancePtr->Stream.Frl.LaneFfeAdjReq.Data =
+					InstancePtr->FrlCache.Entry[
+					InstancePtr->FrlCache.Active].LaneFfe.Data;
+			} else {
+				InstancePtr->Stream.Frl.LaneFfeAdjReq.Data = 0;
+			}
 
 			if (InstancePtr->FrlFfeCallback) {
 				InstancePtr->FrlFfeCallback(InstancePtr->FrlFfeRef);
@@ -681,6 +752,10 @@ xil_printf("\r\n" ANSI_COLOR_RESET);
 		/* Execute FRL register update*/
 		XV_HdmiTx1_FrlExecute(InstancePtr);
 
+		if (FfeAdjFlag == TRUE) {
+			InstancePtr->FrlStats.FfeAdjusts++;
+		}
+
 		if (InstancePtr->FrlFfeCallback && FfeAdjFlag == TRUE) {
 			InstancePtr->FrlFfeCallback(InstancePtr->FrlFfeRef);
 		}
@@ -712,6 +787,7 @@ xil_printf("\r\n" ANSI_COLOR_RESET);
 static int XV_HdmiTx1_ExecFrlState_Lts4(XV_HdmiTx1 *InstancePtr)
 {
 	int Status = XST_FAILURE;
+	u8 Restart;
 
 	/* Disable TimerCnt */
 	XV_HdmiTx1_SetFrlTimer(InstancePtr, 0);
@@ -719,8 +795,28 @@ static int XV_HdmiTx1_ExecFrlState_Lts4(XV_HdmiTx1 *InstancePtr)
 	/* Stops transmitting link training patterns */
 	XV_HdmiTx1_ClearFrlLtp(InstancePtr);
 
-	if (InstancePtr->Stream.Frl.RateLock == FALSE) {
+	/* The cached rate no longer passes with this sink */
+	Restart = (InstancePtr->FrlCache.Active >= 0 &&
+		   InstancePtr->Stream.Frl.FrlRate <
+		   InstancePtr->FrlCache.RequestedRate) ? TRUE : FALSE;
+	XV_HdmiTx1_FrlCacheDrop(InstancePtr);
+
+	if (Restart == TRUE) {
+		/* Restart the full training from the requested rate rather
+		 * than stepping down from the cached one */
+		InstancePtr->Stream.Frl.FrlRate =
+				InstancePtr->FrlCache.RequestedRate;
+		InstancePtr->Stream.Frl.LineRate = FrlRateTable[
+			InstancePtr->Stream.Frl.FrlRate].LineRate;
+		InstancePtr->Stream.Frl.Lanes = FrlRateTable[
+			InstancePtr->Stream.Frl.FrlRate].Lanes;
+		InstancePtr->FrlStats.StartRate =
+				InstancePtr->Stream.Frl.FrlRate;
+		InstancePtr->FrlStats.FromCache = FALSE;
+		Status = XST_SUCCESS;
+	} else if (InstancePtr->Stream.Frl.RateLock == FALSE) {
 		if (InstancePtr->Stream.Frl.FrlRate > 1) {
+			InstancePtr->FrlStats.RateDrops++;
 			InstancePtr->Stream.Frl.FrlRate--;
 			InstancePtr->Stream.Frl.LineRate = FrlRateTable[InstancePtr->Stream.Frl.FrlRate].LineRate;
 			InstancePtr->Stream.Frl.Lanes = FrlRateTable[InstancePtr->Stream.Frl.FrlRate].Lanes;
@@ -933,11 +1029,18 @@ int XV_HdmiTx1_ExecFrlState(XV_HdmiTx1 *InstancePtr)
 
 	Xil_AssertNonvoid(InstancePtr != NULL);
 
+	XV_HdmiTx1_FrlStatsUpdate(InstancePtr);
+
 	switch (InstancePtr->Stream.Frl.TrainingState) {
 
 		case XV_HDMITX1_FRLSTATE_LTS_L:
 			Status = XV_HdmiTx1_ExecFrlState_LtsL(InstancePtr);
 			Status = XST_SUCCESS;
+			/* Training failed, do not retry the cached rate */
+			if (InstancePtr->FrlStats.IsRunning == TRUE) {
+				XV_HdmiTx1_FrlCacheDrop(InstancePtr);
+				XV_HdmiTx1_FrlStatsDone(InstancePtr, 0);
+			}
 			break;
 
 		case XV_HDMITX1_FRLSTATE_LTS_1:
@@ -993,6 +1096,15 @@ int XV_HdmiTx1_ExecFrlState(XV_HdmiTx1 *InstancePtr)
 /*		xil_printf("TX:S:FAILURE!\r\n");*/
 	}
 
+	/* Training passed, remember the result for the next connect */
+	if (InstancePtr->Stream.Frl.TrainingState ==
+	    XV_HDMITX1_FRLSTATE_LTS_P_FRL_RDY &&
+	    InstancePtr->FrlStats.IsRunning == TRUE) {
+		XV_HdmiTx1_FrlCacheStore(InstancePtr);
+		XV_HdmiTx1_FrlStatsDone(InstancePtr,
+					InstancePtr->Stream.Frl.FrlRate);
+	}
+
 	/* Clear timer event flag */
 	InstancePtr->Stream.Frl.TimerEvent = FALSE;
 
@@ -1467,6 +1579,7 @@ void XV_HdmiTx1_SetFrlTimer(XV_HdmiTx1 *InstancePtr, u32 Milliseconds)
 	} else {
 		ClockCycles = 0;
 	}
+	InstancePtr->FrlStats.TimerWait = Milliseconds * 1000;
 	XV_HdmiTx1_WriteReg((InstancePtr)->Config.BaseAddress,
 			(XV_HDMITX1_FRL_TMR_OFFSET),
 			(ClockCycles));
@@ -1532,6 +1645,7 @@ void XV_HdmiTx1_SetFrl10MicroSecondsTimer(XV_HdmiTx1 *InstancePtr)
 	u32 ClockCycles;
 
 	ClockCycles = InstancePtr->Config.AxiLiteClkFreq / 100000;
+	InstancePtr->FrlStats.TimerWait = 10;
 
 	XV_HdmiTx1_WriteReg((InstancePtr)->Config.BaseAddress,
 			    (XV_HDMITX1_FRL_TMR_OFFSET),
@@ -1573,3 +1687,300 @@ void XV_HdmiTx1_ClearFrlWrongLtp(XV_HdmiTx1 *InstancePtr)
 {
 	InstancePtr->Stream.Frl.DBSendWrongLTP = (FALSE);
 }
+
+/*****************************************************************************/
+/**
+*
+* This function sets the identifier of the connected sink used to look up
+* the result of the last successful FRL link training with it. The
+* identifier is typically a hash of the sink's EDID and is cleared when the
+* sink is disconnected.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @param	SinkId is the sink identifier.
+*
+* @return	None.
+*
+* @note		Call before XV_HdmiTx1_StartFrlTraining after every connect,
+*		training starts from the requested FRL rate otherwise.
+*
+******************************************************************************/
+void XV_HdmiTx1_SetFrlSinkId(XV_HdmiTx1 *InstancePtr, u32 SinkId)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->FrlCache.SinkId = SinkId;
+	InstancePtr->FrlCache.SinkIdValid = TRUE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function clears the identifier of the connected sink. Cached FRL link
+* training results are kept but not used until a sink identifier is set
+* again.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XV_HdmiTx1_ClearFrlSinkId(XV_HdmiTx1 *InstancePtr)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->FrlCache.SinkIdValid = FALSE;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function discards all cached FRL link training results. The next
+* training with any sink starts from the requested FRL rate.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XV_HdmiTx1_FlushFrlCache(XV_HdmiTx1 *InstancePtr)
+{
+	u8 Index;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (Index = 0; Index < XV_HDMITX1_FRL_CACHE_SIZE; Index++) {
+		InstancePtr->FrlCache.Entry[Index].IsValid = FALSE;
+	}
+	InstancePtr->FrlCache.Active = -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the time source used to measure the time spent in each
+* FRL training state.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @param	TimeFunc returns the current time, NULL to estimate the times
+*		from the FRL timer periods.
+*
+* @param	TimeRef is passed to TimeFunc.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+void XV_HdmiTx1_SetFrlTimeFunc(XV_HdmiTx1 *InstancePtr,
+		XV_HdmiTx1_FrlTimeFunc TimeFunc, void *TimeRef)
+{
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	InstancePtr->FrlTimeFunc = TimeFunc;
+	InstancePtr->FrlTimeRef = TimeRef;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the statistics of the last FRL link training.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @return	Pointer to the statistics.
+*
+* @note		The statistics are final once IsRunning is cleared.
+*
+******************************************************************************/
+const XV_HdmiTx1_FrlTrainingStats *
+XV_HdmiTx1_GetFrlTrainingStats(XV_HdmiTx1 *InstancePtr)
+{
+	Xil_AssertNonvoid(InstancePtr != NULL);
+
+	return &InstancePtr->FrlStats;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function looks up the cached training result for the connected sink.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @param	MaxFrlRate is the highest FRL rate allowed for the training.
+*
+* @return	Pointer to the matching entry, NULL if there is none.
+*
+* @note		None.
+*
+******************************************************************************/
+static XV_HdmiTx1_FrlCacheEntry *XV_HdmiTx1_FrlCacheFind(
+		XV_HdmiTx1 *InstancePtr, u8 MaxFrlRate)
+{
+	XV_HdmiTx1_FrlCache *Cache = &InstancePtr->FrlCache;
+	u8 Index;
+
+	if (Cache->SinkIdValid == FALSE) {
+		return NULL;
+	}
+
+	for (Index = 0; Index < XV_HDMITX1_FRL_CACHE_SIZE; Index++) {
+		if (Cache->Entry[Index].IsValid == TRUE &&
+		    Cache->Entry[Index].SinkId == Cache->SinkId &&
+		    Cache->Entry[Index].MaxFrlRate == MaxFrlRate) {
+			Cache->Entry[Index].LastUsed = ++Cache->Stamp;
+			return &Cache->Entry[Index];
+		}
+	}
+
+	return NULL;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function invalidates the cache entry used by the current training.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XV_HdmiTx1_FrlCacheDrop(XV_HdmiTx1 *InstancePtr)
+{
+	XV_HdmiTx1_FrlCache *Cache = &InstancePtr->FrlCache;
+
+	if (Cache->Active >= 0) {
+		Cache->Entry[Cache->Active].IsValid = FALSE;
+		Cache->Active = -1;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function stores the result of a successful training. The entry with
+* the same key is updated, otherwise a free or the least recently used entry
+* is replaced. Nothing is stored when the training did not start from the
+* requested rate or from its cached entry.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XV_HdmiTx1_FrlCacheStore(XV_HdmiTx1 *InstancePtr)
+{
+	XV_HdmiTx1_FrlCache *Cache = &InstancePtr->FrlCache;
+	XV_HdmiTx1_FrlCacheEntry *Entry = NULL;
+	u8 Index;
+
+	/* Only a training that stepped down from the requested rate, or a
+	 * cached rate that passed again, tells which rate to use for it */
+	if (Cache->SinkIdValid == FALSE ||
+	    (InstancePtr->FrlStats.FromCache == FALSE &&
+	     InstancePtr->FrlStats.StartRate != Cache->RequestedRate)) {
+		Cache->Active = -1;
+		return;
+	}
+
+	for (Index = 0; Index < XV_HDMITX1_FRL_CACHE_SIZE; Index++) {
+		if (Cache->Entry[Index].IsValid == TRUE &&
+		    Cache->Entry[Index].SinkId == Cache->SinkId &&
+		    Cache->Entry[Index].MaxFrlRate == Cache->RequestedRate) {
+			Entry = &Cache->Entry[Index];
+			break;
+		}
+		if (Entry == NULL || (Entry->IsValid == TRUE &&
+		    (Cache->Entry[Index].IsValid == FALSE ||
+		     Cache->Entry[Index].LastUsed < Entry->LastUsed))) {
+			Entry = &Cache->Entry[Index];
+		}
+	}
+
+	Entry->IsValid = TRUE;
+	Entry->SinkId = Cache->SinkId;
+	Entry->SinkVersion = Cache->SinkVersion;
+	Entry->MaxFrlRate = Cache->RequestedRate;
+	Entry->FrlRate = InstancePtr->Stream.Frl.FrlRate;
+	Entry->LaneFfe.Data = InstancePtr->Stream.Frl.LaneFfeAdjReq.Data;
+	Entry->LastUsed = ++Cache->Stamp;
+	Cache->Active = -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function adds the time since the previous state execution to the
+* state the training was waiting in.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XV_HdmiTx1_FrlStatsUpdate(XV_HdmiTx1 *InstancePtr)
+{
+	XV_HdmiTx1_FrlTrainingStats *Stats = &InstancePtr->FrlStats;
+	u32 Elapsed;
+	u64 Now;
+
+	if (Stats->IsRunning == FALSE) {
+		return;
+	}
+
+	if (InstancePtr->FrlTimeFunc) {
+		Now = InstancePtr->FrlTimeFunc(InstancePtr->FrlTimeRef);
+		Elapsed = (u32)(Now - Stats->LastStamp);
+		Stats->LastStamp = Now;
+	} else {
+		Elapsed = Stats->TimerWait;
+	}
+	Stats->TimerWait = 0;
+
+	Stats->StateTime[InstancePtr->Stream.Frl.TrainingState] += Elapsed;
+	Stats->TotalTime += Elapsed;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function completes the statistics of the current training.
+*
+* @param	InstancePtr is a pointer to the XHdmi_Tx core instance.
+*
+* @param	FrlRate is the FRL rate that passed, 0 if training failed.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XV_HdmiTx1_FrlStatsDone(XV_HdmiTx1 *InstancePtr, u8 FrlRate)
+{
+	InstancePtr->FrlStats.FrlRate = FrlRate;
+	InstancePtr->FrlStats.IsRunning = FALSE;
+
+#ifdef DEBUG_TX_FRL_VERBOSITY
+	xil_printf(ANSI_COLOR_CYAN "TX: FRL training %s in %d (FRL_Rate: %d, "
+		   "drops: %d, FFE: %d%s)\r\n" ANSI_COLOR_RESET,
+		   FrlRate ? "passed" : "failed",
+		   InstancePtr->FrlStats.TotalTime, FrlRate,
+		   InstancePtr->FrlStats.RateDrops,
+		   InstancePtr->FrlStats.FfeAdjusts,
+		   InstancePtr->FrlStats.FromCache ? ", cached" : "");
+#endif
+}
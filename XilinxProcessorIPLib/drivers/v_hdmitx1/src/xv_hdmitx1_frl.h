@@ -96,6 +96,8 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00  EB     22/05/18 Initial release.
+*              10/19/26 Added FRL training result cache and per state
+*                       training time statistics.
 * </pre>
 *
 ******************************************************************************/
@@ -115,6 +117,14 @@ extern "C" {
 /************************** Constant Definitions *****************************/
 #define XV_HDMITX1_DDC_ADDRESS 0x54
 
+/**
+* Number of sinks for which the result of the last successful FRL link
+* training is remembered. May be overridden at build time.
+*/
+#ifndef XV_HDMITX1_FRL_CACHE_SIZE
+#define XV_HDMITX1_FRL_CACHE_SIZE	4
+#endif
+
 /**************************** Type Definitions *******************************/
 /** @name HDMI TX FRL training state
 * @{
@@ -131,6 +141,9 @@ typedef enum {
 	XV_HDMITX1_FRLSTATE_LTS_P_FRL_RDY	/* LTS:P (FRL_START = 1)*/
 } XV_HdmiTx1_FrlTrainingState;
 
+/** Number of FRL training states */
+#define XV_HDMITX1_FRLSTATE_NUM	(XV_HDMITX1_FRLSTATE_LTS_P_FRL_RDY + 1)
+
 /** @name HDMI TX LTP Type
 * @{
 */
@@ -191,6 +204,85 @@ typedef struct {
 	u32			    DBMessage;
 } XV_HdmiTx1_Frl;
 
+/**
+* Callback type used to time stamp the FRL training states.
+*
+* @param    CallbackRef is the reference passed to
+*           XV_HdmiTx1_SetFrlTimeFunc().
+*
+* @return   Current time in a unit chosen by the application.
+*/
+typedef u64 (*XV_HdmiTx1_FrlTimeFunc)(void *CallbackRef);
+
+/**
+* This typedef contains the result of a successful FRL link training with a
+* sink. The sink is identified by the ID set with XV_HdmiTx1_SetFrlSinkId,
+* typically a hash of its EDID, by the SCDC sink version and by the FRL rate
+* the training was allowed to start from.
+*/
+typedef struct {
+	u8			    IsValid;	/**< Entry holds a result */
+	u32			    SinkId;	/**< Sink identifier */
+	u8			    SinkVersion;/**< SCDC Sink Version */
+	u8			    MaxFrlRate; /**< Highest FRL rate allowed
+						  *  for the training */
+	u8			    FrlRate;	/**< FRL rate that passed */
+	XV_HdmiTx1_FrlFfeAdjType    LaneFfe;	/**< TxFFE level of each lane
+						  *  when training passed */
+	u32			    LastUsed;	/**< Age stamp for
+						  *  replacement */
+} XV_HdmiTx1_FrlCacheEntry;
+
+/**
+* This typedef contains the FRL training result cache.
+*/
+typedef struct {
+	XV_HdmiTx1_FrlCacheEntry    Entry[XV_HDMITX1_FRL_CACHE_SIZE];
+	u32			    Stamp;	/**< Age counter */
+	u32			    SinkId;	/**< Current sink identifier */
+	u8			    SinkIdValid;/**< SinkId has been set for
+						  *  the connected sink */
+	u8			    SinkVersion;/**< SCDC Sink Version read in
+						  *  LTS:1 */
+	u8			    RequestedRate; /**< FRL rate requested by
+						     *  the application */
+	s8			    Active;	/**< Entry used by the current
+						  *  training, -1 if none */
+	u32			    Hits;	/**< Trainings started from a
+						  *  cached result */
+	u32			    Misses;	/**< Trainings started from the
+						  *  requested rate */
+} XV_HdmiTx1_FrlCache;
+
+/**
+* This typedef contains the statistics of the last FRL link training.
+* Times are in the unit of the function set with XV_HdmiTx1_SetFrlTimeFunc.
+* Without a time function they are estimated in microseconds from the FRL
+* timer periods the state machine waited for, which excludes the time the
+* application takes to reconfigure the transceivers.
+*/
+typedef struct {
+	u32			    StateTime[XV_HDMITX1_FRLSTATE_NUM];
+						/**< Time spent in each
+						  *  training state */
+	u32			    TotalTime;	/**< Total training time */
+	u8			    StartRate;	/**< FRL rate training started
+						  *  from */
+	u8			    FrlRate;	/**< FRL rate that passed, 0 if
+						  *  training failed */
+	u8			    RateDrops;	/**< Number of LTS:4 rate
+						  *  drops */
+	u8			    FfeAdjusts; /**< Number of TxFFE
+						  *  adjustments */
+	u8			    FromCache;	/**< Training started from a
+						  *  cached result */
+	u8			    IsRunning;	/**< Training in progress */
+	u32			    TimerWait;	/**< Period of the FRL timer
+						  *  armed last, microseconds */
+	u64			    LastStamp;	/**< Time of the last state
+						  *  execution */
+} XV_HdmiTx1_FrlTrainingStats;
+
 /*****************************************************************************/
 /**
 *
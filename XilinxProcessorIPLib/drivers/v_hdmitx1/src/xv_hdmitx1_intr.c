@@ -17,6 +17,7 @@
 * Ver   Who    Date     Changes
 * ----- ------ -------- --------------------------------------------------
 * 1.00  EB     22/05/18 Initial release.
+*              10/19/26 Clear the FRL sink identifier on disconnect.
 * </pre>
 *
 ******************************************************************************/
@@ -388,6 +389,10 @@ static void HdmiTx1_PioIntrHandler(XV_HdmiTx1 *InstancePtr)
 			/* Clear connected flag*/
 			InstancePtr->Stream.IsConnected = (FALSE);
 
+			/* The next sink must be identified again before its
+			 * FRL training can use a cached result */
+			XV_HdmiTx1_ClearFrlSinkId(InstancePtr);
+
 			/* On HPD disconnect data mover may hang. So disable */
 			XV_HdmiTx1_DynHdr_DM_Disable(InstancePtr);
 		}
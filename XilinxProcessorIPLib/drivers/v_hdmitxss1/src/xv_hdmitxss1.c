@@ -17,6 +17,8 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+*            10/19/26 Identify the sink for the FRL training cache from its
+*                     EDID and forget it on hotplug.
 * </pre>
 *
 ******************************************************************************/
@@ -1001,6 +1003,9 @@ static void XV_HdmiTxSs1_ConnectCallback(void *CallbackRef)
     /* Reset DDC */
     XV_HdmiTx1_DdcDisable(HdmiTxSs1Ptr->HdmiTx1Ptr);
 
+    /* The sink is identified again when its EDID is read */
+    XV_HdmiTx1_ClearFrlSinkId(HdmiTxSs1Ptr->HdmiTx1Ptr);
+
     /* Set stream connected flag */
     HdmiTxSs1Ptr->IsStreamConnected = (TRUE);
 
@@ -1026,6 +1031,9 @@ static void XV_HdmiTxSs1_ConnectCallback(void *CallbackRef)
     /* Reset DDC */
     XV_HdmiTx1_DdcDisable(HdmiTxSs1Ptr->HdmiTx1Ptr);
 
+    /* Cached FRL training results must not be used for the next sink */
+    XV_HdmiTx1_ClearFrlSinkId(HdmiTxSs1Ptr->HdmiTx1Ptr);
+
     /* Set stream connected flag */
     HdmiTxSs1Ptr->IsStreamConnected = (FALSE);
 
@@ -1637,7 +1645,8 @@ int XV_HdmiTxSs1_SetLogCallback(XV_HdmiTxSs1 *InstancePtr,
 *
 * @return None.
 *
-* @note   None.
+* @note   The sink is identified for the FRL training cache from the EDID
+*         that was read.
 *
 ******************************************************************************/
 int XV_HdmiTxSs1_ReadEdid(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer)
@@ -1660,6 +1669,10 @@ int XV_HdmiTxSs1_ReadEdid(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer)
         Status = XV_HdmiTx1_DdcRead(InstancePtr->HdmiTx1Ptr, 0x50, 256, Buffer,
             (TRUE));
       }
+
+      if (Status == (XST_SUCCESS)) {
+        XV_HdmiTxSs1_SetFrlSinkEdid(InstancePtr, Buffer, 256);
+      }
     }
   return Status;
 }
@@ -1671,7 +1684,7 @@ int XV_HdmiTxSs1_ReadEdid(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer)
 *
 * @return None.
 *
-* @note   None.
+* @note   Reading segment 0 identifies the sink for the FRL training cache.
 *
 ******************************************************************************/
 int XV_HdmiTxSs1_ReadEdidSegment(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer, u8 segment)
@@ -1726,6 +1739,11 @@ int XV_HdmiTxSs1_ReadEdidSegment(XV_HdmiTxSs1 *InstancePtr, u8 *Buffer, u8 segme
         Status = XV_HdmiTx1_DdcRead(InstancePtr->HdmiTx1Ptr, 0x50, 128, &Buffer[128],
             (TRUE));
       }
+
+      /* The base block and first extension identify the sink */
+      if ((segment == 0) && (Status == (XST_SUCCESS))) {
+        XV_HdmiTxSs1_SetFrlSinkEdid(InstancePtr, Buffer, 256);
+      }
     }
     else {
       xil_printf("No sink is connected.\r\n");
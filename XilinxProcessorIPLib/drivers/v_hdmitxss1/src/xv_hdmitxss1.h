@@ -32,6 +32,7 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+*            10/19/26 Added FRL training result cache and statistics API.
 * </pre>
 *
 ******************************************************************************/
@@ -683,6 +684,12 @@ void XV_HdmiTxSS1_StartFRLStream(XV_HdmiTxSs1 *InstancePtr);
 void XV_HdmiTxSs1_SetFrlExtVidCke(XV_HdmiTxSs1 *InstancePtr);
 void XV_HdmiTxSs1_SetFrlIntVidCke(XV_HdmiTxSs1 *InstancePtr);
 u8 *XV_HdmiTxSs1_GetScdcEdRegisters(XV_HdmiTxSs1 *InstancePtr);
+void XV_HdmiTxSs1_SetFrlSinkEdid(XV_HdmiTxSs1 *InstancePtr, const u8 *EdidPtr,
+				u16 Length);
+void XV_HdmiTxSs1_FlushFrlCache(XV_HdmiTxSs1 *InstancePtr);
+void XV_HdmiTxSs1_SetFrlTimeFunc(XV_HdmiTxSs1 *InstancePtr,
+				XV_HdmiTx1_FrlTimeFunc TimeFunc, void *TimeRef);
+void XV_HdmiTxSs1_ReportFrlTraining(XV_HdmiTxSs1 *InstancePtr);
 #ifdef __cplusplus
 }
 #endif
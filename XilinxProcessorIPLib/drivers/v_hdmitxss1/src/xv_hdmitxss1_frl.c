@@ -17,6 +17,7 @@
 * Ver   Who    Date     Changes
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  EB   22/05/18 Initial release.
+*            10/19/26 Added FRL training result cache and statistics API.
 * </pre>
 *
 ******************************************************************************/
@@ -476,3 +477,133 @@ void XV_HdmiTxSs1_SetFrlIntVidCke(XV_HdmiTxSs1 *InstancePtr)
 {
 	XV_HdmiTx1_FrlExtVidCkeSource(InstancePtr->HdmiTx1Ptr, FALSE);
 }
+
+/*****************************************************************************/
+/**
+*
+* This function identifies the connected sink from its EDID so that FRL
+* training can start from the result of the last successful training with
+* the same sink.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @param    EdidPtr points to the EDID read from the sink.
+*
+* @param    Length is the number of EDID bytes to identify the sink by.
+*
+* @return   None.
+*
+* @note     Call after reading the EDID and before
+*           XV_HdmiTxSs1_StartFrlTraining on every connect.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_SetFrlSinkEdid(XV_HdmiTxSs1 *InstancePtr, const u8 *EdidPtr,
+		u16 Length)
+{
+	u32 Hash = 0x811C9DC5;
+	u16 Index;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(InstancePtr != NULL);
+	Xil_AssertVoid(EdidPtr != NULL);
+
+	/* FNV-1a */
+	for (Index = 0; Index < Length; Index++) {
+		Hash ^= EdidPtr[Index];
+		Hash *= 0x01000193;
+	}
+
+	XV_HdmiTx1_SetFrlSinkId(InstancePtr->HdmiTx1Ptr, Hash);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function discards all cached FRL training results.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_FlushFrlCache(XV_HdmiTxSs1 *InstancePtr)
+{
+	/* Verify argument. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	XV_HdmiTx1_FlushFrlCache(InstancePtr->HdmiTx1Ptr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the time source used for the FRL training statistics.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @param    TimeFunc returns the current time, NULL to estimate the times
+*           in microseconds from the FRL timer periods.
+*
+* @param    TimeRef is passed to TimeFunc.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_SetFrlTimeFunc(XV_HdmiTxSs1 *InstancePtr,
+		XV_HdmiTx1_FrlTimeFunc TimeFunc, void *TimeRef)
+{
+	/* Verify argument. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	XV_HdmiTx1_SetFrlTimeFunc(InstancePtr->HdmiTx1Ptr, TimeFunc, TimeRef);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function prints the time spent in each state of the last FRL
+* training.
+*
+* @param    InstancePtr is a pointer to the XV_HdmiTxSs1 core instance.
+*
+* @return   None.
+*
+* @note     None.
+*
+******************************************************************************/
+void XV_HdmiTxSs1_ReportFrlTraining(XV_HdmiTxSs1 *InstancePtr)
+{
+	const XV_HdmiTx1_FrlTrainingStats *Stats;
+	static const char *StateName[XV_HDMITX1_FRLSTATE_NUM] = {
+		"LTS:L", "LTS:1", "LTS:2", "LTS:3 (ARM)", "LTS:3", "LTS:4",
+		"LTS:P (ARM)", "LTS:P", "LTS:P (FRL_RDY)"
+	};
+	u8 State;
+
+	/* Verify argument. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	Stats = XV_HdmiTx1_GetFrlTrainingStats(InstancePtr->HdmiTx1Ptr);
+
+	xil_printf("FRL training: %s\r\n", Stats->IsRunning ? "running" :
+		   (Stats->FrlRate ? "passed" : "failed"));
+	xil_printf("Start FRL rate : %d%s\r\n", Stats->StartRate,
+		   Stats->FromCache ? " (cached)" : "");
+	xil_printf("FRL rate       : %d\r\n", Stats->FrlRate);
+	xil_printf("Rate drops     : %d\r\n", Stats->RateDrops);
+	xil_printf("FFE adjusts    : %d\r\n", Stats->FfeAdjusts);
+	for (State = 0; State < XV_HDMITX1_FRLSTATE_NUM; State++) {
+		if (Stats->StateTime[State] != 0) {
+			xil_printf("%s : %d\r\n", StateName[State],
+				   Stats->StateTime[State]);
+		}
+	}
+	xil_printf("Total          : %d\r\n", Stats->TotalTime);
+	xil_printf("Cache hits/misses : %d/%d\r\n",
+		   InstancePtr->HdmiTx1Ptr->FrlCache.Hits,
+		   InstancePtr->HdmiTx1Ptr->FrlCache.Misses);
+}
@@ -30,6 +30,8 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.3   vsa   04/07/20   Improve quality with better coefficient tables
+*             10/18/26   Skip coefficient upload when the selected table is
+*                        already programmed and only upload changed phases
 * </pre>
 *
 ******************************************************************************/
@@ -47,6 +49,12 @@
 #define XHSC_MASK_LOW_20BITS	   (0x000FFFFF)
 #define XHSC_MASK_LOW_12BITS	   (0x00000FFF)
 
+/* Phase dirty bitmap accessors */
+#define XHSC_PHASE_IS_DIRTY(HscPtr, Idx) \
+	(((HscPtr)->PhaseDirty[(Idx) >> 5] >> ((Idx) & 31U)) & 1U)
+#define XHSC_PHASE_SET_DIRTY(HscPtr, Idx) \
+	((HscPtr)->PhaseDirty[(Idx) >> 5] |= ((u32)1U << ((Idx) & 31U)))
+
 /**************************** Type Definitions *******************************/
 
 /**************************** Local Global *******************************/
@@ -66,9 +74,9 @@ extern const short XV_hscaler_fixedcoeff_taps10_ScalingRatio4[XV_HSCALER_MAX_H_P
 extern const short XV_hscaler_fixedcoeff_taps12_ScalingRatio4[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_TAPS_12];
 
 /************************** Function Prototypes ******************************/
-static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
-                                  u32 WidthIn,
-                                  u32 WidthOut);
+static const short *XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
+                                          u32 WidthIn,
+                                          u32 WidthOut);
 static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
                             u32 WidthIn,
                             u32 WidthOut,
@@ -133,6 +141,27 @@ void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr)
   XV_hscaler_DisableAutoRestart(&InstancePtr->Hsc);
 }
 
+/*****************************************************************************/
+/**
+* This function invalidates the cached coefficient table and phases so that
+* the next call to XV_HScalerSetup() programs them in full. It must be called
+* if the core register bank contents are lost (e.g. after the core has been
+* re-initialized or powered down)
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_HScalerInvalidateCache(XV_Hscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffLoaded   = NULL;
+  InstancePtr->PhaseWidthIn  = 0;
+  InstancePtr->PhaseWidthOut = 0;
+}
+
 /*****************************************************************************/
 /**
 * This function determines the internal coeffiecient table to be used based on
@@ -143,12 +172,15 @@ void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr)
 * @param  WidthIn is the input stream width
 * @param  Widthout is the output stream width
 *
-* @return None
+* @return Pointer to the selected table, NULL if the tap count is not supported
+*
+* @note   The table is copied to the coefficient storage only if it differs
+*         from the one currently programmed in the core
 *
 ******************************************************************************/
-static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
-                                  u32 WidthIn,
-                                  u32 WidthOut)
+static const short *XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
+                                          u32 WidthIn,
+                                          u32 WidthOut)
 {
   const short *coeff;
   u16 numTaps, numPhases;
@@ -158,7 +190,7 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
   /*
    * validate input arguments
    */
-  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(InstancePtr != NULL);
 
   numPhases = (1<<InstancePtr->Hsc.Config.PhaseShift);
 
@@ -238,7 +270,7 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
            break;
 
       default:
-          return;
+          return NULL;
     }
   }
   else //Scale Up
@@ -247,13 +279,18 @@ static void XV_HScalerSelectCoeff(XV_Hscaler_l2 *InstancePtr,
 	numTaps = XV_HSCALER_TAPS_6;
   }
 
-  XV_HScalerLoadExtCoeff(InstancePtr,
-                         numPhases,
-                         numTaps,
-                         coeff);
+  if(coeff != InstancePtr->CoeffLoaded)
+  {
+    XV_HScalerLoadExtCoeff(InstancePtr,
+                           numPhases,
+                           numTaps,
+                           coeff);
+  }
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+
+  return coeff;
 }
 
 /*****************************************************************************/
@@ -326,14 +363,16 @@ void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
     }
   }
 
-  /* Enable use of external coefficients */
+  /* Enable use of external coefficients, core copy is now stale */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffLoaded = NULL;
 }
 
 /*****************************************************************************/
 /**
 * This function calculates the phases for 1 line. Same phase info is used for
-* full frame
+* full frame. Entries which differ from the previously calculated ones are
+* marked dirty for XV_HScalerSetPhase()
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
 * @param  WidthIn is the input frame width
@@ -355,6 +394,7 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
     u64 OutputWriteEn;
     int GetNewPix;
     u64 PhaseH;
+    u64 PhaseLo, PhaseHi;
     u64 arrayIdx;
     int xReadPos = 0;
     int nrRds = 0;
@@ -367,8 +407,8 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
     arrayIdx = 0;
     for (x=0; x<loopWidth; x++)
     {
-        HscPtr->phasesH[x] = 0;
-	HscPtr->phasesH_H[x] = 0;
+        PhaseLo = 0;
+	PhaseHi = 0;
 	nrRdsClck = 0;
         for (s=0; s<HscPtr->Hsc.Config.PixPerClk; s++)
         {
@@ -396,28 +436,35 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 	    if (HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_8)
 	    {
 		    if (s < 4 ) {
-			    HscPtr->phasesH[x] |= (PhaseH << (s*11));
-			    HscPtr->phasesH[x] |= (arrayIdx << (6 + (s*11)));
-			    HscPtr->phasesH[x] |= (OutputWriteEn << (10 + (s*11)));
+			    PhaseLo |= (PhaseH << (s*11));
+			    PhaseLo |= (arrayIdx << (6 + (s*11)));
+			    PhaseLo |= (OutputWriteEn << (10 + (s*11)));
 		    } else {
-			    HscPtr->phasesH_H[x] |= (PhaseH << ((s-4)*11));
-			    HscPtr->phasesH_H[x] |= (arrayIdx << (6 + ((s-4)*11)));
-			    HscPtr->phasesH_H[x] |= (OutputWriteEn << (10 + ((s-4)*11)));
+			    PhaseHi |= (PhaseH << ((s-4)*11));
+			    PhaseHi |= (arrayIdx << (6 + ((s-4)*11)));
+			    PhaseHi |= (OutputWriteEn << (10 + ((s-4)*11)));
 		    }
 	    } else if (HscPtr->Hsc.Config.PixPerClk == XVIDC_PPC_4) {
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (PhaseH << (s*10));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (arrayIdx << (6 + (s*10)));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (OutputWriteEn << (9 + (s*10)));
+              PhaseLo = PhaseLo | (PhaseH << (s*10));
+              PhaseLo = PhaseLo | (arrayIdx << (6 + (s*10)));
+              PhaseLo = PhaseLo | (OutputWriteEn << (9 + (s*10)));
             }
             else
             {
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (PhaseH << (s*9));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (arrayIdx << (6 + (s*9)));
-              HscPtr->phasesH[x] = HscPtr->phasesH[x] | (OutputWriteEn << (8 + (s*9)));
+              PhaseLo = PhaseLo | (PhaseH << (s*9));
+              PhaseLo = PhaseLo | (arrayIdx << (6 + (s*9)));
+              PhaseLo = PhaseLo | (OutputWriteEn << (8 + (s*9)));
             }
 
             if (GetNewPix) nrRdsClck++;
         }
+
+        if ((PhaseLo != HscPtr->phasesH[x]) || (PhaseHi != HscPtr->phasesH_H[x]))
+        {
+            HscPtr->phasesH[x]   = PhaseLo;
+            HscPtr->phasesH_H[x] = PhaseHi;
+            XHSC_PHASE_SET_DIRTY(HscPtr, (u32)x);
+        }
         if (arrayIdx>=HscPtr->Hsc.Config.PixPerClk)
             arrayIdx &= (HscPtr->Hsc.Config.PixPerClk-1);
 
@@ -429,7 +476,8 @@ static void CalculatePhases(XV_Hscaler_l2 *HscPtr,
 
 /*****************************************************************************/
 /**
-* This function programs the phase data into core registers
+* This function programs the phase data into core registers. Only entries
+* marked dirty by CalculatePhases() are written
 *
 * @param  HscPtr is a pointer to the core instance to be worked on.
 *
@@ -460,6 +508,12 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               index = 0;
               for(i=0; i < loopWidth; i+=2)
               {
+                if(!XHSC_PHASE_IS_DIRTY(HscPtr, i) &&
+                   !XHSC_PHASE_IS_DIRTY(HscPtr, i+1))
+                {
+                  ++index;
+                  continue;
+                }
                 lsb = (u32)(HscPtr->phasesH[i]   & (u64)XHSC_MASK_LOW_16BITS);
                 msb = (u32)(HscPtr->phasesH[i+1] & (u64)XHSC_MASK_LOW_16BITS);
                 val = (msb<<16 | lsb);
@@ -478,6 +532,10 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
                */
               for(i=0; i < loopWidth; ++i)
               {
+                if(!XHSC_PHASE_IS_DIRTY(HscPtr, i))
+                {
+                  continue;
+                }
                 val = (u32)(HscPtr->phasesH[i] & XHSC_MASK_LOW_32BITS);
                 Xil_Out32(baseAddr+(i*4), val);
               }
@@ -497,6 +555,12 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
               offset = 0;
               for(i=0; i < loopWidth; ++i)
               {
+                if(!XHSC_PHASE_IS_DIRTY(HscPtr, index))
+                {
+                  ++index;
+                  offset += 2;
+                  continue;
+                }
                 phaseHData = HscPtr->phasesH[index];
                 lsb = (u32)(phaseHData & XHSC_MASK_LOW_32BITS);
                 msb = (u32)((phaseHData>>32) & XHSC_MASK_LOW_32BITS);
@@ -522,6 +586,11 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
 		index = 0;
 		offset = 0;
 		for(i=0; i < loopWidth; i++) {
+			if(!XHSC_PHASE_IS_DIRTY(HscPtr, index)) {
+				offset += 4;
+				index++;
+				continue;
+			}
 			bits_0_31 = 0;
 			bits_32_63 = 0;
 			bits_64_95 = 0;
@@ -547,6 +616,8 @@ static void XV_HScalerSetPhase(XV_Hscaler_l2 *HscPtr)
     default:
            break;
   }
+
+  memset(HscPtr->PhaseDirty, 0, sizeof(HscPtr->PhaseDirty));
 }
 
 
@@ -607,6 +678,7 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
                      u32 ColorFormatOut)
 {
   u32 PixelRate;
+  const short *CoeffTable;
 
   /*
    * Assert validates the input arguments
@@ -630,17 +702,40 @@ int XV_HScalerSetup(XV_Hscaler_l2  *InstancePtr,
     if(!InstancePtr->UseExtCoeff)  //No user defined coefficients
     {
       /* Determine coefficient table to use */
-      XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
+      CoeffTable = XV_HScalerSelectCoeff(InstancePtr, WidthIn, WidthOut);
+    }
+    else
+    {
+      CoeffTable = &InstancePtr->coeff[0][0];
+    }
+
+    /* Program coefficients into the IP register bank, if not already there */
+    if(CoeffTable != InstancePtr->CoeffLoaded)
+    {
+      XV_HScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = CoeffTable;
     }
-    /* Program generated coefficients into the IP register bank */
-    XV_HScalerSetCoeff(InstancePtr);
   }
 
-  /* Compute Phase for 1 line */
-  CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
+  /* Phases depend only on the resolution pair, skip if already programmed */
+  if((WidthIn != InstancePtr->PhaseWidthIn) ||
+     (WidthOut != InstancePtr->PhaseWidthOut))
+  {
+    if(InstancePtr->PhaseWidthIn == 0)
+    {
+      /* Register bank content unknown, upload every entry */
+      memset(InstancePtr->PhaseDirty, 0xFF, sizeof(InstancePtr->PhaseDirty));
+    }
+
+    /* Compute Phase for 1 line */
+    CalculatePhases(InstancePtr, WidthIn, WidthOut, PixelRate);
 
-  /* Program computed Phase into the IP register bank */
-  XV_HScalerSetPhase(InstancePtr);
+    /* Program changed Phase entries into the IP register bank */
+    XV_HScalerSetPhase(InstancePtr);
+
+    InstancePtr->PhaseWidthIn  = WidthIn;
+    InstancePtr->PhaseWidthOut = WidthOut;
+  }
 
   XV_hscaler_Set_HwReg_Height(&InstancePtr->Hsc,        HeightIn);
   XV_hscaler_Set_HwReg_WidthIn(&InstancePtr->Hsc,       WidthIn);
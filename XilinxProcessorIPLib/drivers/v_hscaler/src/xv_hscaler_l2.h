@@ -70,6 +70,8 @@
 *       dmc   12/17/15   Add macro to query the Is422Enabled flag that was
 *                        added to the XV_hscaler_Config structure
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
+*             10/18/26   Cache programmed coefficient table and phases, add
+*                        XV_HScalerInvalidateCache()
 * </pre>
 *
 ******************************************************************************/
@@ -126,6 +128,10 @@ typedef struct
   short coeff[XV_HSCALER_MAX_H_PHASES][XV_HSCALER_MAX_H_TAPS];
   u64 phasesH[XV_HSCALER_MAX_LINE_WIDTH];
   u64 phasesH_H[XV_HSCALER_MAX_LINE_WIDTH];
+  const short *CoeffLoaded; /*<< Coefficient table programmed in the core */
+  u32 PhaseWidthIn;         /*<< Input width of programmed phases (0: none) */
+  u32 PhaseWidthOut;        /*<< Output width of programmed phases */
+  u32 PhaseDirty[XV_HSCALER_MAX_LINE_WIDTH/32]; /*<< Phases to be uploaded */
 }XV_Hscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -170,6 +176,7 @@ typedef struct
 int XV_HScalerInitialize(XV_Hscaler_l2 *InstancePtr, u16 DeviceId);
 void XV_HScalerStart(XV_Hscaler_l2 *InstancePtr);
 void XV_HScalerStop(XV_Hscaler_l2 *InstancePtr);
+void XV_HScalerInvalidateCache(XV_Hscaler_l2 *InstancePtr);
 void XV_HScalerLoadExtCoeff(XV_Hscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
@@ -48,6 +48,16 @@
 * 6.00  pg    01/10/20   Add Colorimetry feature.
 *                        Program Mixer CSC registers to do color conversion
 *                        from YUV to RGB and RGB to YUV.
+*             10/18/26   Upload logo planes as linear word runs and add
+*                        XVMix_QueueLogo() for frame synchronous updates
+*             10/18/26   Add staged scene API. Layer settings are validated
+*                        by shared helpers and only changed registers are
+*                        written when a scene is applied
+*             10/19/26   Logo planes are packed into words a byte at a time
+*             10/19/26   Keep the layer configuration in sync when a scene is
+*                        applied
+*             10/19/26   Add XVMix_InvalidateShadow() and drop the register
+*                        shadow when the core is started or stopped
 * </pre>
 *
 ******************************************************************************/
@@ -68,6 +78,24 @@
 #define XV_WAIT_FOR_FLUSH_DONE		    (25)
 #define XV_WAIT_FOR_FLUSH_DONE_TIMEOUT	(2000)
 
+/* Scene slot of overlay layer 1-16 and logo layer */
+#define XVMIX_SCENE_SLOT(LayerId) \
+        (((LayerId) == XVMIX_LAYER_LOGO) ? XVMIX_MAX_SUPPORTED_LAYERS : \
+                                           ((LayerId) - 1))
+
+/* Orders pending entry updates against the flag read by the interrupt */
+#if defined(__linux__)
+#define XVMIX_PENDING_SYNC()    __sync_synchronize()
+#elif defined(__GNUC__)
+#define XVMIX_PENDING_SYNC() \
+        do { \
+          __asm__ __volatile__("" : : : "memory"); \
+          DATA_SYNC; \
+        } while (0)
+#else
+#define XVMIX_PENDING_SYNC()    DATA_SYNC
+#endif
+
 /* Pixel values in 8 bit resolution in YUV color space*/
 static const u8 bkgndColorYUV[XVMIX_BKGND_LAST][3] =
 {
@@ -93,6 +121,31 @@ static void SetPowerOnDefaultState(XV_Mix_l2 *InstancePtr);
 static int IsWindowValid(XVidC_VideoStream *Strm,
                          XVidC_VideoWindow *Win,
                          XVMix_Scalefactor ScaleFactor);
+static int IsLayerIdValid(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
+static int ValidateLayerWindow(XV_Mix_l2 *InstancePtr,
+                               XVMix_LayerId LayerId,
+                               XVidC_VideoWindow *Win,
+                               u32 StrideInBytes,
+                               XVMix_Scalefactor Scale);
+static int ValidateLayerScale(XV_Mix_l2 *InstancePtr,
+                              XVMix_LayerId LayerId,
+                              XVidC_VideoWindow *Win,
+                              XVMix_Scalefactor Scale);
+static int ValidateLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
+static int ValidateLayerBufAddr(XV_Mix_l2 *InstancePtr,
+                                XVMix_LayerId LayerId,
+                                UINTPTR Addr);
+static void InvalidateShadow(XV_Mix_l2 *InstancePtr,
+                             XVMix_LayerId LayerId,
+                             u32 Fields);
+static void WriteRegDelta(UINTPTR BaseAddress,
+                          u32 RegOffset,
+                          u32 Data,
+                          u32 *ShadowData,
+                          u32 IsShadowValid);
+static void ApplyLayerState(XV_Mix_l2 *InstancePtr,
+                            u32 Slot,
+                            const XVMix_LayerState *State);
 
 /*****************************************************************************/
 /**
@@ -235,6 +288,8 @@ void XVMix_Start(XV_Mix_l2 *InstancePtr)
 {
   Xil_AssertVoid(InstancePtr != NULL);
 
+  /* Registers may have been reset while the core was stopped */
+  XVMix_InvalidateShadow(InstancePtr);
   XV_mix_Start(&InstancePtr->Mix);
 }
 
@@ -254,6 +309,8 @@ void XVMix_Stop(XV_Mix_l2 *InstancePtr)
 
   Xil_AssertVoid(InstancePtr != NULL);
 
+  XVMix_InvalidateShadow(InstancePtr);
+
   /* Clear autostart bit */
   XV_mix_DisableAutoRestart(&InstancePtr->Mix);
 
@@ -305,6 +362,172 @@ static int IsWindowValid(XVidC_VideoStream *Strm,
   }
 }
 
+/*****************************************************************************/
+/**
+* This function checks if the specified layer is available in the core
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer to be checked
+*
+* @return TRUE if layer is present in HW, else FALSE
+*
+******************************************************************************/
+static int IsLayerIdValid(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
+{
+  return((LayerId < XVMix_GetNumLayers(InstancePtr)) ||
+         ((LayerId == XVMIX_LAYER_LOGO) &&
+          (XVMix_IsLogoEnabled(InstancePtr))));
+}
+
+/*****************************************************************************/
+/**
+* This function validates the window settings of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which window is to be validated
+* @param  Win is the window coordinates in pixels
+* @param  StrideInBytes is the stride of the requested window
+* @param  Scale is the scale factor of the window
+*
+* @return XST_SUCCESS if window is valid else error code with reason
+*
+******************************************************************************/
+static int ValidateLayerWindow(XV_Mix_l2 *InstancePtr,
+                               XVMix_LayerId LayerId,
+                               XVidC_VideoWindow *Win,
+                               u32 StrideInBytes,
+                               XVMix_Scalefactor Scale)
+{
+  XV_mix *MixPtr;
+  u32 Align, WinResInRange;
+
+  /* Check window coordinates */
+  if(!IsWindowValid(&InstancePtr->Stream, Win, Scale)) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+
+  MixPtr = &InstancePtr->Mix;
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+     if(!XVMix_IsLogoEnabled(InstancePtr)) {
+       return(XVMIX_ERR_DISABLED_IN_HW);
+     }
+     WinResInRange = ((Win->Width  > (XVMIX_MIN_LOGO_WIDTH-1))  &&
+                      (Win->Height > (XVMIX_MIN_LOGO_HEIGHT-1)) &&
+                      (Win->Width  <= MixPtr->Config.MaxLogoWidth) &&
+                      (Win->Height <= MixPtr->Config.MaxLogoHeight));
+  } else {
+     if(LayerId >= XVMix_GetNumLayers(InstancePtr)) {
+       return(XVMIX_ERR_DISABLED_IN_HW);
+     }
+     WinResInRange = ((Win->Width  > (XVMIX_MIN_STRM_WIDTH-1))  &&
+                      (Win->Height > (XVMIX_MIN_STRM_HEIGHT-1)) &&
+                      (Win->Width  < MixPtr->Config.LayerMaxWidth[LayerId-1]) &&
+                      (Win->Height <= MixPtr->Config.MaxHeight));
+  }
+
+  if(!WinResInRange) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+
+  /* Stride is not required for logo and stream layers */
+  if((LayerId != XVMIX_LAYER_LOGO) &&
+     (!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId))) {
+     /* Check if stride is aligned to aximm width (2*PPC*32-bits) */
+     Align = 2 * MixPtr->Config.PixPerClk * 4;
+     if((StrideInBytes % Align) != 0) {
+       return(XVMIX_ERR_WIN_STRIDE_MISALIGNED);
+     }
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function validates the scaling factor of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which scale factor is to be validated
+* @param  Win is the window the scale factor applies to
+* @param  Scale is the scale factor
+*
+* @return XST_SUCCESS if scale factor is valid else error code with reason
+*
+******************************************************************************/
+static int ValidateLayerScale(XV_Mix_l2 *InstancePtr,
+                              XVMix_LayerId LayerId,
+                              XVidC_VideoWindow *Win,
+                              XVMix_Scalefactor Scale)
+{
+  /* Validate if scaling will cause the layer window to go out of scope */
+  if(!IsWindowValid(&InstancePtr->Stream, Win, Scale)) {
+      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  }
+
+  if(LayerId == XVMIX_LAYER_LOGO) {
+      return(XVMix_IsLogoEnabled(InstancePtr) ? XST_SUCCESS : XST_FAILURE);
+  }
+
+  if((LayerId < XVMix_GetNumLayers(InstancePtr)) &&
+     (XVMix_IsScalingEnabled(InstancePtr, LayerId))) {
+      return(XST_SUCCESS);
+  }
+  return(XST_FAILURE);
+}
+
+/*****************************************************************************/
+/**
+* This function validates the alpha feature of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which alpha is to be validated
+*
+* @return XST_SUCCESS if alpha is available else error code with reason
+*
+******************************************************************************/
+static int ValidateLayerAlpha(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
+{
+  if(LayerId == XVMIX_LAYER_LOGO) {
+      return(XVMix_IsLogoEnabled(InstancePtr) ?
+             XST_SUCCESS : XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  if((LayerId < XVMix_GetNumLayers(InstancePtr)) &&
+     (XVMix_IsAlphaEnabled(InstancePtr, LayerId))) {
+      return(XST_SUCCESS);
+  }
+  return(XVMIX_ERR_DISABLED_IN_HW);
+}
+
+/*****************************************************************************/
+/**
+* This function validates a buffer address of the specified layer
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer for which address is to be validated
+* @param  Addr is the absolute address of buffer in memory
+*
+* @return XST_SUCCESS if address is valid else error code with reason
+*
+******************************************************************************/
+static int ValidateLayerBufAddr(XV_Mix_l2 *InstancePtr,
+                                XVMix_LayerId LayerId,
+                                UINTPTR Addr)
+{
+  UINTPTR Align;
+
+  if(LayerId >= XVMix_GetNumLayers(InstancePtr)) {
+      return(XST_FAILURE);
+  }
+
+  /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
+  Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
+  if((Addr % Align) != 0) {
+      return(XVMIX_ERR_MEM_ADDR_MISALIGNED);
+  }
+  return(XST_SUCCESS);
+}
+
 /*****************************************************************************/
 /**
 * This function configures the mixer input stream
@@ -349,7 +572,7 @@ void XVMix_SetVidStream(XV_Mix_l2 *InstancePtr,
 int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
   XV_mix *MixPtr;
-  u32 NumLayers, CurrenState;
+  u32 CurrenState;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -357,22 +580,20 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
                     (LayerId < XVMIX_LAYER_LAST));
 
   MixPtr = &InstancePtr->Mix;
-  NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to enable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
     XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_ENABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
-  else if((LayerId < NumLayers) ||
-          ((LayerId == XVMIX_LAYER_LOGO) &&
-           (XVMix_IsLogoEnabled(InstancePtr)))) {
+  else if(IsLayerIdValid(InstancePtr, LayerId)) {
 
     CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
     CurrenState |= (1<<LayerId);
     XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
     Status = XST_SUCCESS;
   }
+  InstancePtr->Shadow.LayerEnableMask = 0;
   return(Status);
 }
 
@@ -391,7 +612,7 @@ int XVMix_LayerEnable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
 {
   XV_mix *MixPtr;
-  u32 NumLayers, CurrenState;
+  u32 CurrenState;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -399,21 +620,19 @@ int XVMix_LayerDisable(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId)
                     (LayerId < XVMIX_LAYER_LAST));
 
   MixPtr = &InstancePtr->Mix;
-  NumLayers = XVMix_GetNumLayers(InstancePtr);
 
   //Check if request is to disable all layers or single layer
   if(LayerId == XVMIX_LAYER_ALL) {
     XV_mix_Set_HwReg_layerEnable(MixPtr, XVMIX_MASK_DISABLE_ALL_LAYERS);
     Status = XST_SUCCESS;
   }
-  else if((LayerId < NumLayers) ||
-          ((LayerId == XVMIX_LAYER_LOGO) &&
-           (XVMix_IsLogoEnabled(InstancePtr)))) {
+  else if(IsLayerIdValid(InstancePtr, LayerId)) {
     CurrenState = XV_mix_Get_HwReg_layerEnable(MixPtr);
     CurrenState &= ~(1<<LayerId);
     XV_mix_Set_HwReg_layerEnable(MixPtr, CurrenState);
     Status = XST_SUCCESS;
   }
+  InstancePtr->Shadow.LayerEnableMask = 0;
   return(Status);
 }
 
@@ -516,9 +735,8 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
                          u32 StrideInBytes)
 {
   XV_mix *MixPtr;
-  u32 Align, WinValid;
   XVMix_Scalefactor Scale;
-  int Status = XST_FAILURE;
+  int Status;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
@@ -526,103 +744,58 @@ int XVMix_SetLayerWindow(XV_Mix_l2 *InstancePtr,
   Xil_AssertNonvoid((Win->StartX % InstancePtr->Mix.Config.PixPerClk) == 0);
   Xil_AssertNonvoid((Win->Width  % InstancePtr->Mix.Config.PixPerClk) == 0);
 
-  /* Check window coordinates */
   Scale = (XVMix_Scalefactor)XVMix_GetLayerScaleFactor(InstancePtr, LayerId);
-  if(!IsWindowValid(&InstancePtr->Stream, Win, Scale)) {
-      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  Status = ValidateLayerWindow(InstancePtr, LayerId, Win, StrideInBytes, Scale);
+  if(Status != XST_SUCCESS) {
+      return(Status);
   }
 
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
-       if(XVMix_IsLogoEnabled(InstancePtr)) {
-         u32 WinResInRange;
-
-         WinResInRange = ((Win->Width  > (XVMIX_MIN_LOGO_WIDTH-1))  &&
-                          (Win->Height > (XVMIX_MIN_LOGO_HEIGHT-1)) &&
-                          (Win->Width  <= MixPtr->Config.MaxLogoWidth) &&
-                          (Win->Height <= MixPtr->Config.MaxLogoHeight));
-         if(WinResInRange) {
-            XV_mix_Set_HwReg_logoStartX(MixPtr, Win->StartX);
-            XV_mix_Set_HwReg_logoStartY(MixPtr, Win->StartY);
-            XV_mix_Set_HwReg_logoWidth(MixPtr,  Win->Width);
-            XV_mix_Set_HwReg_logoHeight(MixPtr, Win->Height);
-
-            InstancePtr->Layer[LayerId].Win = *Win;
-            Status = XST_SUCCESS;
-         } else {
-            Status = XVMIX_ERR_LAYER_WINDOW_INVALID;
-         }
-      } else {
-         Status = XVMIX_ERR_DISABLED_IN_HW;
-      }
+      XV_mix_Set_HwReg_logoStartX(MixPtr, Win->StartX);
+      XV_mix_Set_HwReg_logoStartY(MixPtr, Win->StartY);
+      XV_mix_Set_HwReg_logoWidth(MixPtr,  Win->Width);
+      XV_mix_Set_HwReg_logoHeight(MixPtr, Win->Height);
       break;
 
-    default: //Layer1-Layer8
-       if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
-         u32 WinResInRange;
-
-         WinResInRange = ((Win->Width  > (XVMIX_MIN_STRM_WIDTH-1))  &&
-                          (Win->Height > (XVMIX_MIN_STRM_HEIGHT-1)) &&
-                          (Win->Width  < MixPtr->Config.LayerMaxWidth[LayerId-1]) &&
-                          (Win->Height <= MixPtr->Config.MaxHeight));
-         if(WinResInRange) {
-           /* Check layer interface is Stream or Memory */
-           if(XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
-             /* Stride is not required for stream layer */
-             WinValid = TRUE;
-           } else {
-             /* Check if stride is aligned to aximm width (2*PPC*32-bits) */
-             Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
-             if((StrideInBytes % Align) != 0) {
-               WinValid = FALSE;
-               Status   = XVMIX_ERR_WIN_STRIDE_MISALIGNED;
-             } else {
-               WinValid = TRUE;
-             }
-           }
-
-           if(WinValid) {
-
-             u32 BaseStartXReg, BaseStartYReg;
-             u32 BaseWidthReg, BaseHeightReg;
-             u32 BaseStrideReg;
-             u32 Offset;
-
-             BaseStartXReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA;
-             BaseStartYReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA;
-             BaseWidthReg  = XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA;
-             BaseHeightReg = XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA;
-             BaseStrideReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA;
-             Offset = LayerId*XVMIX_REG_OFFSET;
-
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseStartXReg+Offset), Win->StartX);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseStartYReg+Offset), Win->StartY);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseWidthReg+Offset),  Win->Width);
-             XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                             (BaseHeightReg+Offset), Win->Height);
-
-             if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
-                XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                                (BaseStrideReg+Offset), StrideInBytes);
-             }
-             InstancePtr->Layer[LayerId].Win = *Win;
-             Status = XST_SUCCESS;
-           }
-         } else { //if(WinResInRange)
-             Status = XVMIX_ERR_LAYER_WINDOW_INVALID;
-         }
-       } else { //if(LayerId <
-            Status = XVMIX_ERR_DISABLED_IN_HW;
-       }
-       break;
+    default: //Layer1-Layer16
+      {
+        u32 BaseStartXReg, BaseStartYReg;
+        u32 BaseWidthReg, BaseHeightReg;
+        u32 BaseStrideReg;
+        u32 Offset;
+
+        BaseStartXReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA;
+        BaseStartYReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA;
+        BaseWidthReg  = XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA;
+        BaseHeightReg = XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA;
+        BaseStrideReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA;
+        Offset = LayerId*XVMIX_REG_OFFSET;
+
+        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                        (BaseStartXReg+Offset), Win->StartX);
+        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                        (BaseStartYReg+Offset), Win->StartY);
+        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                        (BaseWidthReg+Offset),  Win->Width);
+        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                        (BaseHeightReg+Offset), Win->Height);
+
+        if(!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId)) {
+           XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                           (BaseStrideReg+Offset), StrideInBytes);
+        }
+      }
+      break;
   }//switch
 
-  return(Status);
+  InstancePtr->Layer[LayerId].Win = *Win;
+  InvalidateShadow(InstancePtr, LayerId,
+                   (XVMIX_LAYER_FIELD_WINDOW | XVMIX_LAYER_FIELD_STRIDE));
+
+  return(XST_SUCCESS);
 }
 
 /*****************************************************************************/
@@ -783,6 +956,7 @@ int XVMix_MoveLayerWindow(XV_Mix_l2 *InstancePtr,
       }
       break;
   }
+  InvalidateShadow(InstancePtr, LayerId, XVMIX_LAYER_FIELD_WINDOW);
   return(Status);
 }
 
@@ -805,7 +979,7 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
 {
   XV_mix *MixPtr;
   XVidC_VideoWindow CurrWin;
-  int Status = XST_FAILURE;
+  int Status;
   int WinStatus;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -820,35 +994,30 @@ int XVMix_SetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
      return(WinStatus);
   }
 
-  if(!IsWindowValid(&InstancePtr->Stream, &CurrWin, Scale)) {
-      return(XVMIX_ERR_LAYER_WINDOW_INVALID);
+  Status = ValidateLayerScale(InstancePtr, LayerId, &CurrWin, Scale);
+  if(Status != XST_SUCCESS) {
+      return(Status);
   }
 
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
-      if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoScaleFactor(MixPtr, Scale);
-        Status = XST_SUCCESS;
-      }
+      XV_mix_Set_HwReg_logoScaleFactor(MixPtr, Scale);
       break;
 
-    default: //Layer0-Layer8
-      if((LayerId < XVMix_GetNumLayers(InstancePtr)) &&
-         (XVMix_IsScalingEnabled(InstancePtr, LayerId))) {
-
+    default: //Layer1-Layer16
+      {
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA;
         XV_mix_WriteReg(MixPtr->Config.BaseAddress,
                         (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Scale);
-
-        Status = XST_SUCCESS;
       }
       break;
   }
-  return(Status);
+  InvalidateShadow(InstancePtr, LayerId, XVMIX_LAYER_FIELD_SCALE);
+  return(XST_SUCCESS);
 }
 
 /*****************************************************************************/
@@ -913,40 +1082,37 @@ int XVMix_SetLayerAlpha(XV_Mix_l2 *InstancePtr,
                         u16 Alpha)
 {
   XV_mix *MixPtr;
-  int Status = XST_FAILURE;
+  int Status;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId <= XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
 
+  Status = ValidateLayerAlpha(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
+
   MixPtr = &InstancePtr->Mix;
 
   switch(LayerId) {
     case XVMIX_LAYER_LOGO:
-      if(XVMix_IsLogoEnabled(InstancePtr)) {
-        XV_mix_Set_HwReg_logoAlpha(MixPtr, Alpha);
-        Status = XST_SUCCESS;
-      } else {
-        Status = XVMIX_ERR_DISABLED_IN_HW;
-      }
+      XV_mix_Set_HwReg_logoAlpha(MixPtr, Alpha);
       break;
 
-    default: //Layer1-Layer8
-      if((LayerId < XVMix_GetNumLayers(InstancePtr)) &&
-         (XVMix_IsAlphaEnabled(InstancePtr, LayerId))) {
+    default: //Layer1-Layer16
+      {
         u32 BaseReg;
 
         BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA;
         XV_mix_WriteReg(MixPtr->Config.BaseAddress,
                         (BaseReg+(LayerId*XVMIX_REG_OFFSET)), Alpha);
-        Status = XST_SUCCESS;
-      } else {
-        Status = XVMIX_ERR_DISABLED_IN_HW;
       }
       break;
   }
-  return(Status);
+  InvalidateShadow(InstancePtr, LayerId, XVMIX_LAYER_FIELD_ALPHA);
+  return(XST_SUCCESS);
 }
 
 /*****************************************************************************/
@@ -1109,38 +1275,28 @@ int XVMix_SetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
                              UINTPTR Addr)
 {
   XV_mix *MixPtr;
-  UINTPTR BaseReg, Align;
-  u32 WinValid = FALSE;
-  int Status = XST_FAILURE;
+  UINTPTR BaseReg;
+  int Status;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
-  if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
-      /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
-      Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
-      if((Addr % Align) != 0) {
-         WinValid = FALSE;
-         Status   = XVMIX_ERR_MEM_ADDR_MISALIGNED;
-      } else {
-         WinValid = TRUE;
-      }
+  Status = ValidateLayerBufAddr(InstancePtr, LayerId, Addr);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
 
-      if(WinValid) {
-        BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
+  MixPtr = &InstancePtr->Mix;
+  BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+  XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                  (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
-        InstancePtr->Layer[LayerId].BufAddr = Addr;
-        Status = XST_SUCCESS;
-      }
-  }
-  return(Status);
+  InstancePtr->Layer[LayerId].BufAddr = Addr;
+  InvalidateShadow(InstancePtr, LayerId, XVMIX_LAYER_FIELD_BUFADDR);
+  return(XST_SUCCESS);
 }
 
 /*****************************************************************************/
@@ -1195,38 +1351,28 @@ int XVMix_SetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
                                    UINTPTR Addr)
 {
   XV_mix *MixPtr;
-  UINTPTR BaseReg, Align;
-  u32 WinValid = FALSE;
-  int Status = XST_FAILURE;
+  UINTPTR BaseReg;
+  int Status;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
   Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
                     (LayerId < XVMIX_LAYER_LOGO));
   Xil_AssertNonvoid(Addr != 0);
 
-  MixPtr = &InstancePtr->Mix;
-
-  if(LayerId < XVMix_GetNumLayers(InstancePtr)) {
-      /* Check if addr is aligned to aximm width (2*PPC*32-bits (4Bytes)) */
-      Align = 2 * InstancePtr->Mix.Config.PixPerClk * 4;
-      if((Addr % Align) != 0) {
-         WinValid = FALSE;
-         Status   = XVMIX_ERR_MEM_ADDR_MISALIGNED;
-      } else {
-         WinValid = TRUE;
-      }
+  Status = ValidateLayerBufAddr(InstancePtr, LayerId, Addr);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
 
-      if(WinValid) {
-        BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
+  MixPtr = &InstancePtr->Mix;
+  BaseReg = XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA;
 
-        XV_mix_WriteReg(MixPtr->Config.BaseAddress,
-                        (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
+  XV_mix_WriteReg(MixPtr->Config.BaseAddress,
+                  (BaseReg+((LayerId-1)*XVMIX_REG_OFFSET)), Addr);
 
-        InstancePtr->Layer[LayerId].ChromaBufAddr = Addr;
-        Status = XST_SUCCESS;
-      }
-  }
-  return(Status);
+  InstancePtr->Layer[LayerId].ChromaBufAddr = Addr;
+  InvalidateShadow(InstancePtr, LayerId, XVMIX_LAYER_FIELD_CHROMABUFADDR);
+  return(XST_SUCCESS);
 }
 
 /*****************************************************************************/
@@ -1338,6 +1484,40 @@ int XVMix_GetLogoColorKey(XV_Mix_l2 *InstancePtr,
   return(Status);
 }
 
+/*****************************************************************************/
+/**
+* This function copies one logo plane into its core BRAM window. Logo lines
+* are contiguous in BRAM so the plane is written as a single run of 32 bit
+* words, each packed from 4 pixels
+*
+* @param  BaseAddress is the core base address
+* @param  PlaneAddr is the offset of the plane window in the core
+* @param  Buffer is the pointer to the plane data
+* @param  Size is the plane size in bytes (multiple of 4)
+*
+* @return none
+*
+* @note   none
+*
+******************************************************************************/
+static void XVMix_WriteLogoPlane(UINTPTR BaseAddress,
+                                 u32 PlaneAddr,
+                                 const u8 *Buffer,
+                                 u32 Size)
+{
+  u32 Offset;
+  u32 Word;
+
+  for (Offset=0; Offset<Size; Offset+=4) {
+      Word = (u32)Buffer[Offset] |
+             (((u32)Buffer[Offset+1])<<8) |
+             (((u32)Buffer[Offset+2])<<16) |
+             (((u32)Buffer[Offset+3])<<24);
+
+      XV_mix_WriteReg(BaseAddress, (PlaneAddr+Offset), Word);
+  }
+}
+
 /*****************************************************************************/
 /**
 * This function loads the logo data into core BRAM
@@ -1360,10 +1540,7 @@ int XVMix_LoadLogo(XV_Mix_l2 *InstancePtr,
                    u8 *BBuffer)
 {
   XV_mix *MixPtr;
-  u32 x,y;
-  u32 Rword, Gword, Bword;
-  u32 Width, Height;
-  u32 RBaseAddr, GBaseAddr, BBaseAddr;
+  u32 Size;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1379,35 +1556,15 @@ int XVMix_LoadLogo(XV_Mix_l2 *InstancePtr,
 
   if(XVMix_IsLogoEnabled(InstancePtr)) {
       MixPtr = &InstancePtr->Mix;
-      Width  = Win->Width;
-      Height = Win->Height;
-
-      RBaseAddr = XV_MIX_CTRL_ADDR_HWREG_LOGOR_V_BASE;
-      GBaseAddr = XV_MIX_CTRL_ADDR_HWREG_LOGOG_V_BASE;
-      BBaseAddr = XV_MIX_CTRL_ADDR_HWREG_LOGOB_V_BASE;
-
-      for (y=0; y<Height; y++) {
-          for (x=0; x<Width; x+=4) {
-            Rword = (u32)RBuffer[y*Width+x] |
-                    (((u32)RBuffer[y*Width+x+1])<<8) |
-                    (((u32)RBuffer[y*Width+x+2])<<16) |
-                    (((u32)RBuffer[y*Width+x+3])<<24);
-
-            Gword = (u32)GBuffer[y*Width+x] |
-                    (((u32)GBuffer[y*Width+x+1])<<8) |
-                    (((u32)GBuffer[y*Width+x+2])<<16) |
-                    (((u32)GBuffer[y*Width+x+3])<<24);
-
-            Bword = (u32)BBuffer[y*Width+x] |
-                    (((u32)BBuffer[y*Width+x+1])<<8) |
-                    (((u32)BBuffer[y*Width+x+2])<<16) |
-                    (((u32)BBuffer[y*Width+x+3])<<24);
-
-            XV_mix_WriteReg(MixPtr->Config.BaseAddress, (RBaseAddr+(y*Width+x)), Rword);
-            XV_mix_WriteReg(MixPtr->Config.BaseAddress, (GBaseAddr+(y*Width+x)), Gword);
-            XV_mix_WriteReg(MixPtr->Config.BaseAddress, (BBaseAddr+(y*Width+x)), Bword);
-          }
-      }
+      Size   = Win->Width * Win->Height;
+
+      XVMix_WriteLogoPlane(MixPtr->Config.BaseAddress,
+                           XV_MIX_CTRL_ADDR_HWREG_LOGOR_V_BASE, RBuffer, Size);
+      XVMix_WriteLogoPlane(MixPtr->Config.BaseAddress,
+                           XV_MIX_CTRL_ADDR_HWREG_LOGOG_V_BASE, GBuffer, Size);
+      XVMix_WriteLogoPlane(MixPtr->Config.BaseAddress,
+                           XV_MIX_CTRL_ADDR_HWREG_LOGOB_V_BASE, BBuffer, Size);
+
       InstancePtr->Layer[XVMIX_LAYER_LOGO].RBuffer = RBuffer;
       InstancePtr->Layer[XVMIX_LAYER_LOGO].GBuffer = GBuffer;
       InstancePtr->Layer[XVMIX_LAYER_LOGO].BBuffer = BBuffer;
@@ -1435,9 +1592,7 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
                              u8 *ABuffer)
 {
   XV_mix *MixPtr;
-  u32 x,y;
-  u32 Aword, ABaseAddr;
-  u32 Width, Height;
+  u32 Size;
   int Status = XST_FAILURE;
 
   Xil_AssertNonvoid(InstancePtr != NULL);
@@ -1452,26 +1607,696 @@ int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
   if(XVMix_IsLogoEnabled(InstancePtr) &&
      XVMix_IsLogoPixAlphaEnabled(InstancePtr)) {
       MixPtr = &InstancePtr->Mix;
-      Width  = Win->Width;
-      Height = Win->Height;
+      Size   = Win->Width * Win->Height;
 
-      ABaseAddr = XV_MIX_CTRL_ADDR_HWREG_LOGOA_V_BASE;
-
-      for (y=0; y<Height; y++) {
-          for (x=0; x<Width; x+=4) {
-            Aword = (u32)ABuffer[y*Width+x] |
-                    (((u32)ABuffer[y*Width+x+1])<<8) |
-                    (((u32)ABuffer[y*Width+x+2])<<16) |
-                    (((u32)ABuffer[y*Width+x+3])<<24);
-
-            XV_mix_WriteReg(MixPtr->Config.BaseAddress, (ABaseAddr+(y*Width+x)), Aword);
-          }
-      }
+      XVMix_WriteLogoPlane(MixPtr->Config.BaseAddress,
+                           XV_MIX_CTRL_ADDR_HWREG_LOGOA_V_BASE, ABuffer, Size);
       Status = XST_SUCCESS;
   }
   return(Status);
 }
 
+/*****************************************************************************/
+/**
+* This function queues a logo image to be loaded into core BRAM at the next
+* frame done interrupt, while the core is idle and before it is restarted,
+* so that the logo never changes while a frame is being processed. Queuing
+* again before the interrupt replaces the pending image. The buffers must
+* remain valid until the image has been loaded, i.e. until LogoPending is
+* cleared.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Win is logo window (logo width must be multiple of 4 bytes)
+* @param  RBuffer is the pointer to Red buffer
+* @param  GBuffer is the pointer to Green buffer
+* @param  BBuffer is the pointer to Blue buffer
+* @param  ABuffer is the pointer to Pixel Alpha buffer, NULL if not used
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   Requires the core to be run from XVMix_InterruptHandler(). With
+*         auto restart enabled use XVMix_LoadLogo() instead.
+*
+******************************************************************************/
+int XVMix_QueueLogo(XV_Mix_l2 *InstancePtr,
+                    XVidC_VideoWindow *Win,
+                    u8 *RBuffer,
+                    u8 *GBuffer,
+                    u8 *BBuffer,
+                    u8 *ABuffer)
+{
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Win != NULL);
+  Xil_AssertNonvoid(RBuffer != NULL);
+  Xil_AssertNonvoid(GBuffer != NULL);
+  Xil_AssertNonvoid(BBuffer != NULL);
+  Xil_AssertNonvoid((Win->Width  > (XVMIX_MIN_LOGO_WIDTH-1)) &&
+                    (Win->Width  <= InstancePtr->Mix.Config.MaxLogoWidth));
+  Xil_AssertNonvoid((Win->Height > (XVMIX_MIN_LOGO_HEIGHT-1)) &&
+                    (Win->Height <= InstancePtr->Mix.Config.MaxLogoHeight));
+  Xil_AssertNonvoid((Win->StartX % InstancePtr->Mix.Config.PixPerClk) == 0);
+  Xil_AssertNonvoid((Win->Width  % InstancePtr->Mix.Config.PixPerClk) == 0);
+
+  if(!XVMix_IsLogoEnabled(InstancePtr) ||
+     ((ABuffer != NULL) && !XVMix_IsLogoPixAlphaEnabled(InstancePtr))) {
+      return(XST_FAILURE);
+  }
+
+  /* Hide the entry from the interrupt handler while it is updated */
+  InstancePtr->LogoPending = FALSE;
+  XVMIX_PENDING_SYNC();
+
+  InstancePtr->PendingLogo.Win     = *Win;
+  InstancePtr->PendingLogo.RBuffer = RBuffer;
+  InstancePtr->PendingLogo.GBuffer = GBuffer;
+  InstancePtr->PendingLogo.BBuffer = BBuffer;
+  InstancePtr->PendingLogo.ABuffer = ABuffer;
+
+  /* Publish the entry before the flag */
+  XVMIX_PENDING_SYNC();
+  InstancePtr->LogoPending = TRUE;
+
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function clears a scene so that no layer setting is staged
+*
+* @param  Scene is a pointer to the scene to be initialized
+*
+* @return none
+*
+******************************************************************************/
+void XVMix_SceneInit(XVMix_Scene *Scene)
+{
+  Xil_AssertVoid(Scene != NULL);
+
+  memset(Scene, 0, sizeof(XVMix_Scene));
+}
+
+/*****************************************************************************/
+/**
+* This function stages enabling the specified layer in a scene
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is layer number to be enabled
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   To enable all layers use layer id  XVMIX_LAYER_ALL
+*
+******************************************************************************/
+int XVMix_SceneLayerEnable(XV_Mix_l2 *InstancePtr,
+                           XVMix_Scene *Scene,
+                           XVMix_LayerId LayerId)
+{
+  u32 Mask;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LAST));
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    Mask = XVMIX_MASK_ENABLE_ALL_LAYERS;
+  } else if(IsLayerIdValid(InstancePtr, LayerId)) {
+    Mask = (1<<LayerId);
+  } else {
+    return(XST_FAILURE);
+  }
+
+  Scene->LayerEnable     |= Mask;
+  Scene->LayerEnableMask |= Mask;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages disabling the specified layer in a scene
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is layer number to be disabled
+*
+* @return XST_SUCCESS or XST_FAILURE
+*
+* @note   To disable all layers use layer id  XVMIX_LAYER_ALL
+*
+******************************************************************************/
+int XVMix_SceneLayerDisable(XV_Mix_l2 *InstancePtr,
+                            XVMix_Scene *Scene,
+                            XVMix_LayerId LayerId)
+{
+  u32 Mask;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId >= XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LAST));
+
+  if(LayerId == XVMIX_LAYER_ALL) {
+    Mask = XVMIX_MASK_ENABLE_ALL_LAYERS;
+  } else if(IsLayerIdValid(InstancePtr, LayerId)) {
+    Mask = (1<<LayerId);
+  } else {
+    return(XST_FAILURE);
+  }
+
+  Scene->LayerEnable     &= ~Mask;
+  Scene->LayerEnableMask |= Mask;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the window coordinates of the specified layer in a
+* scene. The window is validated against the scale factor staged in the scene
+* or, if none is staged, the one currently set in the core.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is the layer for which window coordinates are to be set
+* @param  Win is the window coordinates in pixels
+* @param  StrideInBytes is the stride of the requested window
+*           (Applicable only when layer type is Memory)
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+int XVMix_SceneSetLayerWindow(XV_Mix_l2 *InstancePtr,
+                              XVMix_Scene *Scene,
+                              XVMix_LayerId LayerId,
+                              XVidC_VideoWindow *Win,
+                              u32 StrideInBytes)
+{
+  XVMix_LayerState *State;
+  XVMix_Scalefactor Scale;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Win != NULL);
+  Xil_AssertNonvoid((Win->StartX % InstancePtr->Mix.Config.PixPerClk) == 0);
+  Xil_AssertNonvoid((Win->Width  % InstancePtr->Mix.Config.PixPerClk) == 0);
+
+  if(!IsLayerIdValid(InstancePtr, LayerId)) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  State = &Scene->Layer[XVMIX_SCENE_SLOT(LayerId)];
+  if(State->Fields & XVMIX_LAYER_FIELD_SCALE) {
+      Scale = (XVMix_Scalefactor)State->Scale;
+  } else {
+      Scale = (XVMix_Scalefactor)XVMix_GetLayerScaleFactor(InstancePtr,
+                                                           LayerId);
+  }
+
+  Status = ValidateLayerWindow(InstancePtr, LayerId, Win, StrideInBytes, Scale);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
+
+  State->Win = *Win;
+  State->Fields |= XVMIX_LAYER_FIELD_WINDOW;
+
+  if((LayerId != XVMIX_LAYER_LOGO) &&
+     (!XVMix_IsLayerInterfaceStream(InstancePtr, LayerId))) {
+      State->StrideInBytes = StrideInBytes;
+      State->Fields |= XVMIX_LAYER_FIELD_STRIDE;
+  }
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the scaling factor of the specified layer in a scene.
+* The scale factor is validated against the window staged in the scene or, if
+* none is staged, the one currently set in the core.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is the layer to be updated
+* @param  Scale is the scale factor
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+int XVMix_SceneSetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
+                                   XVMix_Scene *Scene,
+                                   XVMix_LayerId LayerId,
+                                   XVMix_Scalefactor Scale)
+{
+  XVMix_LayerState *State;
+  XVidC_VideoWindow CurrWin;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid((Scale >= XVMIX_SCALE_FACTOR_1X) &&
+                    (Scale <= XVMIX_SCALE_FACTOR_4X));
+
+  if(!IsLayerIdValid(InstancePtr, LayerId)) {
+      return(XVMIX_ERR_DISABLED_IN_HW);
+  }
+
+  State = &Scene->Layer[XVMIX_SCENE_SLOT(LayerId)];
+  if(State->Fields & XVMIX_LAYER_FIELD_WINDOW) {
+      CurrWin = State->Win;
+  } else {
+      Status = XVMix_GetLayerWindow(InstancePtr, LayerId, &CurrWin);
+      if(Status != XST_SUCCESS) {
+         return(Status);
+      }
+  }
+
+  Status = ValidateLayerScale(InstancePtr, LayerId, &CurrWin, Scale);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
+
+  State->Scale = Scale;
+  State->Fields |= XVMIX_LAYER_FIELD_SCALE;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the Alpha level of the specified layer in a scene
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is the layer to be updated
+* @param  Alpha is the new value
+*
+* @return XST_SUCCESS if command is successful else error code with reason
+*
+* @note   Applicable only for Layer1-16 and Logo Layer
+*
+******************************************************************************/
+int XVMix_SceneSetLayerAlpha(XV_Mix_l2 *InstancePtr,
+                             XVMix_Scene *Scene,
+                             XVMix_LayerId LayerId,
+                             u16 Alpha)
+{
+  XVMix_LayerState *State;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId <= XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Alpha <= XVMIX_ALPHA_MAX);
+
+  Status = ValidateLayerAlpha(InstancePtr, LayerId);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
+
+  State = &Scene->Layer[XVMIX_SCENE_SLOT(LayerId)];
+  State->Alpha = Alpha;
+  State->Fields |= XVMIX_LAYER_FIELD_ALPHA;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer in a scene
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of buffer in memory
+*
+* @return XST_SUCCESS or error code with reason
+*
+* @note   Applicable only for Layer1-16
+*
+******************************************************************************/
+int XVMix_SceneSetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
+                                  XVMix_Scene *Scene,
+                                  XVMix_LayerId LayerId,
+                                  UINTPTR Addr)
+{
+  XVMix_LayerState *State;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Addr != 0);
+
+  Status = ValidateLayerBufAddr(InstancePtr, LayerId, Addr);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
+
+  State = &Scene->Layer[XVMIX_SCENE_SLOT(LayerId)];
+  State->BufAddr = Addr;
+  State->Fields |= XVMIX_LAYER_FIELD_BUFADDR;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function stages the buffer address of the specified layer for the UV
+* plane for semi-planar formats in a scene
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be updated
+* @param  LayerId is the layer to be updated
+* @param  Addr is the absolute address of second buffer in memory
+*
+* @return XST_SUCCESS or error code with reason
+*
+* @note   Applicable only for Layer1-16
+*
+******************************************************************************/
+int XVMix_SceneSetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
+                                        XVMix_Scene *Scene,
+                                        XVMix_LayerId LayerId,
+                                        UINTPTR Addr)
+{
+  XVMix_LayerState *State;
+  int Status;
+
+  Xil_AssertNonvoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(Scene != NULL);
+  Xil_AssertNonvoid((LayerId > XVMIX_LAYER_MASTER) &&
+                    (LayerId < XVMIX_LAYER_LOGO));
+  Xil_AssertNonvoid(Addr != 0);
+
+  Status = ValidateLayerBufAddr(InstancePtr, LayerId, Addr);
+  if(Status != XST_SUCCESS) {
+      return(Status);
+  }
+
+  State = &Scene->Layer[XVMIX_SCENE_SLOT(LayerId)];
+  State->ChromaBufAddr = Addr;
+  State->Fields |= XVMIX_LAYER_FIELD_CHROMABUFADDR;
+  return(XST_SUCCESS);
+}
+
+/*****************************************************************************/
+/**
+* This function marks the specified settings of a layer as unknown, so that
+* the next scene applied writes them to the core. It must be called whenever
+* a layer register is written outside of the scene API.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  LayerId is the layer that was written
+* @param  Fields is the XVMIX_LAYER_FIELD_* mask of settings written
+*
+* @return none
+*
+******************************************************************************/
+static void InvalidateShadow(XV_Mix_l2 *InstancePtr,
+                             XVMix_LayerId LayerId,
+                             u32 Fields)
+{
+  InstancePtr->Shadow.Layer[XVMIX_SCENE_SLOT(LayerId)].Fields &= ~Fields;
+}
+
+/*****************************************************************************/
+/**
+* This function marks all settings written by the scene API as unknown, so
+* that the next scene applied writes every staged setting to the core.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+*
+* @return none
+*
+* @note   XVMix_Start() and XVMix_Stop() call this function. Call it after
+*         the core registers were reset or written by any other means, for
+*         example a reset through GPIO or the XV_mix_* register API.
+*
+******************************************************************************/
+void XVMix_InvalidateShadow(XV_Mix_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  memset(&InstancePtr->Shadow, 0, sizeof(XVMix_Scene));
+}
+
+/*****************************************************************************/
+/**
+* This function writes a register unless the shadow copy shows that it already
+* holds the requested value
+*
+* @param  BaseAddress is the base address of the core
+* @param  RegOffset is the register offset
+* @param  Data is the value to be written
+* @param  ShadowData is a pointer to the shadow copy of the register
+* @param  IsShadowValid is TRUE if ShadowData matches the register
+*
+* @return none
+*
+******************************************************************************/
+static void WriteRegDelta(UINTPTR BaseAddress,
+                          u32 RegOffset,
+                          u32 Data,
+                          u32 *ShadowData,
+                          u32 IsShadowValid)
+{
+  if(!IsShadowValid || (*ShadowData != Data)) {
+    XV_mix_WriteReg(BaseAddress, RegOffset, Data);
+    *ShadowData = Data;
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function writes the staged settings of a layer that differ from the
+* settings last written to the core and records them in the layer
+* configuration read back by the XVMix_GetLayer* API
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Slot is the scene slot of the layer
+* @param  State is a pointer to the staged layer settings
+*
+* @return none
+*
+******************************************************************************/
+static void ApplyLayerState(XV_Mix_l2 *InstancePtr,
+                            u32 Slot,
+                            const XVMix_LayerState *State)
+{
+  XVMix_LayerState *Shadow;
+  XVMix_Layer *Layer;
+  UINTPTR BaseAddress;
+  u32 Fields, Valid;
+  u32 StartXReg, StartYReg, WidthReg, HeightReg;
+  u32 AlphaReg, ScaleReg;
+  u32 Offset = 0;
+
+  BaseAddress = InstancePtr->Mix.Config.BaseAddress;
+  Shadow = &InstancePtr->Shadow.Layer[Slot];
+  Fields = State->Fields;
+  Valid  = Shadow->Fields;
+
+  if(Slot == XVMIX_SCENE_SLOT(XVMIX_LAYER_LOGO)) {
+    StartXReg = XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTX_DATA;
+    StartYReg = XV_MIX_CTRL_ADDR_HWREG_LOGOSTARTY_DATA;
+    WidthReg  = XV_MIX_CTRL_ADDR_HWREG_LOGOWIDTH_DATA;
+    HeightReg = XV_MIX_CTRL_ADDR_HWREG_LOGOHEIGHT_DATA;
+    AlphaReg  = XV_MIX_CTRL_ADDR_HWREG_LOGOALPHA_DATA;
+    ScaleReg  = XV_MIX_CTRL_ADDR_HWREG_LOGOSCALEFACTOR_DATA;
+    Layer     = &InstancePtr->Layer[XVMIX_LAYER_LOGO];
+
+    /* Logo layer has no stride or buffer registers */
+    Fields &= (XVMIX_LAYER_FIELD_WINDOW |
+               XVMIX_LAYER_FIELD_ALPHA  |
+               XVMIX_LAYER_FIELD_SCALE);
+  } else {
+    Offset = (Slot + 1) * XVMIX_REG_OFFSET;
+
+    StartXReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTX_0_DATA + Offset;
+    StartYReg = XV_MIX_CTRL_ADDR_HWREG_LAYERSTARTY_0_DATA + Offset;
+    WidthReg  = XV_MIX_CTRL_ADDR_HWREG_LAYERWIDTH_0_DATA + Offset;
+    HeightReg = XV_MIX_CTRL_ADDR_HWREG_LAYERHEIGHT_0_DATA + Offset;
+    AlphaReg  = XV_MIX_CTRL_ADDR_HWREG_LAYERALPHA_0_DATA + Offset;
+    ScaleReg  = XV_MIX_CTRL_ADDR_HWREG_LAYERSCALEFACTOR_0_DATA + Offset;
+    Layer     = &InstancePtr->Layer[Slot + 1];
+  }
+
+  if(Fields & XVMIX_LAYER_FIELD_WINDOW) {
+    WriteRegDelta(BaseAddress, StartXReg, State->Win.StartX,
+                  &Shadow->Win.StartX, (Valid & XVMIX_LAYER_FIELD_WINDOW));
+    WriteRegDelta(BaseAddress, StartYReg, State->Win.StartY,
+                  &Shadow->Win.StartY, (Valid & XVMIX_LAYER_FIELD_WINDOW));
+    WriteRegDelta(BaseAddress, WidthReg, State->Win.Width,
+                  &Shadow->Win.Width, (Valid & XVMIX_LAYER_FIELD_WINDOW));
+    WriteRegDelta(BaseAddress, HeightReg, State->Win.Height,
+                  &Shadow->Win.Height, (Valid & XVMIX_LAYER_FIELD_WINDOW));
+    Layer->Win = State->Win;
+  }
+
+  if(Fields & XVMIX_LAYER_FIELD_STRIDE) {
+    WriteRegDelta(BaseAddress,
+                  (XV_MIX_CTRL_ADDR_HWREG_LAYERSTRIDE_0_DATA + Offset),
+                  State->StrideInBytes, &Shadow->StrideInBytes,
+                  (Valid & XVMIX_LAYER_FIELD_STRIDE));
+  }
+
+  if(Fields & XVMIX_LAYER_FIELD_ALPHA) {
+    WriteRegDelta(BaseAddress, AlphaReg, State->Alpha, &Shadow->Alpha,
+                  (Valid & XVMIX_LAYER_FIELD_ALPHA));
+  }
+
+  if(Fields & XVMIX_LAYER_FIELD_SCALE) {
+    WriteRegDelta(BaseAddress, ScaleReg, State->Scale, &Shadow->Scale,
+                  (Valid & XVMIX_LAYER_FIELD_SCALE));
+  }
+
+  if((Fields & XVMIX_LAYER_FIELD_BUFADDR) &&
+     (!(Valid & XVMIX_LAYER_FIELD_BUFADDR) ||
+      (Shadow->BufAddr != State->BufAddr))) {
+    XV_mix_WriteReg(BaseAddress,
+                    (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF1_V_DATA +
+                     (Slot * XVMIX_REG_OFFSET)),
+                    State->BufAddr);
+    Shadow->BufAddr = State->BufAddr;
+  }
+  if(Fields & XVMIX_LAYER_FIELD_BUFADDR) {
+    Layer->BufAddr = State->BufAddr;
+  }
+
+  if((Fields & XVMIX_LAYER_FIELD_CHROMABUFADDR) &&
+     (!(Valid & XVMIX_LAYER_FIELD_CHROMABUFADDR) ||
+      (Shadow->ChromaBufAddr != State->ChromaBufAddr))) {
+    XV_mix_WriteReg(BaseAddress,
+                    (XV_MIX_CTRL_ADDR_HWREG_LAYER1_BUF2_V_DATA +
+                     (Slot * XVMIX_REG_OFFSET)),
+                    State->ChromaBufAddr);
+    Shadow->ChromaBufAddr = State->ChromaBufAddr;
+  }
+  if(Fields & XVMIX_LAYER_FIELD_CHROMABUFADDR) {
+    Layer->ChromaBufAddr = State->ChromaBufAddr;
+  }
+
+  Shadow->Fields |= Fields;
+}
+
+/*****************************************************************************/
+/**
+* This function writes the settings staged in a scene to the core. Only the
+* registers whose value differs from the value last written by this API are
+* accessed, and the layer enable register is written at most once.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be applied
+*
+* @return none
+*
+* @note   Registers are written immediately. To avoid partial updates call
+*         this function from the frame done callback or use
+*         XVMix_QueueScene().
+*
+******************************************************************************/
+void XVMix_ApplyScene(XV_Mix_l2 *InstancePtr, const XVMix_Scene *Scene)
+{
+  XVMix_Scene *Shadow;
+  u32 Slot, Enable;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(Scene != NULL);
+
+  for(Slot = 0; Slot < XVMIX_SCENE_NUM_SLOTS; ++Slot) {
+    if(Scene->Layer[Slot].Fields) {
+      ApplyLayerState(InstancePtr, Slot, &Scene->Layer[Slot]);
+    }
+  }
+
+  if(Scene->LayerEnableMask) {
+    Shadow = &InstancePtr->Shadow;
+    if(!Shadow->LayerEnableMask) {
+      Shadow->LayerEnable = XV_mix_Get_HwReg_layerEnable(&InstancePtr->Mix);
+      Shadow->LayerEnableMask = XVMIX_MASK_ENABLE_ALL_LAYERS;
+    }
+
+    Enable = (Shadow->LayerEnable & ~Scene->LayerEnableMask) |
+             (Scene->LayerEnable & Scene->LayerEnableMask);
+    if(Enable != Shadow->LayerEnable) {
+      XV_mix_Set_HwReg_layerEnable(&InstancePtr->Mix, Enable);
+      Shadow->LayerEnable = Enable;
+    }
+  }
+}
+
+/*****************************************************************************/
+/**
+* This function queues a scene to be applied by the interrupt handler on the
+* next frame done interrupt, before the core is restarted, so that all layer
+* updates take effect on the same frame. Scenes queued before the interrupt
+* are merged, later settings replacing earlier ones.
+*
+* @param  InstancePtr is a pointer to core instance to be worked upon
+* @param  Scene is a pointer to the scene to be queued
+*
+* @return none
+*
+* @note   Requires the core to be run from XVMix_InterruptHandler(). With
+*         auto restart enabled use XVMix_ApplyScene() instead.
+*
+******************************************************************************/
+void XVMix_QueueScene(XV_Mix_l2 *InstancePtr, const XVMix_Scene *Scene)
+{
+  XVMix_Scene *Pending;
+  const XVMix_LayerState *Src;
+  XVMix_LayerState *Dst;
+  u32 Slot;
+
+  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertVoid(Scene != NULL);
+
+  /* Hide the scene from the interrupt handler while it is updated */
+  InstancePtr->ScenePending = FALSE;
+  XVMIX_PENDING_SYNC();
+
+  Pending = &InstancePtr->PendingScene;
+  for(Slot = 0; Slot < XVMIX_SCENE_NUM_SLOTS; ++Slot) {
+    Src = &Scene->Layer[Slot];
+    Dst = &Pending->Layer[Slot];
+
+    if(Src->Fields & XVMIX_LAYER_FIELD_WINDOW) {
+      Dst->Win = Src->Win;
+    }
+    if(Src->Fields & XVMIX_LAYER_FIELD_STRIDE) {
+      Dst->StrideInBytes = Src->StrideInBytes;
+    }
+    if(Src->Fields & XVMIX_LAYER_FIELD_ALPHA) {
+      Dst->Alpha = Src->Alpha;
+    }
+    if(Src->Fields & XVMIX_LAYER_FIELD_SCALE) {
+      Dst->Scale = Src->Scale;
+    }
+    if(Src->Fields & XVMIX_LAYER_FIELD_BUFADDR) {
+      Dst->BufAddr = Src->BufAddr;
+    }
+    if(Src->Fields & XVMIX_LAYER_FIELD_CHROMABUFADDR) {
+      Dst->ChromaBufAddr = Src->ChromaBufAddr;
+    }
+    Dst->Fields |= Src->Fields;
+  }
+  Pending->LayerEnable = (Pending->LayerEnable & ~Scene->LayerEnableMask) |
+                         (Scene->LayerEnable & Scene->LayerEnableMask);
+  Pending->LayerEnableMask |= Scene->LayerEnableMask;
+
+  /* Publish the scene before the flag */
+  XVMIX_PENDING_SYNC();
+  InstancePtr->ScenePending = TRUE;
+}
+
 /*****************************************************************************/
 /**
 * This function reports the mixer status
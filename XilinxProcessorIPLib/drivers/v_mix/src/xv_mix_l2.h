@@ -106,6 +106,10 @@
 * 4.00  vyc   04/04/18   Add 8th overlayer
 *                        Move logo layer enable from bit 8 to bit 15
 * 6.00  pg    01/10/20   Add Colorimetry Feature
+*             10/18/26   Add XVMix_QueueLogo() for tear free logo updates
+*             10/18/26   Add staged scene API for atomic multi-layer updates
+*             10/19/26   Size layer configuration array to cover the logo
+*             10/19/26   Add XVMix_InvalidateShadow()
 * </pre>
 *
 ******************************************************************************/
@@ -134,6 +138,16 @@ extern "C" {
 #define XVMIX_CSC_MATRIX_SIZE	(XVMIX_CSC_MAX_ROWS * XVMIX_CSC_MAX_COLS)
 #define XVMIX_CSC_COEFF_SIZE		(12)
 
+#define XVMIX_SCENE_NUM_SLOTS            (XVMIX_MAX_SUPPORTED_LAYERS + 1)
+
+/* Layer state members, see XVMix_LayerState */
+#define XVMIX_LAYER_FIELD_WINDOW         (0x01)
+#define XVMIX_LAYER_FIELD_STRIDE         (0x02)
+#define XVMIX_LAYER_FIELD_ALPHA          (0x04)
+#define XVMIX_LAYER_FIELD_SCALE          (0x08)
+#define XVMIX_LAYER_FIELD_BUFADDR        (0x10)
+#define XVMIX_LAYER_FIELD_CHROMABUFADDR  (0x20)
+
 /**************************** Type Definitions *******************************/
 /**
  * This typedef enumerates supported background colors
@@ -280,6 +294,44 @@ typedef struct {
     };
 }XVMix_Layer;
 
+/**
+ * This typedef contains a logo image queued for upload at frame boundary
+ */
+typedef struct {
+    XVidC_VideoWindow Win;
+    u8 *RBuffer;
+    u8 *GBuffer;
+    u8 *BBuffer;
+    u8 *ABuffer;           /**< Pixel alpha plane, NULL if not used */
+}XVMix_LogoImage;
+
+/**
+ * This typedef contains the register settings of an overlay or logo layer
+ */
+typedef struct {
+    XVidC_VideoWindow Win;
+    u32 StrideInBytes;
+    u32 Alpha;
+    u32 Scale;
+    UINTPTR BufAddr;
+    UINTPTR ChromaBufAddr;
+    u32 Fields;            /**< XVMIX_LAYER_FIELD_* mask of valid members */
+}XVMix_LayerState;
+
+/**
+ * This typedef contains a mixer scene. Layer settings are staged with the
+ * XVMix_Scene* API and written to the core in one pass by XVMix_ApplyScene()
+ * or XVMix_QueueScene(). Settings that are not staged are left untouched.
+ * Registers already holding a staged value are not written again; after a
+ * core reset outside of XVMix_Start()/XVMix_Stop() call
+ * XVMix_InvalidateShadow().
+ */
+typedef struct {
+    XVMix_LayerState Layer[XVMIX_SCENE_NUM_SLOTS]; /**< Layer 1-16 and Logo */
+    u32 LayerEnable;       /**< Layer enable bits indexed by XVMix_LayerId */
+    u32 LayerEnableMask;   /**< Staged bits of LayerEnable */
+}XVMix_Scene;
+
 /**
 * Callback type for interrupt.
 *
@@ -307,11 +359,18 @@ typedef struct {
     void *CallbackRef;     /**< To be passed to the connect interrupt
                                 callback */
 
-    XVMix_Layer Layer[XVMIX_MAX_SUPPORTED_LAYERS];  /**< Layer configuration
-                                                         structure */
+    XVMix_Layer Layer[XVMIX_LAYER_LAST];  /**< Layer configuration
+                                               structure */
     XVMix_BackgroundId BkgndColor;
 
     XVidC_VideoStream Stream;    /**< Input AXIS */
+
+    XVMix_LogoImage PendingLogo; /**< Logo to load at next frame done */
+    volatile u8 LogoPending;     /**< Flag indicating PendingLogo is valid */
+
+    XVMix_Scene Shadow;          /**< Settings last written by scene API */
+    XVMix_Scene PendingScene;    /**< Scene to apply at next frame done */
+    volatile u8 ScenePending;    /**< Flag indicating PendingScene is valid */
 }XV_Mix_l2;
 
 /************************** Macros Definitions *******************************/
@@ -532,6 +591,44 @@ int XVMix_LoadLogo(XV_Mix_l2 *InstancePtr,
 int XVMix_LoadLogoPixelAlpha(XV_Mix_l2 *InstancePtr,
                              XVidC_VideoWindow *Win,
                              u8 *ABuffer);
+int XVMix_QueueLogo(XV_Mix_l2 *InstancePtr,
+                    XVidC_VideoWindow *Win,
+                    u8 *RBuffer,
+                    u8 *GBuffer,
+                    u8 *BBuffer,
+                    u8 *ABuffer);
+
+void XVMix_SceneInit(XVMix_Scene *Scene);
+int XVMix_SceneLayerEnable(XV_Mix_l2 *InstancePtr,
+                           XVMix_Scene *Scene,
+                           XVMix_LayerId LayerId);
+int XVMix_SceneLayerDisable(XV_Mix_l2 *InstancePtr,
+                            XVMix_Scene *Scene,
+                            XVMix_LayerId LayerId);
+int XVMix_SceneSetLayerWindow(XV_Mix_l2 *InstancePtr,
+                              XVMix_Scene *Scene,
+                              XVMix_LayerId LayerId,
+                              XVidC_VideoWindow *Win,
+                              u32 StrideInBytes);
+int XVMix_SceneSetLayerScaleFactor(XV_Mix_l2 *InstancePtr,
+                                   XVMix_Scene *Scene,
+                                   XVMix_LayerId LayerId,
+                                   XVMix_Scalefactor Scale);
+int XVMix_SceneSetLayerAlpha(XV_Mix_l2 *InstancePtr,
+                             XVMix_Scene *Scene,
+                             XVMix_LayerId LayerId,
+                             u16 Alpha);
+int XVMix_SceneSetLayerBufferAddr(XV_Mix_l2 *InstancePtr,
+                                  XVMix_Scene *Scene,
+                                  XVMix_LayerId LayerId,
+                                  UINTPTR Addr);
+int XVMix_SceneSetLayerChromaBufferAddr(XV_Mix_l2 *InstancePtr,
+                                        XVMix_Scene *Scene,
+                                        XVMix_LayerId LayerId,
+                                        UINTPTR Addr);
+void XVMix_ApplyScene(XV_Mix_l2 *InstancePtr, const XVMix_Scene *Scene);
+void XVMix_QueueScene(XV_Mix_l2 *InstancePtr, const XVMix_Scene *Scene);
+void XVMix_InvalidateShadow(XV_Mix_l2 *InstancePtr);
 
 void XVMix_DbgReportStatus(XV_Mix_l2 *InstancePtr);
 void XVMix_DbgLayerInfo(XV_Mix_l2 *InstancePtr, XVMix_LayerId LayerId);
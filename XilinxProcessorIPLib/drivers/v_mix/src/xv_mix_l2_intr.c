@@ -20,6 +20,8 @@
 * ----- ---- -------- -------------------------------------------------------
 * 1.00  rco   12/14/15   Initial Release
 *             02/12/16   Move user call back before frame start trigger
+*             10/18/26   Load queued logo before frame start trigger
+*             10/18/26   Apply queued scene before frame start trigger
 *
 * </pre>
 *
@@ -65,8 +67,9 @@ int XVMix_SetCallback(XV_Mix_l2 *InstancePtr, void *CallbackFunc, void *Callback
 * This function is the interrupt handler for the mixer core driver.
 *
 * This handler clears the pending interrupt and determined if the source is
-* frame done signal. If yes, starts the next frame processing and calls the
-* registered callback function
+* frame done signal. If yes, calls the registered callback function, applies
+* any scene queued with XVMix_QueueScene(), loads any logo queued with
+* XVMix_QueueLogo() and starts the next frame processing
 *
 * The application is responsible for connecting this function to the interrupt
 * system. Application beyond this driver is also responsible for providing
@@ -102,6 +105,26 @@ void XVMix_InterruptHandler(void *InstancePtr)
     if(MixPtr->FrameDoneCallback) {
 	      MixPtr->FrameDoneCallback(MixPtr->CallbackRef);
     }
+
+    /* Core is idle, update layer registers without tearing */
+    if(MixPtr->ScenePending) {
+      XVMix_ApplyScene(MixPtr, &MixPtr->PendingScene);
+      XVMix_SceneInit(&MixPtr->PendingScene);
+      MixPtr->ScenePending = FALSE;
+    }
+
+    /* Core is idle, update logo BRAM without tearing */
+    if(MixPtr->LogoPending) {
+      XVMix_LoadLogo(MixPtr, &MixPtr->PendingLogo.Win,
+                     MixPtr->PendingLogo.RBuffer,
+                     MixPtr->PendingLogo.GBuffer,
+                     MixPtr->PendingLogo.BBuffer);
+      if(MixPtr->PendingLogo.ABuffer != NULL) {
+        XVMix_LoadLogoPixelAlpha(MixPtr, &MixPtr->PendingLogo.Win,
+                                 MixPtr->PendingLogo.ABuffer);
+      }
+      MixPtr->LogoPending = FALSE;
+    }
     XV_mix_Start(&MixPtr->Mix);
   }
 }
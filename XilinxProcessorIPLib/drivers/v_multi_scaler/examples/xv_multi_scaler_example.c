@@ -312,6 +312,8 @@ int main(void)
 		xil_printf("\nUse case %d:\n", cnt);
 
 		XV_Reset_MultiScaler();
+		/* The reset clears the coefficient banks of the core */
+		XV_MultiScalerInvalidateCoeffCache(MultiScalerPtr);
 		XV_MultiScalerSetNumOutputs(MultiScalerPtr, XNUM_OUTPUTS);
 		num_outs = XV_MultiScalerGetNumOutputs(MultiScalerPtr); 
 		if (num_outs != XNUM_OUTPUTS) {
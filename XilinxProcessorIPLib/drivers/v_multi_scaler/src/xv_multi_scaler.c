@@ -25,6 +25,10 @@ int XV_multi_scaler_CfgInitialize(XV_multi_scaler *InstancePtr,
 	InstancePtr->ScaleMode = ConfigPtr->ScaleMode;
 	InstancePtr->NumTaps = ConfigPtr->NumTaps;
 	InstancePtr->MaxOuts = ConfigPtr->MaxOuts;
+	for (i = 0; i < XV_MAX_OUTS; i++) {
+		InstancePtr->VCoeffLoaded[i] = NULL;
+		InstancePtr->HCoeffLoaded[i] = NULL;
+	}
 	return XST_SUCCESS;
 }
 #endif
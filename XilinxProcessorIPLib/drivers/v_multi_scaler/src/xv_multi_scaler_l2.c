@@ -262,6 +262,9 @@ static const void (*XV_MS_Set_DstImgBuf1[XV_MAX_OUTS])(XV_multi_scaler
 	XV_multi_scaler_Set_HwReg_dstImgBuf1_7_V};
 
 /************************** Function Prototypes ******************************/
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr, float scale);
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr, u32 baseAddr,
+				     const short *coeff);
 static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 				   XV_multi_scaler_Video_Config *MS_cfg);
 
@@ -306,6 +309,29 @@ void XV_MultiScalerStop(XV_multi_scaler *InstancePtr)
 	XV_multi_scaler_DisableAutoRestart(InstancePtr);
 }
 
+/*****************************************************************************/
+/**
+* This function invalidates the cached per-channel coefficient tables so that
+* the next channel configuration programs them in full. It must be called if
+* the core register bank contents are lost.
+*
+* @param	InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_MultiScalerInvalidateCoeffCache(XV_multi_scaler *InstancePtr)
+{
+	u32 i;
+
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	for (i = 0; i < XV_MAX_OUTS; i++) {
+		InstancePtr->VCoeffLoaded[i] = NULL;
+		InstancePtr->HCoeffLoaded[i] = NULL;
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function returns the number of outputs
@@ -344,30 +370,18 @@ void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts)
 
 /*****************************************************************************/
 /**
-* This function programs the computed filter coefficients and phase data into
-* core registers
+* This function selects the coefficient table matching a scaling ratio
 *
 * @param	MscPtr is a pointer to the core instance to be worked on.
-* @param	NumOut is the output channel number.
+* @param	scale is the input to output size ratio.
 *
-* @return None
+* @return Pointer to the coefficient table, NULL if none matches
 *
 ******************************************************************************/
-static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
-		XV_multi_scaler_Video_Config *MS_cfg)
+static const short *XV_MultiScalerSelectCoeff(XV_multi_scaler *MscPtr, float scale)
 {
-	u32 num_phases = 1<<MscPtr->PhaseShift;
-	u32 num_taps	= MscPtr->NumTaps/2;
-	u32 val;
-	u32 i;
-	u32 j;
-	u32 baseAddr;
-	short *coeff;
-	u32 vfltcoef_offset;
-	u32 hfltcoef_offset;
-	float scale;
+	const short *coeff = NULL;
 
-	scale = (float)MS_cfg->HeightIn / MS_cfg->HeightOut;
 	if ((scale >= 2) && (scale < 2.5))
 	{
 		if(MscPtr->NumTaps == 6)
@@ -415,11 +429,29 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 	if(scale < 1)
 		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
 
-	vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+	return coeff;
+}
+
+/*****************************************************************************/
+/**
+* This function writes a coefficient table into a filter coefficient bank
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	baseAddr is the address of the coefficient bank.
+* @param	coeff is the coefficient table to write.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerWriteCoeff(XV_multi_scaler *MscPtr, u32 baseAddr,
+		const short *coeff)
+{
+	u32 num_phases = 1<<MscPtr->PhaseShift;
+	u32 num_taps	= MscPtr->NumTaps/2;
+	u32 val;
+	u32 i;
+	u32 j;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
 	for (i = 0; i < num_phases; i++) {
 		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
 			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
@@ -428,67 +460,52 @@ static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
 					((i * num_taps + j / 2) * 4), val);
 		}
 	}
+}
 
-	scale = (float)MS_cfg->WidthIn / MS_cfg->WidthOut;
-	if ((scale >= 2) && (scale < 2.5))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		else
-			coeff = &XV_multiscaler_fixedcoeff_taps8_12C[0][0];
-	}
-	if ((scale >= 2.5) && (scale < 3))
-	{
-		if(MscPtr->NumTaps >= 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			else
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		}
-	}
-
-	if ((scale >= 3) && (scale < 3.5))
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
-		else
-		{
-			if(MscPtr->NumTaps == 6)
-				coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-			if(MscPtr->NumTaps == 8)
-				coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-			if(MscPtr->NumTaps == 10)
-				coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		}
+/*****************************************************************************/
+/**
+* This function programs the filter coefficients matching the channel scaling
+* ratios into core registers. A bank is written only if the selected table
+* differs from the one already programmed for the channel.
+*
+* @param	MscPtr is a pointer to the core instance to be worked on.
+* @param	MS_cfg is a pointer to the channel configuration.
+*
+* @return None
+*
+******************************************************************************/
+static void XV_MultiScalerSetCoeff(XV_multi_scaler *MscPtr,
+		XV_multi_scaler_Video_Config *MS_cfg)
+{
+	u32 baseAddr;
+	const short *coeff;
+	u32 vfltcoef_offset;
+	u32 hfltcoef_offset;
 
-	if ((scale >= 3.5) || (scale < 2 && scale >= 1))
-	{
-		if(MscPtr->NumTaps == 6)
-			coeff = &XV_multiscaler_fixedcoeff_taps6_6C[0][0];
-		if(MscPtr->NumTaps == 8)
-			coeff = &XV_multiscaler_fixedcoeff_taps8_8C[0][0];
-		if(MscPtr->NumTaps == 10)
-			coeff = &XV_multiscaler_fixedcoeff_taps10_10C[0][0];
-		if(MscPtr->NumTaps == 12)
-			coeff = &XV_multiscaler_fixedcoeff_taps12_12C[0][0];
+	coeff = XV_MultiScalerSelectCoeff(MscPtr,
+			(float)MS_cfg->HeightIn / MS_cfg->HeightOut);
+	if ((coeff != NULL) &&
+	    (coeff != MscPtr->VCoeffLoaded[MS_cfg->ChannelId])) {
+		vfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_VFLTCOEFF_0_BASE +
+			MS_cfg->ChannelId *
+			XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+
+		baseAddr = MscPtr->Ctrl_BaseAddress + vfltcoef_offset;
+		XV_MultiScalerWriteCoeff(MscPtr, baseAddr, coeff);
+		MscPtr->VCoeffLoaded[MS_cfg->ChannelId] = coeff;
 	}
-	if(scale < 1)
-		coeff = &XV_multiscaler_fixedcoeff_taps6_12C[0][0];
-
-	hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
-		MS_cfg->ChannelId *
-		XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
 
-	baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
-	for (i = 0; i < num_phases; i++) {
-		for (j = 0; j < XV_MULTISCALER_TAPS_12; j = j + 2) {
-			val = (coeff[i * XV_MULTISCALER_TAPS_12 + (j + 1)] << 16) |
-				(coeff[i * XV_MULTISCALER_TAPS_12 + j] & 0x0000FFFF);
-			XV_multi_scaler_WriteReg(baseAddr,
-					((i * num_taps + j / 2) * 4), val);
-		}
+	coeff = XV_MultiScalerSelectCoeff(MscPtr,
+			(float)MS_cfg->WidthIn / MS_cfg->WidthOut);
+	if ((coeff != NULL) &&
+	    (coeff != MscPtr->HCoeffLoaded[MS_cfg->ChannelId])) {
+		hfltcoef_offset = XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_HFLTCOEFF_0_BASE +
+			MS_cfg->ChannelId *
+			XV_MULTI_SCALER_CTRL_ADDR_HWREG_MM_FLTCOEFF_OFFSET;
+
+		baseAddr = MscPtr->Ctrl_BaseAddress + hfltcoef_offset;
+		XV_MultiScalerWriteCoeff(MscPtr, baseAddr, coeff);
+		MscPtr->HCoeffLoaded[MS_cfg->ChannelId] = coeff;
 	}
 }
 
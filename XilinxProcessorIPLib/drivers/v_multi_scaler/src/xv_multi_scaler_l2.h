@@ -149,6 +149,7 @@ extern const short XV_multiscaler_fixedcoeff_taps12_12C[XV_MULTISCALER_MAX_V_PHA
 /************************** Function Prototypes ******************************/
 void XV_MultiScalerStart(XV_multi_scaler *InstancePtr);
 void XV_MultiScalerStop(XV_multi_scaler *InstancePtr);
+void XV_MultiScalerInvalidateCoeffCache(XV_multi_scaler *InstancePtr);
 u32 XV_MultiScalerGetNumOutputs(XV_multi_scaler *InstancePtr);
 void XV_MultiScalerSetNumOutputs(XV_multi_scaler *InstancePtr, u32 NumOuts);
 void XV_MultiScalerGetChannelConfig(XV_multi_scaler  *InstancePtr,
@@ -27,6 +27,8 @@
 *       rco   02/09/17   Fix c++ compilation warnings
 *	jsr   09/07/18 Fix for 64-bit driver support
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+*             10/18/26   Skip coefficient upload when the selected table is
+*                        already programmed
 *
 * </pre>
 *
@@ -59,7 +61,7 @@ extern const short XV_vscaler_fixedcoeff_taps10_ScalingRatio4[XV_VSCALER_MAX_V_P
 extern const short XV_vscaler_fixedcoeff_taps12_ScalingRatio4[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_TAPS_12];
 
 /************************** Function Prototypes ******************************/
-static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
+static const short *XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 		                          u32 HeightIn,
 		                          u32 HeightOut);
 
@@ -121,6 +123,25 @@ void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr)
   XV_vscaler_DisableAutoRestart(&InstancePtr->Vsc);
 }
 
+/*****************************************************************************/
+/**
+* This function invalidates the cached coefficient table so that the next
+* call to XV_VScalerSetup() programs it in full. It must be called if the core
+* register bank contents are lost (e.g. after the core has been re-initialized
+* or powered down)
+*
+* @param  InstancePtr is a pointer to the core instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+void XV_VScalerInvalidateCache(XV_Vscaler_l2 *InstancePtr)
+{
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  InstancePtr->CoeffLoaded = NULL;
+}
+
 /*****************************************************************************/
 /**
 * This function loads default filter coefficients in the scaler coefficient
@@ -130,10 +151,13 @@ void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr)
 * @param  WidthIn is the input stream height
 * @param  Widthout is the output stream height
 
-* @return None
+* @return Pointer to the selected table, NULL if the tap count is not supported
+*
+* @note   The table is copied to the coefficient storage only if it differs
+*         from the one currently programmed in the core
 *
 ******************************************************************************/
-static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
+static const short *XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 		                          u32 HeightIn,
 		                          u32 HeightOut)
 {
@@ -145,7 +169,7 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
   /*
    * validates input arguments
    */
-  Xil_AssertVoid(InstancePtr != NULL);
+  Xil_AssertNonvoid(InstancePtr != NULL);
 
   numPhases = (1<<InstancePtr->Vsc.Config.PhaseShift);
 
@@ -224,7 +248,7 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 	break;
 
 	default:
-		return;
+		return NULL;
 	}
   }
   else //Scale Up
@@ -233,13 +257,18 @@ static void XV_VScalerSelectCoeff(XV_Vscaler_l2 *InstancePtr,
 	numTaps = XV_VSCALER_TAPS_6;
   }
 
-  XV_VScalerLoadExtCoeff(InstancePtr,
-		                 numPhases,
-		                 numTaps,
-		                 coeff);
+  if(coeff != InstancePtr->CoeffLoaded)
+  {
+    XV_VScalerLoadExtCoeff(InstancePtr,
+		                   numPhases,
+		                   numTaps,
+		                   coeff);
+  }
 
   /* Disable use of external coefficients */
   InstancePtr->UseExtCoeff = FALSE;
+
+  return coeff;
 }
 
 /*****************************************************************************/
@@ -312,8 +341,9 @@ void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
     }
   }
 
-  /* Enable use of external coefficients */
+  /* Enable use of external coefficients, core copy is now stale */
   InstancePtr->UseExtCoeff = TRUE;
+  InstancePtr->CoeffLoaded = NULL;
 }
 
 /*****************************************************************************/
@@ -374,6 +404,7 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
                     u32            ColorFormat)
 {
   u32 LineRate;
+  const short *CoeffTable;
 
   /*
    * Assert validates the input arguments
@@ -394,11 +425,19 @@ int XV_VScalerSetup(XV_Vscaler_l2  *InstancePtr,
     if(!InstancePtr->UseExtCoeff) //No user defined coefficients
     {
       /* Determine coefficient table to use */
-      XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
+      CoeffTable = XV_VScalerSelectCoeff(InstancePtr,  HeightIn, HeightOut);
+    }
+    else
+    {
+      CoeffTable = &InstancePtr->coeff[0][0];
     }
 
-    /* Program coefficients into the IP register bank */
-    XV_VScalerSetCoeff(InstancePtr);
+    /* Program coefficients into the IP register bank, if not already there */
+    if(CoeffTable != InstancePtr->CoeffLoaded)
+    {
+      XV_VScalerSetCoeff(InstancePtr);
+      InstancePtr->CoeffLoaded = CoeffTable;
+    }
   }
 
   LineRate = (HeightIn * STEP_PRECISION)/HeightOut;
@@ -69,6 +69,8 @@
 * 2.00  rco   11/05/15   Integrate layer-1 with layer-2
 * 3.0   mpe   04/28/16   Added optional color format conversion handling
 * 3.1   vsa   04/07/20   Improve quality with new coefficients
+*             10/18/26   Cache programmed coefficient table, add
+*                        XV_VScalerInvalidateCache()
 *
 * </pre>
 *
@@ -124,6 +126,7 @@ typedef struct
   XV_vscaler Vsc; /*<< Layer 1 instance */
   u8 UseExtCoeff;
   short coeff[XV_VSCALER_MAX_V_PHASES][XV_VSCALER_MAX_V_TAPS];
+  const short *CoeffLoaded; /*<< Coefficient table programmed in the core */
 }XV_Vscaler_l2;
 
 /************************** Macros Definitions *******************************/
@@ -144,6 +147,7 @@ typedef struct
 int XV_VScalerInitialize(XV_Vscaler_l2 *InstancePtr, u16 DeviceId);
 void XV_VScalerStart(XV_Vscaler_l2 *InstancePtr);
 void XV_VScalerStop(XV_Vscaler_l2 *InstancePtr);
+void XV_VScalerInvalidateCache(XV_Vscaler_l2 *InstancePtr);
 void XV_VScalerLoadExtCoeff(XV_Vscaler_l2 *InstancePtr,
                             u16 num_phases,
                             u16 num_taps,
@@ -57,6 +57,7 @@ typedef struct {
     void *CallbackRef;
     UINTPTR RemapVectorDesc_BaseAddr;
     u32 NumDescriptors;
+    void *ArbCache;			/*Per descriptor arbitary warp buffers*/
 } XV_warp_init;
 
 typedef u32 word_type;
@@ -32,11 +32,15 @@ static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
 					unsigned short fr_width, unsigned short fr_height);
 static void XVWarpInit_SetDescriptor(XVWarpInitVector_Hw_Aligned *descptr,
 		XVWarpInitVector_Hw *initvector_hw);
-static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
+static int XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
 		int grid_size, u16 fr_width, u16 fr_height);
-static int XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
-		XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
-		short fr_width, short fr_height);
+static void XVWarpInit_FreeArbMem(XVWarpInit_ArbParam *arbitrary_param);
+static int XVWarpInit_IsArbCached(XVWarpInit_ArbCache *cache,
+		XVWarpInit_InputConfigs *ConfigPtr);
+static int XVWarpInit_ValidateMeshInfo(XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
+		u32 grid_size, short fr_width, short fr_height);
+static void XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
+		XVWarpInit_ArbParam_MeshInfo *ctrl_pts);
 static int XVWarpInit_ValidateInputConfigs(XV_warp_init *InstancePtr,
 		XVWarpInit_InputConfigs *ConfigPtr);
 
@@ -70,6 +74,9 @@ void XVWarpInit_EnableInterrupts(XV_warp_init *InstancePtr,
 * @return XST_SUCCESS if Descriptors created successfully
 *         XST_FAILURE if Descriptors creation failed
 *
+* @note   Descriptors created by an earlier call are released first. On
+*         failure no descriptor is left allocated.
+*
 ******************************************************************************/
 int XVWarpInit_SetNumOfDescriptors(XV_warp_init *InstancePtr,
 		u32 num_desc)
@@ -79,12 +86,14 @@ int XVWarpInit_SetNumOfDescriptors(XV_warp_init *InstancePtr,
 
 	Xil_AssertNonvoid(InstancePtr);
 
+	XVWarpInit_ClearNumOfDescriptors(InstancePtr);
+
 	for (descnum = 0; descnum < num_desc; descnum++)
 	{
 		currptr = XVWarpInit_aligned_malloc(InstancePtr->config->axi_mm_data_width/8,
 				sizeof(XVWarpInitVector_Hw_Aligned));
 		if (currptr == NULL)
-			return XST_FAILURE;
+			break;
 		memset((u32 *)currptr, 0, sizeof(XVWarpInitVector_Hw_Aligned));
 
 		if (descnum == 0)
@@ -100,6 +109,15 @@ int XVWarpInit_SetNumOfDescriptors(XV_warp_init *InstancePtr,
 	InstancePtr->RemapVectorDesc_BaseAddr = (u64)descptr;
 	InstancePtr->NumDescriptors = descnum;
 
+	if (descnum == num_desc)
+		InstancePtr->ArbCache = calloc(num_desc,
+				sizeof(XVWarpInit_ArbCache));
+
+	if (descnum != num_desc || InstancePtr->ArbCache == NULL) {
+		XVWarpInit_ClearNumOfDescriptors(InstancePtr);
+		return XST_FAILURE;
+	}
+
 	return XST_SUCCESS;
 }
 
@@ -115,10 +133,26 @@ int XVWarpInit_SetNumOfDescriptors(XV_warp_init *InstancePtr,
 void XVWarpInit_ClearNumOfDescriptors(XV_warp_init *InstancePtr)
 {
 	XVWarpInitVector_Hw_Aligned *head, *tmpptr;
+	XVWarpInit_ArbCache *cache;
+	u32 i;
 
 	Xil_AssertVoid(InstancePtr);
 
+	cache = (XVWarpInit_ArbCache *)InstancePtr->ArbCache;
+	if (cache) {
+		for (i = 0; i < InstancePtr->NumDescriptors; i++) {
+			if (cache[i].valid)
+				XVWarpInit_FreeArbMem(&cache[i].param);
+		}
+		free(cache);
+		InstancePtr->ArbCache = NULL;
+	}
+
 	head = (XVWarpInitVector_Hw_Aligned *)InstancePtr->RemapVectorDesc_BaseAddr;
+	if (head == NULL) {
+		InstancePtr->NumDescriptors = 0;
+		return;
+	}
 
 	while(head->remap_nextaddr) {
 		tmpptr = (XVWarpInitVector_Hw_Aligned *)head->remap_nextaddr;
@@ -141,15 +175,21 @@ void XVWarpInit_ClearNumOfDescriptors(XV_warp_init *InstancePtr)
 * 					into the descriptor
 *
 * @return XST_SUCCESS if programming descriptor is successful
-*         XST_FAILURE if input configurations are not valid.
+*         XST_FAILURE if input configurations are not valid, the mesh
+*         control points move too far or memory could not be allocated.
+*         On failure the descriptor and its buffers are left unchanged.
 *
 ******************************************************************************/
 int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 		u32 Descnum, XVWarpInit_InputConfigs *ConfigPtr)
 {
 	XVWarpInitVector_Hw desc;
-	XVWarpInit_ArbParam arbit_param;
+	XVWarpInit_ArbCache *cache;
+	XVWarpInit_ArbParam *arbit_param;
+	XVWarpInit_ArbParam new_param, old_param;
 	XVWarpInitVector_Hw_Aligned *descptr;
+	u8 free_old = 0;
+	int Status;
 
 	Xil_AssertNonvoid(InstancePtr);
 
@@ -176,20 +216,47 @@ int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 	desc.height_Q4 = desc.height << REMAP_FIX_ACC;
 
 	if (desc.warp_type == DISTORTION_ARBITARY) {
-		XVWarpInit_AllocArbMem(&arbit_param, ConfigPtr->num_ctrl_pts,
-				desc.width, desc.height);
-		XVWarpInit_ParseMeshInfo(&arbit_param, ConfigPtr->ctr_pts,
-				desc.width, desc.height);
-		desc.src_ctrl_x_pts	= ((u64)arbit_param.src_ctrl_x_pts)/4;
-		desc.src_ctrl_y_pts	= ((u64)arbit_param.src_ctrl_y_pts)/4;
-		desc.src_tangents_x	= ((u64)arbit_param.src_tangents_x)/4;
-		desc.src_tangents_y	= ((u64)arbit_param.src_tangents_y)/4;
-		desc.interm_x			= ((u64)arbit_param.interm_x)/4;
-		desc.interm_y 		= ((u64)arbit_param.interm_y)/4;
-		desc.num_ctrl_pts 	= ConfigPtr->num_ctrl_pts;
+		cache = (XVWarpInit_ArbCache *)InstancePtr->ArbCache + Descnum;
+		arbit_param = &cache->param;
+
+		/* Source points are not cached, check the mesh on every call */
+		Status = XVWarpInit_ValidateMeshInfo(ConfigPtr->ctr_pts,
+				ConfigPtr->num_ctrl_pts, desc.width, desc.height);
+		if (Status != XST_SUCCESS)
+			return Status;
+
+		/* Same mesh as last programmed into this descriptor, reuse it */
+		if (!XVWarpInit_IsArbCached(cache, ConfigPtr)) {
+			/* Build the new buffers aside, the descriptor still
+			 * references the cached ones */
+			Status = XVWarpInit_AllocArbMem(&new_param,
+					ConfigPtr->num_ctrl_pts,
+					desc.width, desc.height);
+			if (Status != XST_SUCCESS) {
+				XVWarpInit_FreeArbMem(&new_param);
+				return Status;
+			}
+			XVWarpInit_ParseMeshInfo(&new_param, ConfigPtr->ctr_pts);
+			XVWarpInit_OnetimeCalcsArbt(&new_param,
+					desc.width, desc.height);
 
-		XVWarpInit_OnetimeCalcsArbt(&arbit_param,
-				desc.width, desc.height);
+			if (cache->valid) {
+				old_param = *arbit_param;
+				free_old = 1;
+			}
+			*arbit_param = new_param;
+			cache->width = desc.width;
+			cache->height = desc.height;
+			cache->valid = 1;
+		}
+
+		desc.src_ctrl_x_pts	= ((u64)arbit_param->src_ctrl_x_pts)/4;
+		desc.src_ctrl_y_pts	= ((u64)arbit_param->src_ctrl_y_pts)/4;
+		desc.src_tangents_x	= ((u64)arbit_param->src_tangents_x)/4;
+		desc.src_tangents_y	= ((u64)arbit_param->src_tangents_y)/4;
+		desc.interm_x			= ((u64)arbit_param->interm_x)/4;
+		desc.interm_y 		= ((u64)arbit_param->interm_y)/4;
+		desc.num_ctrl_pts 	= ConfigPtr->num_ctrl_pts;
 	} else {
 		desc.k_pre	= ConfigPtr->k_pre;
 		desc.k_post	= ConfigPtr->k_post;
@@ -198,6 +265,10 @@ int XVWarpInit_ProgramDescriptor(XV_warp_init *InstancePtr,
 
 	XVWarpInit_SetDescriptor(descptr, &desc);
 
+	/* Old buffers are released once the descriptor no longer uses them */
+	if (free_old)
+		XVWarpInit_FreeArbMem(&old_param);
+
 	return XST_SUCCESS;
 }
 
@@ -617,12 +688,12 @@ static void XVWarpInit_OneTimeCalcs(XVWarpInitVector_Hw *initvector_hw,
 static void apply_arbt_warp_line(short *knots_x, short *knots_y,
 		int grid_pts, int len, int *remap_row)
 {
-	int i, j, j1, j2;
+	int i, j, j1, j2, end;
 	short x;
-	int p1 = 0, p2, p3;
+	int p1 = 0, p3;
 	int a0 = 0, a1 = 0, a2 = 0, a3 = 0;
 	unsigned short diff;
-	char n_bits, diff_bits, x0_bits;
+	char n_bits, diff_bits, x0_bits = 0;
 	unsigned char integerbits;
 	int dx0, dx1, dx2, t, x2;
 	int dy0, dy1, dy2;
@@ -631,9 +702,9 @@ static void apply_arbt_warp_line(short *knots_x, short *knots_y,
 
 	p3 = -1;
 	j = 1;
-	for (i = 0; i < len; i++) {
-		p2 = i;
-		if ((p2 > p3) && (j <= grid_pts)) {
+	i = 0;
+	while (i < len) {
+		if ((i > p3) && (j <= grid_pts)) {
 			p1 = knots_x[j];
 			p3 = knots_x[j + 1];
 
@@ -683,16 +754,30 @@ static void apply_arbt_warp_line(short *knots_x, short *knots_y,
 			j++;
 		}
 
-		x = p2 - p1;
-		a1x1 = a1 * x;
-		x2 = x * x;
-		ll_tmp = a2;
-		a2x2 = (ll_tmp * x2) >> 8;
-		ll_tmp = a3;
-		ll_tmp *= x;
-		a3x3 = (ll_tmp * x2) >> 20;
+		/*
+		 * The coefficients hold until i passes p3 again (or for the rest
+		 * of the line once all segments are consumed), so evaluate the
+		 * whole run in a branch free loop the compiler can vectorize
+		 */
+		end = len;
+		if (j <= grid_pts) {
+			end = (p3 >= i) ? (p3 + 1) : (i + 1);
+			if (end > len)
+				end = len;
+		}
 
-		remap_row[i] = (a3x3 + a2x2 + a1x1 + a0) >> 12;
+		for (; i < end; i++) {
+			x = i - p1;
+			a1x1 = a1 * x;
+			x2 = x * x;
+			ll_tmp = a2;
+			a2x2 = (ll_tmp * x2) >> 8;
+			ll_tmp = a3;
+			ll_tmp *= x;
+			a3x3 = (ll_tmp * x2) >> 20;
+
+			remap_row[i] = (a3x3 + a2x2 + a1x1 + a0) >> 12;
+		}
 	}
 }
 
@@ -922,10 +1007,12 @@ static void XVWarpInit_OnetimeCalcsArbt(XVWarpInit_ArbParam *arbitrary_param,
 * @param	fr_width is the frame width.
 * @param	fr_height is the frame height.
 *
-* @return	None
+* @return	XST_SUCCESS if all the buffers were allocated
+* 			XST_FAILURE otherwise, the buffers that were allocated must be
+* 						released with XVWarpInit_FreeArbMem().
 *
 ******************************************************************************/
-static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
+static int XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
 		int grid_size, u16 fr_width, u16 fr_height)
 {
 	int n_pts;
@@ -934,6 +1021,8 @@ static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
 	n_pts = grid_size + 1;
 	num_ctrl_pts = n_pts * n_pts;
 
+	memset(arbitrary_param, 0, sizeof(XVWarpInit_ArbParam));
+
 	arbitrary_param->grid_size = grid_size;
 	arbitrary_param->num_ctrl_pts = num_ctrl_pts;
 
@@ -948,28 +1037,99 @@ static void XVWarpInit_AllocArbMem(XVWarpInit_ArbParam *arbitrary_param,
 	arbitrary_param->knots_y = (short *)malloc(sizeof(short) * (n_pts+2));
 	arbitrary_param->interm_x = (int *)malloc(sizeof(int) * fr_width * n_pts);
 	arbitrary_param->interm_y = (int *)malloc(sizeof(int) * fr_height * n_pts);
-	arbitrary_param->temp_row = (int *)malloc(sizeof(int) * fr_width);
+	/* Scratch line is used for both the row and the column pass */
+	arbitrary_param->temp_row = (int *)malloc(sizeof(int) *
+			((fr_width > fr_height) ? fr_width : fr_height));
+
+	if (!arbitrary_param->dst_ctrl_x_pts || !arbitrary_param->dst_ctrl_y_pts ||
+			!arbitrary_param->src_ctrl_x_pts ||
+			!arbitrary_param->src_ctrl_y_pts ||
+			!arbitrary_param->src_tangents_x ||
+			!arbitrary_param->src_tangents_y ||
+			!arbitrary_param->knots_x || !arbitrary_param->knots_y ||
+			!arbitrary_param->interm_x || !arbitrary_param->interm_y ||
+			!arbitrary_param->temp_row)
+		return XST_FAILURE;
+
+	return XST_SUCCESS;
 }
 
 /*****************************************************************************/
 /**
-* This function parses the input mesinfo for arbitary distartion.
+* This function frees the memory allocated by XVWarpInit_AllocArbMem().
 *
 * @param	arbitrary_param is the pointer to input Arbitary parameters.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_FreeArbMem(XVWarpInit_ArbParam *arbitrary_param)
+{
+	free(arbitrary_param->dst_ctrl_x_pts);
+	free(arbitrary_param->dst_ctrl_y_pts);
+	free(arbitrary_param->src_ctrl_x_pts);
+	free(arbitrary_param->src_ctrl_y_pts);
+	free(arbitrary_param->src_tangents_x);
+	free(arbitrary_param->src_tangents_y);
+	free(arbitrary_param->knots_x);
+	free(arbitrary_param->knots_y);
+	free(arbitrary_param->interm_x);
+	free(arbitrary_param->interm_y);
+	free(arbitrary_param->temp_row);
+}
+
+/*****************************************************************************/
+/**
+* This function checks if the arbitary warp buffers of a descriptor were
+* calculated for the given frame size and mesh, in which case they can be
+* used as is.
+*
+* @param	cache is the pointer to the descriptor arbitary warp buffers.
+* @param	ConfigPtr is the pointer to input configuration.
+*
+* @return	1 if the buffers match the configuration, 0 otherwise.
+*
+******************************************************************************/
+static int XVWarpInit_IsArbCached(XVWarpInit_ArbCache *cache,
+		XVWarpInit_InputConfigs *ConfigPtr)
+{
+	XVWarpInit_ArbParam *arbitrary_param = &cache->param;
+	u32 i;
+
+	if (!cache->valid || cache->width != ConfigPtr->width ||
+			cache->height != ConfigPtr->height ||
+			arbitrary_param->grid_size != ConfigPtr->num_ctrl_pts)
+		return 0;
+
+	for (i = 0; i < arbitrary_param->num_ctrl_pts; i++) {
+		if (arbitrary_param->dst_ctrl_x_pts[i] !=
+				(u16)ConfigPtr->ctr_pts[i].d_x ||
+				arbitrary_param->dst_ctrl_y_pts[i] !=
+				(u16)ConfigPtr->ctr_pts[i].d_y)
+			return 0;
+	}
+
+	return 1;
+}
+
+/*****************************************************************************/
+/**
+* This function validates the input meshinfo for arbitary distortion.
+*
 * @param	ctrl_pts is the pointer to the input mesh information.
+* @param	grid_size is the grid size for the arbitary distortion.
 * @param	fr_width is the frame width.
 * @param	fr_height is the frame height.
 *
-* @return	XST_SUCCESS if the mesh information parsing successful
+* @return	XST_SUCCESS if the mesh information is valid
 * 			XST_FAILURE if the control points are not valid in the given mesh
 * 						information.
 *
 ******************************************************************************/
-static int XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
-		XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
-		short fr_width, short fr_height)
+static int XVWarpInit_ValidateMeshInfo(XVWarpInit_ArbParam_MeshInfo *ctrl_pts,
+		u32 grid_size, short fr_width, short fr_height)
 {
-	u32 n=arbitrary_param->grid_size, i;
+	u32 n = grid_size, i;
 	short seg_w, seg_h;
 	int s_x, s_y, d_x, d_y;
 
@@ -981,7 +1141,7 @@ static int XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
 	seg_w = fr_width / n;
 	seg_h = fr_height / n;
 
-	for (i = 0; i < arbitrary_param->num_ctrl_pts; i++) {
+	for (i = 0; i < (n + 1) * (n + 1); i++) {
 		s_x = ctrl_pts[i].s_x;
 		s_y = ctrl_pts[i].s_y;
 		d_x = ctrl_pts[i].d_x;
@@ -991,13 +1151,32 @@ static int XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
 					"of distance between control points\n");
 			return XST_FAILURE;
 		}
-
-		arbitrary_param->dst_ctrl_x_pts[i] = d_x;
-		arbitrary_param->dst_ctrl_y_pts[i] = d_y;
 	}
 	return XST_SUCCESS;
 }
 
+/*****************************************************************************/
+/**
+* This function parses the input meshinfo for arbitary distortion. The mesh
+* must have been checked with XVWarpInit_ValidateMeshInfo().
+*
+* @param	arbitrary_param is the pointer to input Arbitary parameters.
+* @param	ctrl_pts is the pointer to the input mesh information.
+*
+* @return	None
+*
+******************************************************************************/
+static void XVWarpInit_ParseMeshInfo(XVWarpInit_ArbParam *arbitrary_param,
+		XVWarpInit_ArbParam_MeshInfo *ctrl_pts)
+{
+	u32 i;
+
+	for (i = 0; i < arbitrary_param->num_ctrl_pts; i++) {
+		arbitrary_param->dst_ctrl_x_pts[i] = ctrl_pts[i].d_x;
+		arbitrary_param->dst_ctrl_y_pts[i] = ctrl_pts[i].d_y;
+	}
+}
+
 /*****************************************************************************/
 /**
 * This function validates the given configs with IP core configs.
@@ -127,6 +127,17 @@ typedef struct {
 	s32 *interm_y;
 } XVWarpInit_ArbParam;
 
+/*
+ * This structure holds the arbitary warp buffers referenced by a
+ * descriptor, along with the frame size they were calculated for
+ */
+typedef struct {
+	u16 width;
+	u16 height;
+	u8 valid;
+	XVWarpInit_ArbParam param;
+} XVWarpInit_ArbCache;
+
 typedef struct {
 	u16	width;
 	u16	height;
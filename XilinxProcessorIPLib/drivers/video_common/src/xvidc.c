@@ -41,6 +41,9 @@
  * 4.3   eb   26/01/18 Added API XVidC_GetVideoModeIdExtensive
  *       jsr  02/22/18 Added XVIDC_CSF_YCBCR_420 color space format
  *       vyc  04/04/18 Added BGR8 memory format
+ *            10/18/26 Look up video mode IDs through sorted key indexes
+ *            10/19/26 Build the built-in index from XVidC_InitVideoModeIndex
+ *                     and drop the key tables
  * </pre>
  *
 *******************************************************************************/
@@ -57,11 +60,31 @@ extern const XVidC_VideoTimingMode XVidC_VideoTimingModes[XVIDC_VM_NUM_SUPPORTED
 const XVidC_VideoTimingMode *XVidC_CustomTimingModes = NULL;
 int XVidC_NumCustomModes = 0;
 
+/* Built-in table entries ordered by (HActive, VActive, FrameRate, VmId), with
+ * the interlaced and progressive ranges sorted separately. Built by
+ * XVidC_InitVideoModeIndex(), the table is searched linearly until then. */
+static u16 XVidC_VmIndex[XVIDC_VM_NUM_SUPPORTED];
+static u8 XVidC_VmIndexValid = (FALSE);
+
+/* Same ordering for the registered custom table, rebuilt on registration.
+ * Larger custom tables are searched linearly. */
+static u16 XVidC_CustomIndex[XVIDC_CUSTOM_INDEX_SIZE];
+static const XVidC_VideoTimingMode *XVidC_CustomIndexTable = NULL;
+
 /**************************** Function Prototypes *****************************/
 
 static const XVidC_VideoTimingMode *XVidC_GetCustomVideoModeData(
 		XVidC_VideoMode VmId);
 static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN);
+static u64 XVidC_GetVtmKey(const XVidC_VideoTimingMode *Vtm);
+static void XVidC_SortVtmIndex(const XVidC_VideoTimingMode *Table,
+		u16 *IndexTbl, u16 First, u16 Count);
+static u16 XVidC_FindVtmIndex(const XVidC_VideoTimingMode *Table,
+		const u16 *IndexTbl, u16 Count, u64 Key);
+static u8 XVidC_IsTimingMatch(const XVidC_VideoTiming *StdTiming,
+		const XVidC_VideoTiming *Timing, u8 IsInterlaced);
+static XVidC_VideoMode XVidC_FindVideoMode(u32 Width, u32 Height,
+		u32 FrameRate, u8 IsInterlaced, const XVidC_VideoTiming *Timing);
 
 /*************************** Function Definitions *****************************/
 
@@ -105,6 +128,11 @@ u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 	XVidC_CustomTimingModes = CustomTable;
 	XVidC_NumCustomModes    = NumElems;
 
+	if (NumElems <= XVIDC_CUSTOM_INDEX_SIZE) {
+		XVidC_SortVtmIndex(CustomTable, XVidC_CustomIndex, 0, NumElems);
+		XVidC_CustomIndexTable = CustomTable;
+	}
+
 	return XST_SUCCESS;
 }
 
@@ -122,6 +150,36 @@ void XVidC_UnregisterCustomTimingModes(void)
 {
 	XVidC_CustomTimingModes = NULL;
 	XVidC_NumCustomModes    = 0;
+	XVidC_CustomIndexTable  = NULL;
+}
+
+/******************************************************************************/
+/**
+ * This function builds the index used to look up video mode IDs in the
+ * pre-defined video mode timing table (XVidC_VideoTimingModes).
+ *
+ * @return	None.
+ *
+ * @note	Call once at start up, before video mode IDs are looked up from
+ *		interrupt context. Until then XVidC_GetVideoModeId and
+ *		XVidC_GetVideoModeIdExtensive search the table linearly.
+ *
+*******************************************************************************/
+void XVidC_InitVideoModeIndex(void)
+{
+	if (XVidC_VmIndexValid) {
+		return;
+	}
+
+	XVidC_SortVtmIndex(XVidC_VideoTimingModes,
+			&XVidC_VmIndex[XVIDC_VM_INTL_START],
+			XVIDC_VM_INTL_START,
+			XVIDC_VM_INTL_END - XVIDC_VM_INTL_START + 1);
+	XVidC_SortVtmIndex(XVidC_VideoTimingModes,
+			&XVidC_VmIndex[XVIDC_VM_PROG_START],
+			XVIDC_VM_PROG_START,
+			XVIDC_VM_PROG_END - XVIDC_VM_PROG_START + 1);
+	XVidC_VmIndexValid = (TRUE);
 }
 
 /******************************************************************************/
@@ -317,106 +375,7 @@ XVidC_VideoMode XVidC_GetVideoModeIdWBlanking(const XVidC_VideoTiming *Timing,
 XVidC_VideoMode XVidC_GetVideoModeId(u32 Width, u32 Height, u32 FrameRate,
 					u8 IsInterlaced)
 {
-	u32 Low;
-	u32 High;
-	u32 Mid;
-	u32 HActive;
-	u32 VActive;
-	u32 Rate;
-	u32 ResFound = (FALSE);
-	XVidC_VideoMode Mode;
-	u16 Index;
-
-	/* First, attempt a linear search on the custom video timing table. */
-	if(XVidC_CustomTimingModes) {
-	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
-		HActive = XVidC_CustomTimingModes[Index].Timing.HActive;
-		VActive = XVidC_CustomTimingModes[Index].Timing.VActive;
-		Rate = XVidC_CustomTimingModes[Index].FrameRate;
-		if ((Width  == HActive) &&
-			(Height == VActive) &&
-			(FrameRate == Rate)) {
-			   return XVidC_CustomTimingModes[Index].VmId;
-		}
-	  }
-	}
-
-	if (IsInterlaced) {
-		Low = (XVIDC_VM_INTL_START);
-		High = (XVIDC_VM_INTL_END);
-	}
-	else {
-		Low = (XVIDC_VM_PROG_START);
-		High = (XVIDC_VM_PROG_END);
-	}
-
-	HActive = VActive = Rate = 0;
-
-	/* Binary search finds item in sorted array.
-	 * And returns index (zero based) of item
-	 * If item is not found returns flag remains
-	 * FALSE. Search key is "width or HActive"
-	 */
-	while (Low <= High) {
-		Mid = (Low + High) / 2;
-		HActive = XVidC_VideoTimingModes[Mid].Timing.HActive;
-		if (Width == HActive) {
-			ResFound = (TRUE);
-			break;
-		}
-		else if (Width < HActive) {
-			if (Mid == 0) {
-				break;
-			}
-			else {
-				High = Mid - 1;
-			}
-		}
-		else {
-			Low = Mid + 1;
-		}
-	}
-
-	 /* HActive matched at middle */
-	if (ResFound) {
-		/* Rewind to start index of mode with matching width */
-		while ((Mid > 0) &&
-			(XVidC_VideoTimingModes[Mid - 1].Timing.HActive ==
-								Width)) {
-			--Mid;
-		}
-
-		ResFound = (FALSE);
-		VActive = XVidC_VideoTimingModes[Mid].Timing.VActive;
-		Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-
-		/* Now do a linear search for matching VActive and Frame
-		 * Rate
-		 */
-		while (HActive == Width) {
-			/* check current entry */
-			if ((VActive == Height) && (Rate == FrameRate)) {
-				ResFound = (TRUE);
-				break;
-			}
-			/* Check next entry */
-			else {
-				Mid = Mid + 1;
-				HActive =
-				XVidC_VideoTimingModes[Mid].Timing.HActive;
-				VActive =
-				XVidC_VideoTimingModes[Mid].Timing.VActive;
-				Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-			}
-		}
-		Mode =
-		(ResFound) ? (XVidC_VideoMode)Mid : (XVIDC_VM_NOT_SUPPORTED);
-	}
-	else {
-		Mode = (XVIDC_VM_NOT_SUPPORTED);
-	}
-
-	return (Mode);
+	return XVidC_FindVideoMode(Width, Height, FrameRate, IsInterlaced, NULL);
 }
 
 /******************************************************************************/
@@ -444,156 +403,8 @@ XVidC_VideoMode XVidC_GetVideoModeIdExtensive(XVidC_VideoTiming *Timing,
 											  u8 IsInterlaced,
 											  u8 IsExtensive)
 {
-	u32 Low;
-	u32 High;
-	u32 Mid;
-	u32 HActive;
-	u32 VActive;
-	u32 Rate;
-	u32 ResFound = (FALSE);
-	XVidC_VideoMode Mode;
-	u16 Index;
-
-	/* First, attempt a linear search on the custom video timing table. */
-	if(XVidC_CustomTimingModes) {
-	  for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
-		HActive = XVidC_CustomTimingModes[Index].Timing.HActive;
-		VActive = XVidC_CustomTimingModes[Index].Timing.VActive;
-		Rate = XVidC_CustomTimingModes[Index].FrameRate;
-		if ((HActive == Timing->HActive) && (VActive == Timing->VActive) &&
-				(Rate == FrameRate) && (IsExtensive == 0 || (
-			XVidC_CustomTimingModes[Index].Timing.HTotal == Timing->HTotal &&
-			XVidC_CustomTimingModes[Index].Timing.F0PVTotal ==
-					Timing->F0PVTotal &&
-			XVidC_CustomTimingModes[Index].Timing.HFrontPorch ==
-					Timing->HFrontPorch &&
-			XVidC_CustomTimingModes[Index].Timing.F0PVFrontPorch ==
-					Timing->F0PVFrontPorch &&
-			XVidC_CustomTimingModes[Index].Timing.HSyncWidth ==
-					Timing->HSyncWidth &&
-			XVidC_CustomTimingModes[Index].Timing.F0PVSyncWidth ==
-					Timing->F0PVSyncWidth &&
-			XVidC_CustomTimingModes[Index].Timing.VSyncPolarity ==
-					Timing->VSyncPolarity))) {
-				if (!IsInterlaced || IsExtensive == 0 || (
-						XVidC_CustomTimingModes[Index].Timing.F1VTotal ==
-						Timing->F1VTotal &&
-						XVidC_CustomTimingModes[Index].Timing.F1VFrontPorch ==
-								Timing->F1VFrontPorch &&
-						XVidC_CustomTimingModes[Index].Timing.F1VSyncWidth ==
-								Timing->F1VSyncWidth)) {
-					return XVidC_CustomTimingModes[Index].VmId;
-				}
-		}
-	  }
-	}
-
-	if (IsInterlaced) {
-		Low = (XVIDC_VM_INTL_START);
-		High = (XVIDC_VM_INTL_END);
-	}
-	else {
-		Low = (XVIDC_VM_PROG_START);
-		High = (XVIDC_VM_PROG_END);
-	}
-
-	HActive = VActive = Rate = 0;
-
-	/* Binary search finds item in sorted array.
-	 * And returns index (zero based) of item
-	 * If item is not found returns flag remains
-	 * FALSE. Search key is "Timing->HActive or HActive"
-	 */
-	while (Low <= High) {
-		Mid = (Low + High) / 2;
-		HActive = XVidC_VideoTimingModes[Mid].Timing.HActive;
-		if (Timing->HActive == HActive) {
-			ResFound = (TRUE);
-			break;
-		}
-		else if (Timing->HActive < HActive) {
-			if (Mid == 0) {
-				break;
-			}
-			else {
-				High = Mid - 1;
-			}
-		}
-		else {
-			Low = Mid + 1;
-		}
-	}
-
-	 /* HActive matched at middle */
-	if (ResFound) {
-		/* Rewind to start index of mode with matching Timing->HActive */
-		while ((Mid > 0) &&
-			(XVidC_VideoTimingModes[Mid - 1].Timing.HActive ==
-								Timing->HActive)) {
-			--Mid;
-		}
-
-		ResFound = (FALSE);
-		VActive = XVidC_VideoTimingModes[Mid].Timing.VActive;
-		Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-
-		/* Now do a linear search for matching VActive and Frame
-		 * Rate
-		 */
-		while (HActive == Timing->HActive) {
-			/* check current entry */
-			if ((VActive == Timing->VActive) && (Rate == FrameRate) &&
-					(IsExtensive == 0 ||
-					(XVidC_VideoTimingModes[Mid].Timing.HTotal ==
-							Timing->HTotal &&
-					XVidC_VideoTimingModes[Mid].Timing.F0PVTotal ==
-							Timing->F0PVTotal &&
-					XVidC_VideoTimingModes[Mid].Timing.HFrontPorch ==
-							Timing->HFrontPorch &&
-					XVidC_VideoTimingModes[Mid].Timing.F0PVFrontPorch ==
-							Timing->F0PVFrontPorch &&
-					XVidC_VideoTimingModes[Mid].Timing.HSyncWidth ==
-							Timing->HSyncWidth &&
-					XVidC_VideoTimingModes[Mid].Timing.F0PVSyncWidth ==
-							Timing->F0PVSyncWidth &&
-					XVidC_VideoTimingModes[Mid].Timing.VSyncPolarity ==
-							Timing->VSyncPolarity))) {
-				if (!IsInterlaced || IsExtensive == 0 || (
-						XVidC_VideoTimingModes[Mid].Timing.F1VTotal ==
-								Timing->F1VTotal &&
-						XVidC_VideoTimingModes[Mid].Timing.F1VFrontPorch ==
-								Timing->F1VFrontPorch &&
-						XVidC_VideoTimingModes[Mid].Timing.F1VSyncWidth ==
-								Timing->F1VSyncWidth)) {
-					ResFound = (TRUE);
-					break;
-				} else {
-					Mid = Mid + 1;
-					HActive =
-					XVidC_VideoTimingModes[Mid].Timing.HActive;
-					VActive =
-					XVidC_VideoTimingModes[Mid].Timing.VActive;
-					Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-				}
-			}
-			/* Check next entry */
-			else {
-				Mid = Mid + 1;
-				HActive =
-				XVidC_VideoTimingModes[Mid].Timing.HActive;
-				VActive =
-				XVidC_VideoTimingModes[Mid].Timing.VActive;
-				Rate = XVidC_VideoTimingModes[Mid].FrameRate;
-			}
-		}
-		Mode =
-		(ResFound) ? (XVidC_VideoMode)Mid : (XVIDC_VM_NOT_SUPPORTED);
-	}
-	else {
-		Mode = (XVIDC_VM_NOT_SUPPORTED);
-	}
-
-	return (Mode);
+	return XVidC_FindVideoMode(Timing->HActive, Timing->VActive, FrameRate,
+			IsInterlaced, (IsExtensive) ? Timing : NULL);
 }
 
 /******************************************************************************/
@@ -1218,4 +1029,232 @@ static u8 XVidC_IsVtmRb(const char *VideoModeStr, u8 RbN)
 	}
 	return 0;
 }
+/******************************************************************************/
+/**
+ * This function returns the lookup key of a video timing mode.
+ *
+ * @param	Vtm is a pointer to the video timing mode.
+ *
+ * @return	HActive, VActive and FrameRate packed into a single value which
+ *		orders modes the same way as comparing the fields in turn.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u64 XVidC_GetVtmKey(const XVidC_VideoTimingMode *Vtm)
+{
+	return ((u64)Vtm->Timing.HActive << 32) |
+		((u64)Vtm->Timing.VActive << 16) |
+		(u64)(u16)Vtm->FrameRate;
+}
+
+/******************************************************************************/
+/**
+ * This function fills an index table with the positions of a range of video
+ * timing table entries, sorted by lookup key. Entries with equal keys keep
+ * their table order so a lookup returns the same mode a linear scan would.
+ *
+ * @param	Table is a pointer to the video timing table.
+ * @param	IndexTbl is a pointer to the index table to fill.
+ * @param	First is the position of the first table entry to index.
+ * @param	Count is the number of table entries to index.
+ *
+ * @return	None.
+ *
+ * @note	Insertion sort; the tables are small and already mostly ordered.
+ *
+*******************************************************************************/
+static void XVidC_SortVtmIndex(const XVidC_VideoTimingMode *Table,
+		u16 *IndexTbl, u16 First, u16 Count)
+{
+	u16 Index;
+	u16 Pos;
+	u16 Entry;
+	u64 Key;
+
+	for (Index = 0; Index < Count; Index++) {
+		Entry = First + Index;
+		Key = XVidC_GetVtmKey(&Table[Entry]);
+
+		for (Pos = Index; (Pos > 0) &&
+		     (XVidC_GetVtmKey(&Table[IndexTbl[Pos - 1]]) > Key); Pos--) {
+			IndexTbl[Pos] = IndexTbl[Pos - 1];
+		}
+		IndexTbl[Pos] = Entry;
+	}
+}
+
+/******************************************************************************/
+/**
+ * This function searches a sorted index table for the first entry whose key is
+ * not less than the given key.
+ *
+ * @param	Table is a pointer to the video timing table.
+ * @param	IndexTbl is a pointer to the sorted index table.
+ * @param	Count is the number of entries in the index table.
+ * @param	Key is the lookup key to search for.
+ *
+ * @return	Position in IndexTbl, Count if all keys are less than Key.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u16 XVidC_FindVtmIndex(const XVidC_VideoTimingMode *Table,
+		const u16 *IndexTbl, u16 Count, u64 Key)
+{
+	u32 Low = 0;
+	u32 High = Count;
+	u32 Mid;
+
+	while (Low < High) {
+		Mid = (Low + High) / 2;
+		if (XVidC_GetVtmKey(&Table[IndexTbl[Mid]]) < Key) {
+			Low = Mid + 1;
+		}
+		else {
+			High = Mid;
+		}
+	}
+
+	return (u16)Low;
+}
+
+/******************************************************************************/
+/**
+ * This function checks the blanking and sync parameters of a video timing
+ * against a reference timing.
+ *
+ * @param	StdTiming is a pointer to the reference timing.
+ * @param	Timing is a pointer to the timing to check.
+ * @param	IsInterlaced specifies whether field 1 is checked as well.
+ *
+ * @return	TRUE if the timings match, FALSE otherwise.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XVidC_IsTimingMatch(const XVidC_VideoTiming *StdTiming,
+		const XVidC_VideoTiming *Timing, u8 IsInterlaced)
+{
+	if ((StdTiming->HTotal         != Timing->HTotal) ||
+	    (StdTiming->F0PVTotal      != Timing->F0PVTotal) ||
+	    (StdTiming->HFrontPorch    != Timing->HFrontPorch) ||
+	    (StdTiming->F0PVFrontPorch != Timing->F0PVFrontPorch) ||
+	    (StdTiming->HSyncWidth     != Timing->HSyncWidth) ||
+	    (StdTiming->F0PVSyncWidth  != Timing->F0PVSyncWidth) ||
+	    (StdTiming->VSyncPolarity  != Timing->VSyncPolarity)) {
+		return (FALSE);
+	}
+
+	if (IsInterlaced &&
+	    ((StdTiming->F1VTotal      != Timing->F1VTotal) ||
+	     (StdTiming->F1VFrontPorch != Timing->F1VFrontPorch) ||
+	     (StdTiming->F1VSyncWidth  != Timing->F1VSyncWidth))) {
+		return (FALSE);
+	}
+
+	return (TRUE);
+}
+
+/******************************************************************************/
+/**
+ * This function searches the custom and the built-in video timing tables for
+ * the first mode matching the given resolution and frame rate, and optionally
+ * the given blanking and sync parameters.
+ *
+ * @param	Width specifies the number pixels per scanline.
+ * @param	Height specifies the number of scanline's.
+ * @param	FrameRate specifies refresh rate in HZ
+ * @param	IsInterlaced specifies interlaced or progressive mode.
+ * @param	Timing is a pointer to the timing parameters to match, or NULL
+ *		to match on resolution and frame rate only.
+ *
+ * @return	Id of a supported video mode.
+ *
+ * @note	Custom modes are matched regardless of IsInterlaced and take
+ *		precedence over built-in modes.
+ *
+*******************************************************************************/
+static XVidC_VideoMode XVidC_FindVideoMode(u32 Width, u32 Height,
+		u32 FrameRate, u8 IsInterlaced, const XVidC_VideoTiming *Timing)
+{
+	const XVidC_VideoTimingMode *Vtm;
+	u64 Key;
+	u16 First;
+	u16 Count;
+	u16 Pos;
+	int Index;
+
+	/* Timing tables only hold 16 bit values */
+	if ((Width > 0xFFFF) || (Height > 0xFFFF) || (FrameRate > 0xFFFF)) {
+		return (XVIDC_VM_NOT_SUPPORTED);
+	}
+	Key = ((u64)Width << 32) | ((u64)Height << 16) | (u64)FrameRate;
+
+	/* First, search the custom video timing table. */
+	if (XVidC_CustomTimingModes) {
+		if (XVidC_CustomIndexTable == XVidC_CustomTimingModes) {
+			Count = (u16)XVidC_NumCustomModes;
+			Pos = XVidC_FindVtmIndex(XVidC_CustomTimingModes,
+					XVidC_CustomIndex, Count, Key);
+			for (; Pos < Count; Pos++) {
+				Vtm = &XVidC_CustomTimingModes[XVidC_CustomIndex[Pos]];
+				if (XVidC_GetVtmKey(Vtm) != Key) {
+					break;
+				}
+				if (!Timing || XVidC_IsTimingMatch(&Vtm->Timing,
+							Timing, IsInterlaced)) {
+					return Vtm->VmId;
+				}
+			}
+		}
+		else {
+			for (Index = 0; Index < XVidC_NumCustomModes; Index++) {
+				Vtm = &XVidC_CustomTimingModes[Index];
+				if ((XVidC_GetVtmKey(Vtm) == Key) &&
+				    (!Timing || XVidC_IsTimingMatch(&Vtm->Timing,
+							Timing, IsInterlaced))) {
+					return Vtm->VmId;
+				}
+			}
+		}
+	}
+
+	if (IsInterlaced) {
+		First = (XVIDC_VM_INTL_START);
+		Count = (XVIDC_VM_INTL_END - XVIDC_VM_INTL_START + 1);
+	}
+	else {
+		First = (XVIDC_VM_PROG_START);
+		Count = (XVIDC_VM_PROG_END - XVIDC_VM_PROG_START + 1);
+	}
+
+	if (!XVidC_VmIndexValid) {
+		for (Index = First; Index < (First + Count); Index++) {
+			Vtm = &XVidC_VideoTimingModes[Index];
+			if ((XVidC_GetVtmKey(Vtm) == Key) &&
+			    (!Timing || XVidC_IsTimingMatch(&Vtm->Timing,
+						Timing, IsInterlaced))) {
+				return (XVidC_VideoMode)Index;
+			}
+		}
+		return (XVIDC_VM_NOT_SUPPORTED);
+	}
+
+	Pos = XVidC_FindVtmIndex(XVidC_VideoTimingModes, &XVidC_VmIndex[First],
+			Count, Key);
+	for (; Pos < Count; Pos++) {
+		Vtm = &XVidC_VideoTimingModes[XVidC_VmIndex[First + Pos]];
+		if (XVidC_GetVtmKey(Vtm) != Key) {
+			break;
+		}
+		if (!Timing ||
+		    XVidC_IsTimingMatch(&Vtm->Timing, Timing, IsInterlaced)) {
+			return (XVidC_VideoMode)XVidC_VmIndex[First + Pos];
+		}
+	}
+
+	return (XVIDC_VM_NOT_SUPPORTED);
+}
+
 /** @} */
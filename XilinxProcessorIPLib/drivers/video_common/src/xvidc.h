@@ -54,6 +54,8 @@
  * 4.6   mmo  02/14/19 Added 5k, 8k, 10k and Low Resolution with 200Hz, 240Hz
  * 4.12  kp   15/07/21 Added new 3planar video formats and video timing modes
          kp   24/08/21 Added new video timing modes related to different VTotal
+ *            10/18/26 Added XVIDC_CUSTOM_INDEX_SIZE
+ *            10/19/26 Added XVidC_InitVideoModeIndex
  * </pre>
  *
 *******************************************************************************/
@@ -72,6 +74,15 @@ extern "C" {
 
 /************************** Constant Definitions ******************************/
 
+/**
+ * Maximum number of custom video modes indexed for fast lookup. Larger custom
+ * tables registered with XVidC_RegisterCustomTimingModes are searched
+ * linearly.
+ */
+#ifndef XVIDC_CUSTOM_INDEX_SIZE
+#define XVIDC_CUSTOM_INDEX_SIZE	64
+#endif
+
 /**
  * This typedef enumerates the list of available standard display monitor
  * timings as specified in the xvidc_timings_table.c file. The naming format is:
@@ -648,6 +659,7 @@ typedef void (*XVidC_DelayHandler)(void *TimerPtr, u32 Delay);
 u32 XVidC_RegisterCustomTimingModes(const XVidC_VideoTimingMode *CustomTable,
 		                            u16 NumElems);
 void XVidC_UnregisterCustomTimingModes(void);
+void XVidC_InitVideoModeIndex(void);
 u64 XVidC_GetPixelClockHzByHVFr(u32 HTotal, u32 VTotal, u8 FrameRate);
 u64 XVidC_GetPixelClockHzByVmId(XVidC_VideoMode VmId);
 XVidC_VideoFormat XVidC_GetVideoFormat(XVidC_VideoMode VmId);
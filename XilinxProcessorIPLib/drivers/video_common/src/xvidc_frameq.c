@@ -0,0 +1,386 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_frameq.c
+ * @addtogroup video_common_v4_13
+ * @{
+ *
+ * Contains the frame queue functions. See xvidc_frameq.h for a description of
+ * the producer and consumer roles.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13       10/19/26 Initial release.
+ *            10/19/26 Added the V plane address of 3 planar formats.
+ * </pre>
+ *
+*******************************************************************************/
+
+/******************************* Include Files ********************************/
+
+#include <string.h>
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_frameq.h"
+#ifndef __linux__
+#include "xil_io.h"
+#endif
+
+/**************************** Constant Definitions ****************************/
+
+/* Orders ring entry and buffer accesses against ring index updates. */
+#if defined(__linux__)
+#define XVIDC_FRAMEQ_SYNC()	__sync_synchronize()
+#elif defined(__GNUC__)
+#define XVIDC_FRAMEQ_SYNC() \
+	do { \
+		__asm__ __volatile__("" : : : "memory"); \
+		DATA_SYNC; \
+	} while (0)
+#else
+#define XVIDC_FRAMEQ_SYNC()	DATA_SYNC
+#endif
+
+/**************************** Function Prototypes *****************************/
+
+static u8 XVidC_FrameQNextPos(const XVidC_FrameQ *FrameQ, u8 Pos);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function initializes a frame queue with a set of frame buffers. All
+ * buffers start out free, available to the producer.
+ *
+ * @param	FrameQ is a pointer to the frame queue to initialize.
+ * @param	Addr is an array of NumBufs luma or packed plane addresses.
+ * @param	ChromaAddr is an array of NumBufs UV or U plane addresses, or
+ *		NULL for single plane formats.
+ * @param	VChromaAddr is an array of NumBufs V plane addresses, or NULL
+ *		for formats with less than 3 planes.
+ * @param	NumBufs is the number of frame buffers. At least three are
+ *		needed for the producer and consumer to each hold one buffer
+ *		while a third is in transit.
+ * @param	Policy selects the frame returned to the consumer.
+ *
+ * @return
+ *		- XST_SUCCESS if the queue was initialized.
+ *		- XST_INVALID_PARAM if NumBufs is 0 or larger than
+ *		  XVIDC_FRAMEQ_MAX_BUFS.
+ *
+ * @note	The queue must not be in use while it is initialized.
+ *
+*******************************************************************************/
+u32 XVidC_FrameQInit(XVidC_FrameQ *FrameQ, const UINTPTR *Addr,
+		const UINTPTR *ChromaAddr, const UINTPTR *VChromaAddr,
+		u8 NumBufs, XVidC_FrameQPolicy Policy)
+{
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(FrameQ != NULL);
+	Xil_AssertNonvoid(Addr != NULL);
+	Xil_AssertNonvoid((Policy == XVIDC_FRAMEQ_FIFO) ||
+			  (Policy == XVIDC_FRAMEQ_LATEST));
+
+	if ((NumBufs == 0) || (NumBufs > XVIDC_FRAMEQ_MAX_BUFS)) {
+		return XST_INVALID_PARAM;
+	}
+
+	memset(FrameQ, 0, sizeof(XVidC_FrameQ));
+	FrameQ->NumBufs = NumBufs;
+	FrameQ->Policy = Policy;
+
+	for (Index = 0; Index < NumBufs; Index++) {
+		FrameQ->Buf[Index].Addr = Addr[Index];
+		FrameQ->Buf[Index].ChromaAddr =
+				(ChromaAddr != NULL) ? ChromaAddr[Index] : 0;
+		FrameQ->Buf[Index].VChromaAddr =
+				(VChromaAddr != NULL) ? VChromaAddr[Index] : 0;
+		FrameQ->Buf[Index].Index = Index;
+		FrameQ->FreeRing[Index] = Index;
+	}
+	FrameQ->FreeHead = NumBufs;
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function installs the function used to time stamp frames when the
+ * producer puts them into the queue.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ * @param	TimeFunc is the time stamp function, or NULL to store 0.
+ * @param	TimeRef is passed to TimeFunc.
+ *
+ * @return	None.
+ *
+ * @note	TimeFunc is called from the producer context, which is usually
+ *		an interrupt handler.
+ *
+*******************************************************************************/
+void XVidC_FrameQSetTimeFunc(XVidC_FrameQ *FrameQ,
+		XVidC_FrameQTimeFunc TimeFunc, void *TimeRef)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(FrameQ != NULL);
+
+	FrameQ->TimeFunc = TimeFunc;
+	FrameQ->TimeRef = TimeRef;
+}
+
+/******************************************************************************/
+/**
+ * This function takes a free buffer for the producer to write the next frame
+ * into.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ *
+ * @return	Pointer to the buffer, or NULL if no buffer is free.
+ *
+ * @note	Producer only.
+ *
+*******************************************************************************/
+XVidC_FrameBuf *XVidC_FrameQGetWriteBuf(XVidC_FrameQ *FrameQ)
+{
+	u8 Tail;
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(FrameQ != NULL);
+
+	Tail = FrameQ->FreeTail;
+	if (Tail == FrameQ->FreeHead) {
+		return NULL;
+	}
+
+	XVIDC_FRAMEQ_SYNC();
+	Index = FrameQ->FreeRing[Tail];
+	FrameQ->FreeTail = XVidC_FrameQNextPos(FrameQ, Tail);
+
+	return &FrameQ->Buf[Index];
+}
+
+/******************************************************************************/
+/**
+ * This function time stamps a frame written by the producer and passes it to
+ * the consumer.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ * @param	Buf is a pointer to the written buffer, obtained from
+ *		XVidC_FrameQGetWriteBuf().
+ *
+ * @return	None.
+ *
+ * @note	Producer only.
+ *
+*******************************************************************************/
+void XVidC_FrameQPutWriteBuf(XVidC_FrameQ *FrameQ, XVidC_FrameBuf *Buf)
+{
+	u8 Head;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(FrameQ != NULL);
+	Xil_AssertVoid(Buf != NULL);
+	Xil_AssertVoid(Buf->Index < FrameQ->NumBufs);
+
+	Buf->FrameNum = FrameQ->FrameNum++;
+	Buf->Timestamp = (FrameQ->TimeFunc != NULL) ?
+			FrameQ->TimeFunc(FrameQ->TimeRef) : 0;
+
+	Head = FrameQ->ReadyHead;
+	FrameQ->ReadyRing[Head] = Buf->Index;
+
+	/* Publish the entry and the buffer contents before the index */
+	XVIDC_FRAMEQ_SYNC();
+	FrameQ->ReadyHead = XVidC_FrameQNextPos(FrameQ, Head);
+}
+
+/******************************************************************************/
+/**
+ * This function passes a completed frame to the consumer and returns the
+ * buffer to write the next frame into. If no buffer is free the completed
+ * frame is dropped and its buffer is returned to be written again.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ * @param	Done is a pointer to the completed buffer, or NULL to only
+ *		take a buffer.
+ *
+ * @return	Pointer to the buffer to write next. NULL only if Done is NULL
+ *		and no buffer is free.
+ *
+ * @note	Producer only. Intended to be called from the frame done
+ *		interrupt of the producer.
+ *
+*******************************************************************************/
+XVidC_FrameBuf *XVidC_FrameQSwapWriteBuf(XVidC_FrameQ *FrameQ,
+		XVidC_FrameBuf *Done)
+{
+	XVidC_FrameBuf *Next;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(FrameQ != NULL);
+
+	Next = XVidC_FrameQGetWriteBuf(FrameQ);
+	if (Next == NULL) {
+		if (Done != NULL) {
+			FrameQ->FrameNum++;
+			FrameQ->DroppedFrames++;
+		}
+		return Done;
+	}
+
+	if (Done != NULL) {
+		XVidC_FrameQPutWriteBuf(FrameQ, Done);
+	}
+
+	return Next;
+}
+
+/******************************************************************************/
+/**
+ * This function takes a written frame for the consumer. With the
+ * XVIDC_FRAMEQ_FIFO policy the oldest frame is returned. With the
+ * XVIDC_FRAMEQ_LATEST policy the newest frame is returned and older ready
+ * frames are released.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ *
+ * @return	Pointer to the buffer, or NULL if no frame is ready.
+ *
+ * @note	Consumer only. The buffer must be released with
+ *		XVidC_FrameQPutReadBuf() once it is no longer accessed.
+ *
+*******************************************************************************/
+XVidC_FrameBuf *XVidC_FrameQGetReadBuf(XVidC_FrameQ *FrameQ)
+{
+	u8 Tail;
+	u8 Index;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(FrameQ != NULL);
+
+	Tail = FrameQ->ReadyTail;
+	if (Tail == FrameQ->ReadyHead) {
+		return NULL;
+	}
+
+	XVIDC_FRAMEQ_SYNC();
+	Index = FrameQ->ReadyRing[Tail];
+	Tail = XVidC_FrameQNextPos(FrameQ, Tail);
+
+	if (FrameQ->Policy == XVIDC_FRAMEQ_LATEST) {
+		while (Tail != FrameQ->ReadyHead) {
+			XVIDC_FRAMEQ_SYNC();
+			XVidC_FrameQPutReadBuf(FrameQ, &FrameQ->Buf[Index]);
+			FrameQ->SkippedFrames++;
+
+			Index = FrameQ->ReadyRing[Tail];
+			Tail = XVidC_FrameQNextPos(FrameQ, Tail);
+		}
+	}
+	FrameQ->ReadyTail = Tail;
+
+	return &FrameQ->Buf[Index];
+}
+
+/******************************************************************************/
+/**
+ * This function releases a buffer taken by the consumer, making it available
+ * to the producer.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ * @param	Buf is a pointer to the buffer, obtained from
+ *		XVidC_FrameQGetReadBuf().
+ *
+ * @return	None.
+ *
+ * @note	Consumer only.
+ *
+*******************************************************************************/
+void XVidC_FrameQPutReadBuf(XVidC_FrameQ *FrameQ, XVidC_FrameBuf *Buf)
+{
+	u8 Head;
+
+	/* Verify arguments. */
+	Xil_AssertVoid(FrameQ != NULL);
+	Xil_AssertVoid(Buf != NULL);
+	Xil_AssertVoid(Buf->Index < FrameQ->NumBufs);
+
+	Head = FrameQ->FreeHead;
+	FrameQ->FreeRing[Head] = Buf->Index;
+
+	/* Finish all accesses to the buffer before it is handed back */
+	XVIDC_FRAMEQ_SYNC();
+	FrameQ->FreeHead = XVidC_FrameQNextPos(FrameQ, Head);
+}
+
+/******************************************************************************/
+/**
+ * This function releases the buffer shown by the consumer and returns the
+ * next frame to show. If no new frame is ready the shown buffer is kept and
+ * returned again.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ * @param	Shown is a pointer to the buffer currently held by the
+ *		consumer, or NULL if it holds none.
+ *
+ * @return	Pointer to the buffer to show next. NULL only if Shown is NULL
+ *		and no frame is ready.
+ *
+ * @note	Consumer only. Intended to be called from the frame done
+ *		interrupt of the consumer.
+ *
+*******************************************************************************/
+XVidC_FrameBuf *XVidC_FrameQSwapReadBuf(XVidC_FrameQ *FrameQ,
+		XVidC_FrameBuf *Shown)
+{
+	XVidC_FrameBuf *Next;
+
+	/* Verify arguments. */
+	Xil_AssertNonvoid(FrameQ != NULL);
+
+	Next = XVidC_FrameQGetReadBuf(FrameQ);
+	if (Next == NULL) {
+		if (Shown != NULL) {
+			FrameQ->RepeatedFrames++;
+		}
+		return Shown;
+	}
+
+	if (Shown != NULL) {
+		XVidC_FrameQPutReadBuf(FrameQ, Shown);
+	}
+
+	return Next;
+}
+
+/******************************************************************************/
+/**
+ * This function advances a ring position. Rings hold one entry more than the
+ * number of buffers so that a full ring can be told apart from an empty one.
+ *
+ * @param	FrameQ is a pointer to the frame queue.
+ * @param	Pos is the ring position to advance.
+ *
+ * @return	The next ring position.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static u8 XVidC_FrameQNextPos(const XVidC_FrameQ *FrameQ, u8 Pos)
+{
+	return (Pos == FrameQ->NumBufs) ? 0 : (Pos + 1);
+}
+/** @} */
@@ -0,0 +1,190 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_frameq.h
+ * @addtogroup video_common_v4_13
+ * @{
+ * @details
+ *
+ * Contains the frame queue used to pass a fixed set of frame buffers between
+ * a producer, typically the frame done interrupt of a frame buffer write core,
+ * and a consumer, typically a processing thread or the frame done interrupt of
+ * a frame buffer read core.
+ *
+ * Buffers are passed by index through two single producer, single consumer
+ * rings: written frames flow from the producer to the consumer through the
+ * ready ring and released buffers flow back through the free ring. Each ring
+ * index is only written by one side, so no locking is required between an
+ * interrupt handler and a thread. Only one producer and one consumer may use
+ * a queue.
+ *
+ * When no free buffer is available the producer overwrites the frame it just
+ * completed and counts it as dropped. When no new frame is ready a consumer
+ * using XVidC_FrameQSwapReadBuf() keeps its current buffer and counts a
+ * repeated frame. With the XVIDC_FRAMEQ_LATEST policy the consumer always
+ * gets the newest frame and older frames still in the ready ring are returned
+ * to the free ring and counted as skipped.
+ *
+ * @note	None.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13       10/19/26 Initial release.
+ *            10/19/26 Added the V plane address and the Linux simulated
+ *                     frame done interrupt.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifndef XVIDC_FRAMEQ_H_  /* Prevent circular inclusions by using protection macros. */
+#define XVIDC_FRAMEQ_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/******************************* Include Files ********************************/
+
+#include "xil_types.h"
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+/************************** Constant Definitions ******************************/
+
+/**
+ * Maximum number of buffers in a frame queue. May be overridden at build time.
+ */
+#ifndef XVIDC_FRAMEQ_MAX_BUFS
+#define XVIDC_FRAMEQ_MAX_BUFS	8
+#endif
+
+/****************************** Type Definitions ******************************/
+
+/**
+ * Frame queue policy used when the consumer gets a frame.
+ */
+typedef enum {
+	XVIDC_FRAMEQ_FIFO = 0,	/**< Frames are returned in order. */
+	XVIDC_FRAMEQ_LATEST	/**< The newest frame is returned, older
+				  *  ready frames are skipped. */
+} XVidC_FrameQPolicy;
+
+/**
+ * Callback type used to time stamp frames.
+ *
+ * @param	CallbackRef is the reference passed to
+ *		XVidC_FrameQSetTimeFunc().
+ *
+ * @return	Current time in a unit chosen by the application.
+ */
+typedef u64 (*XVidC_FrameQTimeFunc)(void *CallbackRef);
+
+/**
+ * Frame buffer managed by a frame queue.
+ */
+typedef struct {
+	UINTPTR Addr;		/**< Luma or packed plane address. */
+	UINTPTR ChromaAddr;	/**< UV plane address of semi-planar formats
+				  *  or U plane address of 3 planar formats,
+				  *  0 if not used. */
+	UINTPTR VChromaAddr;	/**< V plane address of 3 planar formats, 0 if
+				  *  not used. */
+	u64 Timestamp;		/**< Time the frame was completed. */
+	u32 FrameNum;		/**< Producer sequence number of the frame. */
+	u8 Index;		/**< Position of the buffer in the queue. */
+} XVidC_FrameBuf;
+
+/**
+ * Frame queue instance. The fields are managed by the XVidC_FrameQ* API; the
+ * statistics counters may be read at any time.
+ */
+typedef struct {
+	XVidC_FrameBuf Buf[XVIDC_FRAMEQ_MAX_BUFS]; /**< Frame buffers. */
+	u8 NumBufs;			/**< Number of buffers in use. */
+	XVidC_FrameQPolicy Policy;	/**< Consumer policy. */
+
+	u8 ReadyRing[XVIDC_FRAMEQ_MAX_BUFS + 1]; /**< Written frames. */
+	volatile u8 ReadyHead;		/**< Written by the producer only. */
+	volatile u8 ReadyTail;		/**< Written by the consumer only. */
+	u8 FreeRing[XVIDC_FRAMEQ_MAX_BUFS + 1]; /**< Released buffers. */
+	volatile u8 FreeHead;		/**< Written by the consumer only. */
+	volatile u8 FreeTail;		/**< Written by the producer only. */
+
+	XVidC_FrameQTimeFunc TimeFunc;	/**< Optional time stamp source. */
+	void *TimeRef;			/**< Passed to TimeFunc. */
+	u32 FrameNum;			/**< Producer frame counter. */
+
+	volatile u32 DroppedFrames;	/**< Frames overwritten by the producer
+					  *  for lack of a free buffer. */
+	volatile u32 SkippedFrames;	/**< Frames discarded by the
+					  *  XVIDC_FRAMEQ_LATEST policy. */
+	volatile u32 RepeatedFrames;	/**< Consumer swaps without a new
+					  *  frame. */
+} XVidC_FrameQ;
+
+#ifdef __linux__
+/**
+ * Callback type of the simulated frame done interrupt.
+ *
+ * @param	CallbackRef is the reference passed to
+ *		XVidC_FrameQSimIrqStart().
+ */
+typedef void (*XVidC_FrameQIrqHandler)(void *CallbackRef);
+
+/**
+ * Simulated frame done interrupt source, used to run a frame queue producer
+ * or consumer on Linux without the frame buffer cores.
+ */
+typedef struct {
+	pthread_t Thread;		/**< Thread calling the handler. */
+	XVidC_FrameQIrqHandler Handler;	/**< Called once per frame period. */
+	void *CallbackRef;		/**< Passed to Handler. */
+	u32 PeriodUs;			/**< Frame period in microseconds. */
+	volatile u8 IsRunning;		/**< Cleared to stop the thread. */
+} XVidC_FrameQSimIrq;
+#endif
+
+/**************************** Function Prototypes *****************************/
+
+u32 XVidC_FrameQInit(XVidC_FrameQ *FrameQ, const UINTPTR *Addr,
+		const UINTPTR *ChromaAddr, const UINTPTR *VChromaAddr,
+		u8 NumBufs, XVidC_FrameQPolicy Policy);
+void XVidC_FrameQSetTimeFunc(XVidC_FrameQ *FrameQ,
+		XVidC_FrameQTimeFunc TimeFunc, void *TimeRef);
+
+/* Producer side */
+XVidC_FrameBuf *XVidC_FrameQGetWriteBuf(XVidC_FrameQ *FrameQ);
+void XVidC_FrameQPutWriteBuf(XVidC_FrameQ *FrameQ, XVidC_FrameBuf *Buf);
+XVidC_FrameBuf *XVidC_FrameQSwapWriteBuf(XVidC_FrameQ *FrameQ,
+		XVidC_FrameBuf *Done);
+
+/* Consumer side */
+XVidC_FrameBuf *XVidC_FrameQGetReadBuf(XVidC_FrameQ *FrameQ);
+void XVidC_FrameQPutReadBuf(XVidC_FrameQ *FrameQ, XVidC_FrameBuf *Buf);
+XVidC_FrameBuf *XVidC_FrameQSwapReadBuf(XVidC_FrameQ *FrameQ,
+		XVidC_FrameBuf *Shown);
+
+#ifdef __linux__
+/* Linux simulation, xvidc_frameq_linux.c */
+u32 XVidC_FrameQSimIrqStart(XVidC_FrameQSimIrq *Irq,
+		XVidC_FrameQIrqHandler Handler, void *CallbackRef,
+		u32 PeriodUs);
+void XVidC_FrameQSimIrqStop(XVidC_FrameQSimIrq *Irq);
+u64 XVidC_FrameQGetTimeNs(void *CallbackRef);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XVIDC_FRAMEQ_H_ */
+/** @} */
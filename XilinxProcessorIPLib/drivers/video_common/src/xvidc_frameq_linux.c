@@ -0,0 +1,172 @@
+/*******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+*******************************************************************************/
+
+/******************************************************************************/
+/**
+ *
+ * @file xvidc_frameq_linux.c
+ * @addtogroup video_common_v4_13
+ * @{
+ *
+ * Contains a simulated frame done interrupt source for Linux, so that the
+ * frame queue and the producer and consumer code around it can be run and
+ * debugged on a Linux host without the frame buffer cores. The interrupt is
+ * simulated by a thread calling a handler once per frame period, which
+ * preempts the application the way a real interrupt handler would.
+ *
+ * @note	Only built for Linux.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- -----------------------------------------------
+ * 4.13       10/19/26 Initial release.
+ * </pre>
+ *
+*******************************************************************************/
+
+#ifdef __linux__
+
+/******************************* Include Files ********************************/
+
+#include <time.h>
+#include "xil_assert.h"
+#include "xstatus.h"
+#include "xvidc_frameq.h"
+
+/**************************** Function Prototypes *****************************/
+
+static void *XVidC_FrameQSimIrqThread(void *Arg);
+
+/*************************** Function Definitions *****************************/
+
+/******************************************************************************/
+/**
+ * This function starts a simulated frame done interrupt which calls Handler
+ * once every PeriodUs microseconds until XVidC_FrameQSimIrqStop() is called.
+ *
+ * @param	Irq is a pointer to the simulated interrupt source.
+ * @param	Handler is the function called on every simulated interrupt,
+ *		for example XVFrmbufWr_InterruptHandler or an application
+ *		handler calling XVidC_FrameQSwapWriteBuf().
+ * @param	CallbackRef is passed to Handler.
+ * @param	PeriodUs is the frame period in microseconds.
+ *
+ * @return
+ *		- XST_SUCCESS if the interrupt source was started.
+ *		- XST_FAILURE if the thread could not be created.
+ *
+ * @note	Handler calls are never nested, as with a real interrupt.
+ *
+*******************************************************************************/
+u32 XVidC_FrameQSimIrqStart(XVidC_FrameQSimIrq *Irq,
+		XVidC_FrameQIrqHandler Handler, void *CallbackRef,
+		u32 PeriodUs)
+{
+	/* Verify arguments. */
+	Xil_AssertNonvoid(Irq != NULL);
+	Xil_AssertNonvoid(Handler != NULL);
+	Xil_AssertNonvoid(PeriodUs != 0);
+
+	Irq->Handler = Handler;
+	Irq->CallbackRef = CallbackRef;
+	Irq->PeriodUs = PeriodUs;
+	Irq->IsRunning = (TRUE);
+
+	if (pthread_create(&Irq->Thread, NULL, XVidC_FrameQSimIrqThread,
+				Irq) != 0) {
+		Irq->IsRunning = (FALSE);
+		return XST_FAILURE;
+	}
+
+	return XST_SUCCESS;
+}
+
+/******************************************************************************/
+/**
+ * This function stops a simulated frame done interrupt and waits for the
+ * handler call in progress, if any, to return.
+ *
+ * @param	Irq is a pointer to the simulated interrupt source.
+ *
+ * @return	None.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+void XVidC_FrameQSimIrqStop(XVidC_FrameQSimIrq *Irq)
+{
+	/* Verify arguments. */
+	Xil_AssertVoid(Irq != NULL);
+
+	if (!Irq->IsRunning) {
+		return;
+	}
+
+	Irq->IsRunning = (FALSE);
+	pthread_join(Irq->Thread, NULL);
+}
+
+/******************************************************************************/
+/**
+ * This function returns the monotonic time, for use as frame queue time stamp
+ * function with XVidC_FrameQSetTimeFunc().
+ *
+ * @param	CallbackRef is not used.
+ *
+ * @return	Monotonic time in nanoseconds.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+u64 XVidC_FrameQGetTimeNs(void *CallbackRef)
+{
+	struct timespec Now;
+
+	(void)CallbackRef;
+
+	clock_gettime(CLOCK_MONOTONIC, &Now);
+	return ((u64)Now.tv_sec * 1000000000ULL) + (u64)Now.tv_nsec;
+}
+
+/******************************************************************************/
+/**
+ * This function is the thread of a simulated frame done interrupt. Periods
+ * are counted from the start time, so a late handler does not shift the
+ * following interrupts.
+ *
+ * @param	Arg is a pointer to the simulated interrupt source.
+ *
+ * @return	NULL.
+ *
+ * @note	None.
+ *
+*******************************************************************************/
+static void *XVidC_FrameQSimIrqThread(void *Arg)
+{
+	XVidC_FrameQSimIrq *Irq = (XVidC_FrameQSimIrq *)Arg;
+	struct timespec Next;
+
+	clock_gettime(CLOCK_MONOTONIC, &Next);
+
+	while (Irq->IsRunning) {
+		Next.tv_nsec += (long)Irq->PeriodUs * 1000L;
+		while (Next.tv_nsec >= 1000000000L) {
+			Next.tv_nsec -= 1000000000L;
+			Next.tv_sec++;
+		}
+		clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &Next, NULL);
+
+		if (Irq->IsRunning) {
+			Irq->Handler(Irq->CallbackRef);
+		}
+	}
+
+	return NULL;
+}
+
+#endif /* __linux__ */
+/** @} */
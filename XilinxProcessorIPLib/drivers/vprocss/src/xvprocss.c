@@ -37,6 +37,10 @@
 * 2.40  vyc  10/04/17   Added support for conversion from 420/422/444/RGB to
 *                       420/422/444/RGB with CSC-only topology
 * 2.50  vyc  04/04/18   Fix for HScaler setup with 420 input
+*            10/19/26   Replay cached mode switch plans in
+*                       XVprocSs_SetSubsystemConfig()
+*            10/19/26   Only cache a plan once its configuration is set up
+*            10/19/26   Invalidate the scaler coefficient caches on reset
 *
 * </pre>
 *
@@ -131,6 +135,14 @@ const u16 XVprocSs_PixelHStep[3][4] =
 static void SetPowerOnDefaultState(XVprocSs *XVprocSsPtr);
 static void GetIncludedSubcores(XVprocSs *XVprocSsPtr);
 static int ValidateSubsystemConfig(XVprocSs *InstancePtr);
+static void SetStreamDefaults(XVprocSs *InstancePtr);
+static int IsStreamEqual(const XVidC_VideoStream *StrmA,
+                         const XVidC_VideoStream *StrmB);
+static int IsWindowEqual(const XVidC_VideoWindow *WinA,
+                         const XVidC_VideoWindow *WinB);
+static XVprocSs_Plan *PlanLookup(XVprocSs *InstancePtr);
+static void PlanInit(XVprocSs *InstancePtr, XVprocSs_Plan *PlanPtr);
+static void PlanInsert(XVprocSs *InstancePtr, const XVprocSs_Plan *NewPlan);
 static int ValidateScalerOnlyConfig(XVprocSs *XVprocSsPtr);
 static int ValidateCscOnlyConfig(XVprocSs *XVprocSsPtr,
 								 u16 Allow422,
@@ -138,12 +150,14 @@ static int ValidateCscOnlyConfig(XVprocSs *XVprocSsPtr,
 static int ValidateDeintOnlyConfig(XVprocSs *XVprocSsPtr);
 static int ValidateVCResampleOnlyConfig(XVprocSs *XVprocSsPtr);
 static int ValidateHCResampleOnlyConfig(XVprocSs *XVprocSsPtr);
-static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr);
-static int SetupModeCscOnly(XVprocSs *XVprocSsPtr);
-static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr);
-static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr);
-static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr);
-static int SetupModeMax(XVprocSs *XVprocSsPtr);
+static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr, XVprocSs_Plan *PlanPtr);
+static int SetupModeCscOnly(XVprocSs *XVprocSsPtr, XVprocSs_Plan *PlanPtr);
+static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr, XVprocSs_Plan *PlanPtr);
+static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr,
+                                   XVprocSs_Plan *PlanPtr);
+static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr,
+                                   XVprocSs_Plan *PlanPtr);
+static int SetupModeMax(XVprocSs *XVprocSsPtr, XVprocSs_Plan *PlanPtr);
 
 /***************** Macros (Inline Functions) Definitions *********************/
 /*****************************************************************************/
@@ -492,6 +506,9 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr, XVprocSs_Config *CfgPtr,
   /* Set subsystem to power on default state */
   SetPowerOnDefaultState(InstancePtr);
 
+  /* No mode switch plan is cached yet */
+  XVprocSs_FlushPlanCache(InstancePtr);
+
   /* Set the flag to indicate the subsystem is ready */
   InstancePtr->IsReady = XIL_COMPONENT_IS_READY;
 
@@ -759,6 +776,14 @@ void XVprocSs_Reset(XVprocSs *InstancePtr)
   /* Reset start core flags */
   memset(InstancePtr->CtxtData.StartCore, 0, sizeof(InstancePtr->CtxtData.StartCore));
 
+  /* Scaler coefficient and phase banks are lost with the reset */
+  if(InstancePtr->HscalerPtr) {
+    XV_HScalerInvalidateCache(InstancePtr->HscalerPtr);
+  }
+  if(InstancePtr->VscalerPtr) {
+    XV_VScalerInvalidateCache(InstancePtr->VscalerPtr);
+  }
+
   XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_RESET_VPSS, XVPROCSS_EDAT_SUCCESS);
 }
 
@@ -1321,6 +1346,8 @@ static int ValidateHCResampleOnlyConfig(XVprocSs *XVprocSsPtr)
 * topology of the subsystem
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan for the configuration. If the
+*         plan is valid the configuration is not validated again.
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
@@ -1328,7 +1355,8 @@ static int ValidateHCResampleOnlyConfig(XVprocSs *XVprocSsPtr)
 *       accordingly else will ignore the request
 *
 ******************************************************************************/
-static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
+static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr,
+                               XVprocSs_Plan *PlanPtr)
 {
   u32 vsc_WidthIn, vsc_HeightIn, vsc_HeightOut;
   u32 hsc_HeightIn, hsc_WidthIn, hsc_WidthOut, hsc_ColorFormatIn;
@@ -1348,7 +1376,9 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
   }
 
   /* check if input/output stream configuration is supported */
-  status = ValidateScalerOnlyConfig(XVprocSsPtr);
+  if(!PlanPtr->IsValid) {
+    status = ValidateScalerOnlyConfig(XVprocSsPtr);
+  }
 
   if(status ==  XST_SUCCESS)
   {
@@ -1407,6 +1437,8 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 * topology of the subsystem
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan for the configuration. If the
+*         plan is valid the configuration is not validated again.
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
@@ -1414,7 +1446,8 @@ static int SetupModeScalerOnly(XVprocSs *XVprocSsPtr)
 *       accordingly else will ignore the request
 *
 ******************************************************************************/
-static int SetupModeCscOnly(XVprocSs *XVprocSsPtr)
+static int SetupModeCscOnly(XVprocSs *XVprocSsPtr,
+                            XVprocSs_Plan *PlanPtr)
 {
   XVidC_ColorFormat CscIn, CscOut;
   XVidC_ColorStd StdIn, StdOut;
@@ -1435,7 +1468,9 @@ static int SetupModeCscOnly(XVprocSs *XVprocSsPtr)
   Allow420 = XV_CscIs420Enabled(XVprocSsPtr->CscPtr);
 
   /* check if input/output stream configuration is supported */
-  status = ValidateCscOnlyConfig(XVprocSsPtr, Allow422, Allow420);
+  if(!PlanPtr->IsValid) {
+    status = ValidateCscOnlyConfig(XVprocSsPtr, Allow422, Allow420);
+  }
 
   if(status ==  XST_SUCCESS) {
     /* In the single-IP cases the reset has been done outside this routine */
@@ -1480,6 +1515,8 @@ static int SetupModeCscOnly(XVprocSs *XVprocSsPtr)
 * topology of the subsystem
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan for the configuration. If the
+*         plan is valid the configuration is not validated again.
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
@@ -1487,7 +1524,8 @@ static int SetupModeCscOnly(XVprocSs *XVprocSsPtr)
 *       accordingly else will ignore the request
 *
 ******************************************************************************/
-static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr)
+static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr,
+                              XVprocSs_Plan *PlanPtr)
 {
   XVprocSs_ContextData *CtxtPtr = &XVprocSsPtr->CtxtData;
   XVidC_VideoStream *pStrmIn = &XVprocSsPtr->VidIn;
@@ -1499,7 +1537,9 @@ static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr)
   }
 
   /* check if input/output stream configuration is supported */
-  status = ValidateDeintOnlyConfig(XVprocSsPtr);
+  if(!PlanPtr->IsValid) {
+    status = ValidateDeintOnlyConfig(XVprocSsPtr);
+  }
 
   if(status ==  XST_SUCCESS) {
     /* In the single-IP cases the reset has been done outside this routine */
@@ -1544,6 +1584,8 @@ static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr)
 * topology of the subsystem
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan for the configuration. If the
+*         plan is valid the configuration is not validated again.
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
@@ -1551,7 +1593,8 @@ static int SetupModeDeintOnly(XVprocSs *XVprocSsPtr)
 *       accordingly else will ignore the request
 *
 ******************************************************************************/
-static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr)
+static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr,
+                                   XVprocSs_Plan *PlanPtr)
 {
   XVprocSs_ContextData *CtxtPtr = &XVprocSsPtr->CtxtData;
   int status = XST_SUCCESS;
@@ -1562,7 +1605,9 @@ static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr)
   }
 
   /* check if input/output stream configuration is supported */
-  status = ValidateVCResampleOnlyConfig(XVprocSsPtr);
+  if(!PlanPtr->IsValid) {
+    status = ValidateVCResampleOnlyConfig(XVprocSsPtr);
+  }
 
   if(status ==  XST_SUCCESS) {
     /* In the single-IP cases the reset has been done outside this routine */
@@ -1595,6 +1640,8 @@ static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr)
 * topology of the subsystem
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan for the configuration. If the
+*         plan is valid the configuration is not validated again.
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
@@ -1602,7 +1649,8 @@ static int SetupModeVCResampleOnly(XVprocSs *XVprocSsPtr)
 *       accordingly else will ignore the request
 *
 ******************************************************************************/
-static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr)
+static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr,
+                                   XVprocSs_Plan *PlanPtr)
 {
   XVidC_ColorFormat HcrIn, HcrOut;
   u32 HeightOut = 0;
@@ -1615,7 +1663,9 @@ static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr)
   }
 
   /* check if input/output stream configuration is supported */
-  status = ValidateHCResampleOnlyConfig(XVprocSsPtr);
+  if(!PlanPtr->IsValid) {
+    status = ValidateHCResampleOnlyConfig(XVprocSsPtr);
+  }
 
   if(status ==  XST_SUCCESS) {
     /* In the single-IP cases the reset has been done outside this routine */
@@ -1650,16 +1700,49 @@ static int SetupModeHCResampleOnly(XVprocSs *XVprocSsPtr)
 * (Full_Fledged) topology
 *
 * @param  XVprocSsPtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan for the configuration. If the
+*         plan is valid the routing map is taken from it, else the routing
+*         map is built and saved in the plan.
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
 ******************************************************************************/
-static int SetupModeMax(XVprocSs *XVprocSsPtr)
+static int SetupModeMax(XVprocSs *XVprocSsPtr,
+                        XVprocSs_Plan *PlanPtr)
 {
-  int status;
+  XVprocSs_ContextData *CtxtPtr = &XVprocSsPtr->CtxtData;
+  int status = XST_SUCCESS;
 
-  /* Build Routing table for the Video Data Flow */
-  status = XVprocSs_BuildRoutingTable(XVprocSsPtr);
+  if(PlanPtr->IsValid) {
+    /* Restore Routing table computed for this configuration */
+    memcpy(CtxtPtr->RtngTable, PlanPtr->RtngTable, sizeof(CtxtPtr->RtngTable));
+    CtxtPtr->RtrNumCores = PlanPtr->RtrNumCores;
+    CtxtPtr->ScaleMode   = PlanPtr->ScaleMode;
+    CtxtPtr->VidInWidth  = PlanPtr->VidInWidth;
+    CtxtPtr->VidInHeight = PlanPtr->VidInHeight;
+    CtxtPtr->StrmCformat = PlanPtr->StrmCformat;
+    CtxtPtr->CscIn       = PlanPtr->CscIn;
+    CtxtPtr->CscOut      = PlanPtr->CscOut;
+    CtxtPtr->HcrIn       = PlanPtr->HcrIn;
+    CtxtPtr->HcrOut      = PlanPtr->HcrOut;
+  } else {
+    /* Build Routing table for the Video Data Flow */
+    status = XVprocSs_BuildRoutingTable(XVprocSsPtr);
+
+    if(status == XST_SUCCESS) {
+      /* Save it for replay, data flow setup modifies the context */
+      memcpy(PlanPtr->RtngTable, CtxtPtr->RtngTable, sizeof(PlanPtr->RtngTable));
+      PlanPtr->RtrNumCores = CtxtPtr->RtrNumCores;
+      PlanPtr->ScaleMode   = CtxtPtr->ScaleMode;
+      PlanPtr->VidInWidth  = CtxtPtr->VidInWidth;
+      PlanPtr->VidInHeight = CtxtPtr->VidInHeight;
+      PlanPtr->StrmCformat = CtxtPtr->StrmCformat;
+      PlanPtr->CscIn       = CtxtPtr->CscIn;
+      PlanPtr->CscOut      = CtxtPtr->CscOut;
+      PlanPtr->HcrIn       = CtxtPtr->HcrIn;
+      PlanPtr->HcrOut      = CtxtPtr->HcrOut;
+    }
+  }
 
   if(status == XST_SUCCESS) {
     /* Reset the IP Blocks inside the VPSS */
@@ -1689,18 +1772,6 @@ static int ValidateSubsystemConfig(XVprocSs *InstancePtr)
   XVidC_VideoStream *StrmIn  = &InstancePtr->VidIn;
   XVidC_VideoStream *StrmOut = &InstancePtr->VidOut;
 
-  /* Runtime Color Depth conversion not supported
-   * Always overwrite input/output stream color depth with subsystem setting
-   */
-  StrmIn->ColorDepth  = (XVidC_ColorDepth)InstancePtr->Config.ColorDepth;
-  StrmOut->ColorDepth = (XVidC_ColorDepth)InstancePtr->Config.ColorDepth;
-
-  /* Runtime Pixel/Clock conversion not supported
-   * Always overwrite input/output stream pixel/clk with subsystem setting
-   */
-  StrmIn->PixPerClk  = (XVidC_PixelsPerClock)InstancePtr->Config.PixPerClock;
-  StrmOut->PixPerClk = (XVidC_PixelsPerClock)InstancePtr->Config.PixPerClock;
-
   /* Frame rate conversion is possible only in FULL topology */
   if((XVprocSs_GetSubsystemTopology(InstancePtr)
       != XVPROCSS_TOPOLOGY_FULL_FLEDGED) &&
@@ -1793,6 +1864,198 @@ static int ValidateSubsystemConfig(XVprocSs *InstancePtr)
   return(XST_SUCCESS);
 }
 
+/*****************************************************************************/
+/**
+* This function overwrites the input and output stream properties that cannot
+* be changed at runtime with the subsystem settings
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return None
+*
+******************************************************************************/
+static void SetStreamDefaults(XVprocSs *InstancePtr)
+{
+  XVidC_VideoStream *StrmIn  = &InstancePtr->VidIn;
+  XVidC_VideoStream *StrmOut = &InstancePtr->VidOut;
+
+  /* Runtime Color Depth conversion not supported
+   * Always overwrite input/output stream color depth with subsystem setting
+   */
+  StrmIn->ColorDepth  = (XVidC_ColorDepth)InstancePtr->Config.ColorDepth;
+  StrmOut->ColorDepth = (XVidC_ColorDepth)InstancePtr->Config.ColorDepth;
+
+  /* Runtime Pixel/Clock conversion not supported
+   * Always overwrite input/output stream pixel/clk with subsystem setting
+   */
+  StrmIn->PixPerClk  = (XVidC_PixelsPerClock)InstancePtr->Config.PixPerClock;
+  StrmOut->PixPerClk = (XVidC_PixelsPerClock)InstancePtr->Config.PixPerClock;
+}
+
+/*****************************************************************************/
+/**
+* This function compares the stream properties used to validate and program
+* the subsystem
+*
+* @param  StrmA is a pointer to the first stream
+* @param  StrmB is a pointer to the second stream
+*
+* @return TRUE if the streams configure the subsystem alike else FALSE
+*
+******************************************************************************/
+static int IsStreamEqual(const XVidC_VideoStream *StrmA,
+                         const XVidC_VideoStream *StrmB)
+{
+  return((StrmA->VmId          == StrmB->VmId)          &&
+         (StrmA->ColorFormatId == StrmB->ColorFormatId) &&
+         (StrmA->FrameRate     == StrmB->FrameRate)     &&
+         (StrmA->IsInterlaced  == StrmB->IsInterlaced)  &&
+         (StrmA->Timing.HActive == StrmB->Timing.HActive) &&
+         (StrmA->Timing.VActive == StrmB->Timing.VActive));
+}
+
+/*****************************************************************************/
+/**
+* This function compares two windows
+*
+* @param  WinA is a pointer to the first window
+* @param  WinB is a pointer to the second window
+*
+* @return TRUE if the windows are identical else FALSE
+*
+******************************************************************************/
+static int IsWindowEqual(const XVidC_VideoWindow *WinA,
+                         const XVidC_VideoWindow *WinB)
+{
+  return((WinA->StartX == WinB->StartX) &&
+         (WinA->StartY == WinB->StartY) &&
+         (WinA->Width  == WinB->Width)  &&
+         (WinA->Height == WinB->Height));
+}
+
+/*****************************************************************************/
+/**
+* This function searches the plan cache for a plan built for the current
+* input/output streams and Zoom/Pip settings
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return Pointer to the matching plan or NULL if none is cached
+*
+******************************************************************************/
+static XVprocSs_Plan *PlanLookup(XVprocSs *InstancePtr)
+{
+  XVprocSs_ContextData *CtxtPtr = &InstancePtr->CtxtData;
+  XVprocSs_Plan *PlanPtr;
+  u32 index;
+
+  for(index=0; index<XVPROCSS_PLAN_CACHE_SIZE; ++index) {
+    PlanPtr = &InstancePtr->Plan[index];
+
+    if(PlanPtr->IsValid &&
+       (PlanPtr->ZoomEn == CtxtPtr->ZoomEn) &&
+       (PlanPtr->PipEn  == CtxtPtr->PipEn)  &&
+       IsStreamEqual(&PlanPtr->VidIn,  &InstancePtr->VidIn) &&
+       IsStreamEqual(&PlanPtr->VidOut, &InstancePtr->VidOut) &&
+       (!CtxtPtr->ZoomEn || IsWindowEqual(&PlanPtr->RdWindow, &CtxtPtr->RdWindow)) &&
+       (!CtxtPtr->PipEn  || IsWindowEqual(&PlanPtr->WrWindow, &CtxtPtr->WrWindow))) {
+      PlanPtr->LastUsed = ++InstancePtr->PlanStamp;
+      PlanPtr->Hits++;
+      return(PlanPtr);
+    }
+  }
+  return(NULL);
+}
+
+/*****************************************************************************/
+/**
+* This function starts a new plan for the current input/output streams and
+* Zoom/Pip settings. The plan is filled in by the setup of the configuration
+* and is not cached until that setup succeeds.
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+* @param  PlanPtr is a pointer to the plan to be initialized.
+*
+* @return None
+*
+******************************************************************************/
+static void PlanInit(XVprocSs *InstancePtr, XVprocSs_Plan *PlanPtr)
+{
+  XVprocSs_ContextData *CtxtPtr = &InstancePtr->CtxtData;
+
+  memset(PlanPtr, 0, sizeof(XVprocSs_Plan));
+  PlanPtr->VidIn    = InstancePtr->VidIn;
+  PlanPtr->VidOut   = InstancePtr->VidOut;
+  PlanPtr->ZoomEn   = CtxtPtr->ZoomEn;
+  PlanPtr->PipEn    = CtxtPtr->PipEn;
+  PlanPtr->RdWindow = CtxtPtr->RdWindow;
+  PlanPtr->WrWindow = CtxtPtr->WrWindow;
+}
+
+/*****************************************************************************/
+/**
+* This function adds a plan whose configuration was set up successfully to
+* the plan cache. An unused entry is preferred, else the least recently used
+* plan is replaced.
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+* @param  NewPlan is a pointer to the plan to be cached.
+*
+* @return None
+*
+******************************************************************************/
+static void PlanInsert(XVprocSs *InstancePtr, const XVprocSs_Plan *NewPlan)
+{
+  XVprocSs_Plan *PlanPtr = &InstancePtr->Plan[0];
+  u32 index;
+
+  for(index=0; index<XVPROCSS_PLAN_CACHE_SIZE; ++index) {
+    if(!InstancePtr->Plan[index].IsValid) {
+      PlanPtr = &InstancePtr->Plan[index];
+      break;
+    }
+    if(InstancePtr->Plan[index].LastUsed < PlanPtr->LastUsed) {
+      PlanPtr = &InstancePtr->Plan[index];
+    }
+  }
+
+  if(PlanPtr->IsValid) {
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CFG_PLAN, XVPROCSS_EDAT_PLAN_EVICT);
+  }
+
+  *PlanPtr = *NewPlan;
+  PlanPtr->LastUsed = ++InstancePtr->PlanStamp;
+  PlanPtr->IsValid  = TRUE;
+  XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CFG_PLAN, XVPROCSS_EDAT_PLAN_ADD);
+}
+
+/*****************************************************************************/
+/**
+* This function empties the mode switch plan cache. The next configuration of
+* every mode is validated and routed from scratch.
+*
+* @param  InstancePtr is a pointer to the Subsystem instance to be worked on.
+*
+* @return None
+*
+* @note Plans depend only on the stream configuration and the subsystem
+*       hardware, so flushing is not required when picture settings, frame
+*       buffer addresses or coefficients change.
+*
+******************************************************************************/
+void XVprocSs_FlushPlanCache(XVprocSs *InstancePtr)
+{
+  /* Verify arguments */
+  Xil_AssertVoid(InstancePtr != NULL);
+
+  memset(InstancePtr->Plan, 0, sizeof(InstancePtr->Plan));
+  InstancePtr->PlanStamp  = 0;
+  InstancePtr->PlanHits   = 0;
+  InstancePtr->PlanMisses = 0;
+
+  XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CFG_PLAN, XVPROCSS_EDAT_PLAN_FLUSH);
+}
+
 /*****************************************************************************/
 /**
 * This function is the entry point into the video processing subsystem driver
@@ -1805,48 +2068,69 @@ static int ValidateSubsystemConfig(XVprocSs *InstancePtr)
 *
 * @return XST_SUCCESS if successful else XST_FAILURE
 *
+* @note Configurations that were set up successfully are cached as mode
+*       switch plans. Switching back to a cached configuration replays its
+*       plan and skips validation and routing only. Sub-cores are always
+*       reset and programmed.
+*
 ******************************************************************************/
 int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr)
 {
+  XVprocSs_Plan NewPlan;
+  XVprocSs_Plan *PlanPtr;
   int status = XST_SUCCESS;
 
   /* Verify arguments */
   Xil_AssertNonvoid(InstancePtr != NULL);
 
-  /* validate subsystem configuration */
-  if(ValidateSubsystemConfig(InstancePtr) != XST_SUCCESS) {
-	return(XST_FAILURE);
+  SetStreamDefaults(InstancePtr);
+
+  /* Replay the plan if this configuration was set up before */
+  PlanPtr = PlanLookup(InstancePtr);
+  if(PlanPtr) {
+    InstancePtr->PlanHits++;
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CFG_PLAN, XVPROCSS_EDAT_PLAN_HIT);
+  } else {
+    InstancePtr->PlanMisses++;
+    XVprocSs_LogWrite(InstancePtr, XVPROCSS_EVT_CFG_PLAN, XVPROCSS_EDAT_PLAN_MISS);
+
+    /* validate subsystem configuration */
+    if(ValidateSubsystemConfig(InstancePtr) != XST_SUCCESS) {
+      return(XST_FAILURE);
+    }
+    PlanInit(InstancePtr, &NewPlan);
+    PlanPtr = &NewPlan;
   }
 
   switch(XVprocSs_GetSubsystemTopology(InstancePtr))
   {
     case XVPROCSS_TOPOLOGY_FULL_FLEDGED:
-        status = SetupModeMax(InstancePtr);
+        status = SetupModeMax(InstancePtr, PlanPtr);
         break;
 
     case XVPROCSS_TOPOLOGY_SCALER_ONLY:
         //Only configuration supported is Scaler-only
-        status = SetupModeScalerOnly(InstancePtr);
+        status = SetupModeScalerOnly(InstancePtr, PlanPtr);
         break;
 
     case XVPROCSS_TOPOLOGY_CSC_ONLY:
         //Only configuration supported is CSC-only
-        status = SetupModeCscOnly(InstancePtr);
+        status = SetupModeCscOnly(InstancePtr, PlanPtr);
         break;
 
     case XVPROCSS_TOPOLOGY_DEINTERLACE_ONLY:
         //Only configuration supported is Deint-only
-        status = SetupModeDeintOnly(InstancePtr);
+        status = SetupModeDeintOnly(InstancePtr, PlanPtr);
         break;
 
     case XVPROCSS_TOPOLOGY_VCRESAMPLE_ONLY:
         //Only configurations supported are 420 <-> 422
-        status = SetupModeVCResampleOnly(InstancePtr);
+        status = SetupModeVCResampleOnly(InstancePtr, PlanPtr);
         break;
 
     case XVPROCSS_TOPOLOGY_HCRESAMPLE_ONLY:
         //Only configurations supported are 422 <-> 444
-        status = SetupModeHCResampleOnly(InstancePtr);
+        status = SetupModeHCResampleOnly(InstancePtr, PlanPtr);
         break;
 
     default:
@@ -1854,6 +2138,16 @@ int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr)
       status = XST_FAILURE;
       break;
   }
+
+  if(PlanPtr == &NewPlan) {
+    /* Only cache a plan whose configuration was set up */
+    if(status == XST_SUCCESS) {
+      PlanInsert(InstancePtr, &NewPlan);
+    }
+  } else if(status != XST_SUCCESS) {
+    /* Do not keep a cached plan that failed to set up */
+    PlanPtr->IsValid = FALSE;
+  }
   return(status);
 }
 
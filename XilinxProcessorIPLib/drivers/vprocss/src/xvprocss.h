@@ -182,6 +182,8 @@
 *                       XVprocSs_SetFrameBufBaseaddr API
 * 2.30  rco  11/15/16   Make debug log optional (can be disabled via makefile)
 * 			 12/15/16   Added HasMADI configuration option
+*             10/19/26   Add mode switch plan cache
+*             10/19/26   Cache plans only after a successful setup
 *
 * </pre>
 *
@@ -311,6 +313,47 @@ typedef struct
   XLboxColorId LboxBkgndColor; /**< Lbox background color */
 }XVprocSs_ContextData;
 
+/**
+ * Number of mode switch plans cached per subsystem instance. May be
+ * overridden at build time; must be at least 1.
+ */
+#ifndef XVPROCSS_PLAN_CACHE_SIZE
+#define XVPROCSS_PLAN_CACHE_SIZE    (4)
+#endif
+
+/**
+ * Video Processing Subsystem mode switch plan. A plan holds the outcome of
+ * validating a stream configuration and, for the Full topology, the routing
+ * map and processing pipe formats computed for it. Replaying a cached plan
+ * skips validation and routing only; the sub-cores are still reset and
+ * programmed.
+ */
+typedef struct
+{
+  XVidC_VideoStream VidIn;    /**< Input stream the plan was built for */
+  XVidC_VideoStream VidOut;   /**< Output stream the plan was built for */
+  XVidC_VideoWindow RdWindow; /**< Zoom window, used if ZoomEn is set */
+  XVidC_VideoWindow WrWindow; /**< Pip window, used if PipEn is set */
+  u8 ZoomEn;                  /**< Zoom feature state */
+  u8 PipEn;                   /**< PIP feature state */
+
+  u8 RtngTable[XVPROCSS_SUBCORE_MAX]; /**< Computed routing map */
+  u8 RtrNumCores;             /**< Number of sub-cores in routing map */
+  u8 ScaleMode;               /**< Computed scaling mode - UP/DN/1:1 */
+  u16 VidInWidth;             /**< Input H Active */
+  u16 VidInHeight;            /**< Input V Active */
+  XVidC_ColorFormat StrmCformat; /**< processing pipe color format */
+  XVidC_ColorFormat CscIn;    /**< CSC core input color format */
+  XVidC_ColorFormat CscOut;   /**< CSC core output color format */
+  XVidC_ColorFormat HcrIn;    /**< horiz. cresmplr core input color format */
+  XVidC_ColorFormat HcrOut;   /**< horiz. cresmplr core output color format */
+
+  u32 Hits;                   /**< Number of times the plan was replayed */
+  u32 LastUsed;               /**< Use stamp for least recently used
+                                   replacement */
+  u8 IsValid;                 /**< Plan holds a validated configuration */
+}XVprocSs_Plan;
+
 /**
  * Sub-Core Configuration Table
  */
@@ -392,6 +435,11 @@ typedef struct
   void *UsrTmrPtr;                   /**< handle to timer instance used by user
                                          delay function */
 
+  XVprocSs_Plan Plan[XVPROCSS_PLAN_CACHE_SIZE]; /**< Mode switch plan cache */
+  u32 PlanStamp;                     /**< Plan cache use counter */
+  u32 PlanHits;                      /**< Configurations replayed from cache */
+  u32 PlanMisses;                    /**< Configurations built from scratch */
+
 #ifdef XV_VPROCSS_LOG_ENABLE
   XVprocSs_Log Log;                  /**< A log of events. */
 #endif
@@ -595,6 +643,7 @@ int XVprocSs_CfgInitialize(XVprocSs *InstancePtr,
                            XVprocSs_Config *CfgPtr,
 						   UINTPTR EffectiveAddr);
 int XVprocSs_SetSubsystemConfig(XVprocSs *InstancePtr);
+void XVprocSs_FlushPlanCache(XVprocSs *InstancePtr);
 XVprocSs_Config* XVprocSs_LookupConfig(u32 DeviceId);
 
 void XVprocSs_Start(XVprocSs *InstancePtr);
@@ -668,6 +717,7 @@ void XVprocSs_ReportSubsystemConfig(XVprocSs *InstancePtr);
 void XVprocSs_ReportSubsystemCoreInfo(XVprocSs *InstancePtr);
 void XVprocSs_ReportSubcoreStatus(XVprocSs *InstancePtr,
 		                          u32 SubcoreId);
+void XVprocSs_ReportPlanCache(XVprocSs *InstancePtr);
 
 /* Event Logging functions. */
 void XVprocSs_LogReset(XVprocSs *InstancePtr);
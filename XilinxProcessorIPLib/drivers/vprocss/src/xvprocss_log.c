@@ -23,6 +23,7 @@
  *                     etc.) severity from Info to Error
  * 2.30  rco  11/15/16 Make debug log optional (can be disabled via makefile)*
  * 2.40  vyc  10/04/17 Add 420 support in CSC-only topology
+ *            10/19/26 Add mode switch plan cache events and report
  * </pre>
  *
 *******************************************************************************/
@@ -211,6 +212,25 @@ void XVprocSs_LogDisplay(XVprocSs *InstancePtr)
 		case (XVPROCSS_EVT_STOP_VPSS):
 			xil_printf("Info: Subsystem stopped\r\n");
 			break;
+		case (XVPROCSS_EVT_CFG_PLAN):
+			switch (Data) {
+			case (XVPROCSS_EDAT_PLAN_HIT):
+				xil_printf("Info: Mode switch plan replayed\r\n");
+				break;
+			case (XVPROCSS_EDAT_PLAN_MISS):
+				xil_printf("Info: Mode switch plan not cached\r\n");
+				break;
+			case (XVPROCSS_EDAT_PLAN_ADD):
+				xil_printf("Info: Mode switch plan cached\r\n");
+				break;
+			case (XVPROCSS_EDAT_PLAN_EVICT):
+				xil_printf("Info: Least recently used mode switch plan replaced\r\n");
+				break;
+			case (XVPROCSS_EDAT_PLAN_FLUSH):
+				xil_printf("Info: Mode switch plan cache flushed\r\n");
+				break;
+			}
+			break;
 		case (XVPROCSS_EVT_CHK_TOPO):
 			if (Data == XVPROCSS_EDAT_INITFAIL) {
 				xil_printf("Error: Topology Not Supported\r\n");
@@ -754,3 +774,53 @@ void XVprocSs_LogDisplay(XVprocSs *InstancePtr)
     xil_printf("\r\n INFO:: VPSS Log Feature is Disabled \r\n");
 #endif
 }
+
+/*****************************************************************************/
+/**
+* This function prints the mode switch plan cache statistics and the
+* configuration of every cached plan.
+*
+* @param	InstancePtr is a pointer to the XVprocSs core instance.
+*
+* @return	None.
+*
+* @note		Plans are listed in cache order, the replay count of each plan
+*		is shown in brackets.
+*
+******************************************************************************/
+void XVprocSs_ReportPlanCache(XVprocSs *InstancePtr)
+{
+	const XVprocSs_Plan *PlanPtr;
+	u32 Index;
+
+	/* Verify argument. */
+	Xil_AssertVoid(InstancePtr != NULL);
+
+	xil_printf("\r\n------ MODE SWITCH PLAN CACHE ------\r\n");
+	xil_printf("Hits: %d  Misses: %d\r\n",
+		   InstancePtr->PlanHits, InstancePtr->PlanMisses);
+
+	for (Index = 0; Index < XVPROCSS_PLAN_CACHE_SIZE; Index++) {
+		PlanPtr = &InstancePtr->Plan[Index];
+		if (!PlanPtr->IsValid) {
+			continue;
+		}
+
+		xil_printf("%d: %dx%d%s %s -> %dx%d %s",
+			   Index,
+			   PlanPtr->VidIn.Timing.HActive,
+			   PlanPtr->VidIn.Timing.VActive,
+			   (PlanPtr->VidIn.IsInterlaced ? "i" : "p"),
+			   XVidC_GetColorFormatStr(PlanPtr->VidIn.ColorFormatId),
+			   PlanPtr->VidOut.Timing.HActive,
+			   PlanPtr->VidOut.Timing.VActive,
+			   XVidC_GetColorFormatStr(PlanPtr->VidOut.ColorFormatId));
+		if (PlanPtr->ZoomEn) {
+			xil_printf(" Zoom");
+		}
+		if (PlanPtr->PipEn) {
+			xil_printf(" Pip");
+		}
+		xil_printf(" [%d]\r\n", PlanPtr->Hits);
+	}
+}
@@ -22,6 +22,8 @@
 * 1.00  dmc  01/27/16 Initial Release
 *       dmc  03/03/16 Add events for VDMA configuration and operational errors
 * 2.30  rco  11/15/16 Make debug log optional (can be disabled via makefile)
+*            10/19/26 Add events for the mode switch plan cache
+*            10/19/26 Move plan cache codes clear of the other event codes
 *
 * </pre>
 *
@@ -76,6 +78,7 @@ typedef enum {
 	XVPROCSS_EVT_RESET_VPSS,   /**< Log event Reset the VPSS */
 	XVPROCSS_EVT_START_VPSS,   /**< Log event Start the VPSS */
 	XVPROCSS_EVT_STOP_VPSS,    /**< Log event Stop the VPSS */
+	XVPROCSS_EVT_CFG_PLAN,     /**< Log event mode switch plan cache */
 	XVPROCSS_EVT_LAST_ENUM     /**< (dummy event: marks last enum) */
 } XVprocSs_LogEvent;
 
@@ -171,6 +174,13 @@ typedef struct {
 #define XVPROCSS_EDAT_VDMA_WRRES   0xEE
 #define XVPROCSS_EDAT_VDMA_RDRES   0xEF
 
+// These codes are specific to the mode switch plan cache
+#define XVPROCSS_EDAT_PLAN_HIT     0x20
+#define XVPROCSS_EDAT_PLAN_MISS    0x21
+#define XVPROCSS_EDAT_PLAN_ADD     0x22
+#define XVPROCSS_EDAT_PLAN_EVICT   0x23
+#define XVPROCSS_EDAT_PLAN_FLUSH   0x24
+
 // These codes are specific to PIP setup
 #define XVPROCSS_EDAT_BGND_SET     0x10
 #define XVPROCSS_EDAT_LBOX_ABSENT  0xEF
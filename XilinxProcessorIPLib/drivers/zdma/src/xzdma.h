@@ -50,6 +50,23 @@
 * functions by using XZDma_SetCallBack API. In this version Descriptor done
 * option is disabled.
 *
+* <b> Asynchronous Copy Service </b>
+*
+* XZDma_CopyAsync(), XZDma_CopySgAsync() and XZDma_FillAsync() implement a
+* memcpy/memset service on top of one or more ZDMA channels grouped in an
+* XZDma_CopySvc instance by XZDma_CopyInit(). Requests are split in pieces
+* that are taken from a fixed descriptor pool and queued on the channel with
+* the least outstanding bytes, so large and scatter copies use all channels
+* of the service in parallel. Every request returns a completion token that
+* can be checked with XZDma_CopyPoll() or XZDma_CopyWait() and an optional
+* completion callback. Requests smaller than the CPU threshold (see
+* XZDma_CopySetThreshold()) are done with the processor, which is faster than
+* programming a channel for them, and complete before the call returns.
+* A service that uses interrupts has XZDma_CopyIntrHandler() connected to
+* each channel interrupt instead of XZDma_IntrHandler().
+* The channels of a service must not be used through the other APIs of this
+* driver while the service owns them.
+*
 * <b> Virtual Memory </b>
 *
 * This driver supports Virtual Memory. The RTOS is responsible for calculating
@@ -136,6 +153,29 @@ extern "C" {
 
 /************************** Constant Definitions *****************************/
 
+/** @name Asynchronous copy service
+ * @{
+ * The pool and table sizes may be overridden at build time.
+ */
+#ifndef XZDMA_COPY_MAX_CHANNELS
+#define XZDMA_COPY_MAX_CHANNELS		8U	/**< Channels per service */
+#endif
+#ifndef XZDMA_COPY_POOL_SIZE
+#define XZDMA_COPY_POOL_SIZE		32U	/**< Descriptors per service */
+#endif
+#ifndef XZDMA_COPY_MAX_REQS
+#define XZDMA_COPY_MAX_REQS		16U	/**< Requests in flight */
+#endif
+#define XZDMA_COPY_CPU_THRESHOLD	1024U	/**< Default size below which
+						  *  the processor copies */
+#define XZDMA_COPY_SPLIT_SIZE		4096U	/**< Minimum size of a piece
+						  *  when splitting a copy
+						  *  across channels */
+#define XZDMA_COPY_ALIGN		64U	/**< Alignment of piece
+						  *  boundaries */
+#define XZDMA_COPY_NONE			0xFFFFU	/**< Empty descriptor index */
+/*@}*/
+
 
 /**************************** Type Definitions *******************************/
 
@@ -352,6 +392,87 @@ typedef struct {
 				  *  this transfer only for SG mode */
 } XZDma_Transfer;
 
+/******************************************************************************/
+/**
+* Callback type for completion of an asynchronous copy or fill request.
+*
+* @param	CallBackRef is the reference passed in with the request.
+* @param	Token is the completion token of the request.
+* @param	Status is XST_SUCCESS or XST_FAILURE if a channel reported an
+*		error for any piece of the request.
+*******************************************************************************/
+typedef void (*XZDma_CopyHandler) (void *CallBackRef, u32 Token, s32 Status);
+
+/**
+* This typedef contains one segment of a scatter copy.
+*/
+typedef struct {
+	UINTPTR DstAddr;	/**< Destination address */
+	UINTPTR SrcAddr;	/**< Source address */
+	u32 Size;		/**< Size of the segment in bytes */
+} XZDma_CopySeg;
+
+/**
+* This typedef contains a piece of a request queued on a channel.
+*/
+typedef struct {
+	UINTPTR DstAddr;	/**< Destination address */
+	UINTPTR SrcAddr;	/**< Source address, unused for fills */
+	u32 Size;		/**< Size of the piece in bytes */
+	u32 FillWord;		/**< Pattern written by fills */
+	u16 Next;		/**< Next descriptor in queue or free list */
+	u8 Req;			/**< Request the piece belongs to */
+	u8 IsFill;		/**< Piece is done in write only mode */
+} XZDma_CopyDesc;
+
+/**
+* This typedef contains the state of a request of the copy service.
+*/
+typedef struct {
+	u32 Token;			/**< Token of the last request that
+					  *  used the slot */
+	volatile s32 Status;		/**< Completion status */
+	volatile u16 Pending;		/**< Pieces not completed yet */
+	XZDma_CopyHandler Handler;	/**< Completion callback */
+	void *CallBackRef;		/**< Passed to the callback */
+} XZDma_CopyReq;
+
+struct XZDma_CopySvcS;
+
+/**
+* This typedef contains the state of a channel owned by the copy service.
+*/
+typedef struct {
+	XZDma *InstancePtr;		/**< Channel instance */
+	struct XZDma_CopySvcS *SvcPtr;	/**< Owning service */
+	u16 Head;			/**< First queued descriptor */
+	u16 Tail;			/**< Last queued descriptor */
+	u16 Active;			/**< Descriptor owned by hardware */
+	u32 QueuedBytes;		/**< Bytes queued or in flight */
+	u8 InIntr;			/**< XZDma_IntrHandler() is running,
+					  *  pieces are started on return */
+} XZDma_CopyChan;
+
+/**
+* The copy service instance. The statistics counters may be read at any time.
+*/
+typedef struct XZDma_CopySvcS {
+	XZDma_CopyChan Chan[XZDMA_COPY_MAX_CHANNELS];	/**< Channels */
+	XZDma_CopyDesc Desc[XZDMA_COPY_POOL_SIZE];	/**< Descriptor pool */
+	XZDma_CopyReq Req[XZDMA_COPY_MAX_REQS];		/**< Requests */
+	u16 FreeHead;		/**< First free descriptor */
+	u16 NumFree;		/**< Number of free descriptors */
+	u32 Seq;		/**< Token sequence number */
+	u32 CpuThreshold;	/**< Requests below this size are done
+				  *  by the processor */
+	u8 NumChans;		/**< Number of channels */
+	u8 UseIntr;		/**< Completions are reported by
+				  *  XZDma_CopyIntrHandler() */
+	u32 CpuReqs;		/**< Requests done by the processor */
+	u32 DmaReqs;		/**< Requests done by the channels */
+	u32 DmaPieces;		/**< Pieces started on the channels */
+} XZDma_CopySvc;
+
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /*****************************************************************************/
@@ -692,6 +813,24 @@ void XZDma_ScatterGather(XZDma *InstancePtr, XZDma_Transfer *Data,
 								u32 Num);
 void XZDma_Enable(XZDma *InstancePtr);
 
+/* Asynchronous copy service functions in xzdma_copy.c */
+s32 XZDma_CopyInit(XZDma_CopySvc *SvcPtr, XZDma **InstancePtrs, u8 NumChans,
+			u8 UseIntr);
+void XZDma_CopySetThreshold(XZDma_CopySvc *SvcPtr, u32 CpuThreshold);
+s32 XZDma_CopyAsync(XZDma_CopySvc *SvcPtr, UINTPTR DstAddr, UINTPTR SrcAddr,
+		u32 Size, XZDma_CopyHandler Handler, void *CallBackRef,
+		u32 *TokenPtr);
+s32 XZDma_CopySgAsync(XZDma_CopySvc *SvcPtr, const XZDma_CopySeg *SegPtr,
+		u32 NumSegs, XZDma_CopyHandler Handler, void *CallBackRef,
+		u32 *TokenPtr);
+s32 XZDma_FillAsync(XZDma_CopySvc *SvcPtr, UINTPTR DstAddr, u8 Value,
+		u32 Size, XZDma_CopyHandler Handler, void *CallBackRef,
+		u32 *TokenPtr);
+s32 XZDma_CopyPoll(XZDma_CopySvc *SvcPtr, u32 Token);
+s32 XZDma_CopyWait(XZDma_CopySvc *SvcPtr, u32 Token);
+void XZDma_CopyService(XZDma_CopySvc *SvcPtr);
+void XZDma_CopyIntrHandler(void *CallBackRef);
+
 /*@}*/
 
 #ifdef __cplusplus
@@ -0,0 +1,1015 @@
+/******************************************************************************
+* Copyright (C) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xzdma_copy.c
+* @addtogroup zdma_v1_14
+* @{
+*
+* This file contains the asynchronous memcpy/memset service built on top of
+* one or more ZDMA channels. Please see xzdma.h for more details of the
+* driver.
+*
+* Each request is split in pieces taken from the descriptor pool of the
+* service. A piece is queued on the channel with the least outstanding bytes
+* and started in simple mode as soon as the channel is idle, so a large copy
+* is spread over all channels and a scatter copy uses one or more pieces per
+* segment. Piece boundaries are aligned to XZDMA_COPY_ALIGN bytes of the
+* destination so that no cache line is shared between two channels.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who     Date     Changes
+* ----- ------  -------- ------------------------------------------------------
+* 1.14          10/19/26 First release
+*               10/19/26 Restore the interrupt state on unlock and start the
+*                        next piece after the channel status is cleared.
+*               10/19/26 Count requests while the service lock is held.
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+
+#include "xzdma.h"
+#include "xil_mem.h"
+#include "xil_exception.h"
+
+/************************** Constant Definitions *****************************/
+
+#define XZDMA_COPY_FILL_ALIGN	16U	/**< Write only data is 128 bits */
+#define XZDMA_COPY_MAX_PIECE	(XZDMA_WORD2_SIZE_MASK & \
+					~(XZDMA_COPY_ALIGN - 1U))
+					/**< Largest piece a channel takes */
+
+/**************************** Type Definitions *******************************/
+
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+
+/************************** Function Prototypes ******************************/
+
+static u32 XZDma_CopyLock(XZDma_CopySvc *SvcPtr);
+static void XZDma_CopyUnlock(XZDma_CopySvc *SvcPtr, u32 State);
+static u32 XZDma_CopyNumPieces(XZDma_CopySvc *SvcPtr, u32 Size);
+static s32 XZDma_CopyAllocReq(XZDma_CopySvc *SvcPtr, u16 Pending,
+		XZDma_CopyHandler Handler, void *CallBackRef, u32 *TokenPtr);
+static void XZDma_CopyQueue(XZDma_CopySvc *SvcPtr, u8 Req, UINTPTR DstAddr,
+		UINTPTR SrcAddr, u32 Size, u8 IsFill, u32 FillWord);
+static void XZDma_CopyKick(XZDma_CopyChan *ChanPtr);
+static void XZDma_CopyComplete(XZDma_CopyChan *ChanPtr, s32 Status);
+static void XZDma_CopyDoneCallBack(void *CallBackRef);
+static void XZDma_CopyErrorCallBack(void *CallBackRef, u32 ErrorMask);
+static void XZDma_CpuFill(UINTPTR DstAddr, u8 Value, u32 Size);
+
+/************************** Variable Definitions *****************************/
+
+
+/************************** Function Definitions *****************************/
+
+/*****************************************************************************/
+/**
+*
+* This function initializes a copy service over the given ZDMA channels. The
+* channels are set to simple normal mode and, when interrupts are used, the
+* done and error callbacks of each channel are taken over by the service.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	InstancePtrs is an array of NumChans initialized and idle
+*		XZDma instances.
+* @param	NumChans is the number of channels, 1 to
+*		XZDMA_COPY_MAX_CHANNELS.
+* @param	UseIntr specifies how completions are detected.
+*		- TRUE - XZDma_CopyIntrHandler() is connected to the
+*		interrupt of every channel by the application, with
+*		&SvcPtr->Chan[n] as callback reference.
+*		- FALSE - Channels are polled by XZDma_CopyService(), which is
+*		also called by XZDma_CopyPoll() and XZDma_CopyWait().
+*
+* @return
+*		- XST_SUCCESS if the service is initialized.
+*		- XST_FAILURE if a channel is not idle.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_CopyInit(XZDma_CopySvc *SvcPtr, XZDma **InstancePtrs, u8 NumChans,
+			u8 UseIntr)
+{
+	XZDma_CopyChan *ChanPtr;
+	s32 Status = XST_SUCCESS;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(InstancePtrs != NULL);
+	Xil_AssertNonvoid((NumChans != 0U) &&
+				(NumChans <= XZDMA_COPY_MAX_CHANNELS));
+	Xil_AssertNonvoid((UseIntr == TRUE) || (UseIntr == FALSE));
+
+	SvcPtr->NumChans = NumChans;
+	SvcPtr->UseIntr = UseIntr;
+	SvcPtr->CpuThreshold = XZDMA_COPY_CPU_THRESHOLD;
+	SvcPtr->Seq = 1U;
+	SvcPtr->CpuReqs = 0U;
+	SvcPtr->DmaReqs = 0U;
+	SvcPtr->DmaPieces = 0U;
+
+	/* All descriptors are on the free list */
+	for (Index = 0U; Index < XZDMA_COPY_POOL_SIZE; Index++) {
+		SvcPtr->Desc[Index].Next = (u16)(Index + 1U);
+	}
+	SvcPtr->Desc[XZDMA_COPY_POOL_SIZE - 1U].Next = XZDMA_COPY_NONE;
+	SvcPtr->FreeHead = 0U;
+	SvcPtr->NumFree = (u16)XZDMA_COPY_POOL_SIZE;
+
+	for (Index = 0U; Index < XZDMA_COPY_MAX_REQS; Index++) {
+		SvcPtr->Req[Index].Token = 0U;
+		SvcPtr->Req[Index].Status = XST_SUCCESS;
+		SvcPtr->Req[Index].Pending = 0U;
+	}
+
+	for (Index = 0U; Index < NumChans; Index++) {
+		Xil_AssertNonvoid(InstancePtrs[Index] != NULL);
+		Xil_AssertNonvoid(InstancePtrs[Index]->IsReady ==
+				(u32)(XIL_COMPONENT_IS_READY));
+
+		ChanPtr = &SvcPtr->Chan[Index];
+		ChanPtr->InstancePtr = InstancePtrs[Index];
+		ChanPtr->SvcPtr = SvcPtr;
+		ChanPtr->Head = XZDMA_COPY_NONE;
+		ChanPtr->Tail = XZDMA_COPY_NONE;
+		ChanPtr->Active = XZDMA_COPY_NONE;
+		ChanPtr->QueuedBytes = 0U;
+		ChanPtr->InIntr = FALSE;
+
+		if (XZDma_SetMode(ChanPtr->InstancePtr, FALSE,
+				XZDMA_NORMAL_MODE) != XST_SUCCESS) {
+			Status = XST_FAILURE;
+			break;
+		}
+
+		if (UseIntr == TRUE) {
+			(void)XZDma_SetCallBack(ChanPtr->InstancePtr,
+				XZDMA_HANDLER_DONE,
+				(void *)XZDma_CopyDoneCallBack, ChanPtr);
+			(void)XZDma_SetCallBack(ChanPtr->InstancePtr,
+				XZDMA_HANDLER_ERROR,
+				(void *)XZDma_CopyErrorCallBack, ChanPtr);
+			XZDma_EnableIntr(ChanPtr->InstancePtr,
+				(XZDMA_IXR_DMA_DONE_MASK | XZDMA_IXR_ERR_MASK));
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function sets the size below which requests are done by the processor
+* instead of a channel.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	CpuThreshold is the size in bytes. 0 sends every request to
+*		the channels.
+*
+* @return	None.
+*
+* @note		The best value depends on the processor, the memory the
+*		buffers are in and whether the channels are cache coherent.
+*		XZDMA_COPY_CPU_THRESHOLD is a conservative default.
+*
+******************************************************************************/
+void XZDma_CopySetThreshold(XZDma_CopySvc *SvcPtr, u32 CpuThreshold)
+{
+	/* Verify arguments */
+	Xil_AssertVoid(SvcPtr != NULL);
+
+	SvcPtr->CpuThreshold = CpuThreshold;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts an asynchronous copy of Size bytes from SrcAddr to
+* DstAddr.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address.
+* @param	Size is the number of bytes to copy.
+* @param	Handler is called when the copy completes, may be NULL.
+* @param	CallBackRef is passed to Handler.
+* @param	TokenPtr returns the completion token of the request.
+*
+* @return
+*		- XST_SUCCESS if the copy is started or, below the CPU
+*		threshold, already done.
+*		- XST_DEVICE_BUSY if the descriptor pool or the request table
+*		is exhausted. Nothing is copied, the request may be retried
+*		once earlier requests complete.
+*
+* @note		Source and destination must not overlap. When the channels
+*		are not cache coherent the source and destination ranges are
+*		flushed here and the destination is invalidated on completion,
+*		so the buffers must not be accessed until the request
+*		completes.
+*
+******************************************************************************/
+s32 XZDma_CopyAsync(XZDma_CopySvc *SvcPtr, UINTPTR DstAddr, UINTPTR SrcAddr,
+		u32 Size, XZDma_CopyHandler Handler, void *CallBackRef,
+		u32 *TokenPtr)
+{
+	XZDma_CopySeg Seg;
+
+	Seg.DstAddr = DstAddr;
+	Seg.SrcAddr = SrcAddr;
+	Seg.Size = Size;
+
+	return XZDma_CopySgAsync(SvcPtr, &Seg, 1U, Handler, CallBackRef,
+					TokenPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts an asynchronous scatter copy. Segments of at least the
+* CPU threshold are split across the channels, smaller segments are copied
+* by the processor before the function returns. The request completes when
+* all segments are copied.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	SegPtr is an array of NumSegs segments.
+* @param	NumSegs is the number of segments.
+* @param	Handler is called when the copy completes, may be NULL.
+* @param	CallBackRef is passed to Handler.
+* @param	TokenPtr returns the completion token of the request.
+*
+* @return
+*		- XST_SUCCESS if the copy is started or already done.
+*		- XST_DEVICE_BUSY if the descriptor pool or the request table
+*		is exhausted. Nothing is copied.
+*
+* @note		See XZDma_CopyAsync().
+*
+******************************************************************************/
+s32 XZDma_CopySgAsync(XZDma_CopySvc *SvcPtr, const XZDma_CopySeg *SegPtr,
+		u32 NumSegs, XZDma_CopyHandler Handler, void *CallBackRef,
+		u32 *TokenPtr)
+{
+	u32 NumPieces = 0U;
+	u32 Index;
+	u32 Slot;
+	u32 State;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(SegPtr != NULL);
+	Xil_AssertNonvoid(NumSegs != 0U);
+	Xil_AssertNonvoid(TokenPtr != NULL);
+
+	for (Index = 0U; Index < NumSegs; Index++) {
+		if ((SegPtr[Index].Size != 0U) &&
+			(SegPtr[Index].Size >= SvcPtr->CpuThreshold)) {
+			NumPieces += XZDma_CopyNumPieces(SvcPtr,
+						SegPtr[Index].Size);
+		}
+	}
+
+	State = XZDma_CopyLock(SvcPtr);
+
+	if (NumPieces > SvcPtr->NumFree) {
+		Status = XST_DEVICE_BUSY;
+	}
+	else {
+		Status = XZDma_CopyAllocReq(SvcPtr, (u16)NumPieces, Handler,
+					CallBackRef, TokenPtr);
+	}
+
+	if (Status == XST_SUCCESS) {
+		Slot = *TokenPtr % XZDMA_COPY_MAX_REQS;
+		for (Index = 0U; Index < NumSegs; Index++) {
+			if (SegPtr[Index].Size == 0U) {
+				continue;
+			}
+			if (SegPtr[Index].Size < SvcPtr->CpuThreshold) {
+				Xil_MemCpy((void *)SegPtr[Index].DstAddr,
+					(const void *)SegPtr[Index].SrcAddr,
+					SegPtr[Index].Size);
+			}
+			else {
+				XZDma_CopyQueue(SvcPtr, (u8)Slot,
+					SegPtr[Index].DstAddr,
+					SegPtr[Index].SrcAddr,
+					SegPtr[Index].Size, FALSE, 0U);
+			}
+		}
+		for (Index = 0U; Index < SvcPtr->NumChans; Index++) {
+			XZDma_CopyKick(&SvcPtr->Chan[Index]);
+		}
+		if (NumPieces == 0U) {
+			SvcPtr->CpuReqs++;
+		}
+		else {
+			SvcPtr->DmaReqs++;
+		}
+	}
+
+	XZDma_CopyUnlock(SvcPtr, State);
+
+	/* Requests done by the processor complete right away */
+	if ((Status == XST_SUCCESS) && (NumPieces == 0U) &&
+		(Handler != NULL)) {
+		Handler(CallBackRef, *TokenPtr, XST_SUCCESS);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts an asynchronous fill of Size bytes at DstAddr with
+* Value. The channels run in write only mode for the 16 byte aligned body of
+* the range, the unaligned head and tail are written by the processor.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	DstAddr is the destination address.
+* @param	Value is the byte written.
+* @param	Size is the number of bytes to write.
+* @param	Handler is called when the fill completes, may be NULL.
+* @param	CallBackRef is passed to Handler.
+* @param	TokenPtr returns the completion token of the request.
+*
+* @return
+*		- XST_SUCCESS if the fill is started or already done.
+*		- XST_DEVICE_BUSY if the descriptor pool or the request table
+*		is exhausted. Nothing is written.
+*
+* @note		See XZDma_CopyAsync().
+*
+******************************************************************************/
+s32 XZDma_FillAsync(XZDma_CopySvc *SvcPtr, UINTPTR DstAddr, u8 Value,
+		u32 Size, XZDma_CopyHandler Handler, void *CallBackRef,
+		u32 *TokenPtr)
+{
+	u32 Head;
+	u32 Body;
+	u32 NumPieces = 0U;
+	u32 FillWord;
+	u32 State;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(TokenPtr != NULL);
+
+	Head = (u32)((XZDMA_COPY_FILL_ALIGN -
+		(DstAddr & (XZDMA_COPY_FILL_ALIGN - 1U))) &
+		(XZDMA_COPY_FILL_ALIGN - 1U));
+	if (Head >= Size) {
+		Head = Size;
+		Body = 0U;
+	}
+	else {
+		Body = (Size - Head) & ~(XZDMA_COPY_FILL_ALIGN - 1U);
+	}
+	if ((Body != 0U) && (Body >= SvcPtr->CpuThreshold)) {
+		NumPieces = XZDma_CopyNumPieces(SvcPtr, Body);
+	}
+
+	State = XZDma_CopyLock(SvcPtr);
+
+	if (NumPieces > SvcPtr->NumFree) {
+		Status = XST_DEVICE_BUSY;
+	}
+	else {
+		Status = XZDma_CopyAllocReq(SvcPtr, (u16)NumPieces, Handler,
+					CallBackRef, TokenPtr);
+	}
+
+	if ((Status == XST_SUCCESS) && (NumPieces == 0U)) {
+		XZDma_CpuFill(DstAddr, Value, Size);
+		SvcPtr->CpuReqs++;
+	}
+	else if (Status == XST_SUCCESS) {
+		/*
+		 * Head and tail are written before the body is queued so
+		 * that the cache maintenance of the body also covers them.
+		 */
+		XZDma_CpuFill(DstAddr, Value, Head);
+		XZDma_CpuFill(DstAddr + Head + Body, Value,
+				Size - Head - Body);
+		FillWord = (u32)Value * 0x01010101U;
+		XZDma_CopyQueue(SvcPtr,
+			(u8)(*TokenPtr % XZDMA_COPY_MAX_REQS),
+			DstAddr + Head, 0U, Body, TRUE, FillWord);
+		for (Head = 0U; Head < SvcPtr->NumChans; Head++) {
+			XZDma_CopyKick(&SvcPtr->Chan[Head]);
+		}
+		SvcPtr->DmaReqs++;
+	}
+
+	XZDma_CopyUnlock(SvcPtr, State);
+
+	if ((Status == XST_SUCCESS) && (NumPieces == 0U) &&
+		(Handler != NULL)) {
+		Handler(CallBackRef, *TokenPtr, XST_SUCCESS);
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the state of a request.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	Token is the completion token returned for the request.
+*
+* @return
+*		- XST_DEVICE_BUSY if the request is still in progress.
+*		- XST_SUCCESS if the request completed.
+*		- XST_FAILURE if a channel reported an error for the request.
+*
+* @note		The status of a completed request is kept until its slot in
+*		the request table is reused, after that XST_SUCCESS is
+*		returned. When the service is polled this function also calls
+*		XZDma_CopyService().
+*
+******************************************************************************/
+s32 XZDma_CopyPoll(XZDma_CopySvc *SvcPtr, u32 Token)
+{
+	XZDma_CopyReq *ReqPtr;
+	s32 Status;
+
+	/* Verify arguments */
+	Xil_AssertNonvoid(SvcPtr != NULL);
+	Xil_AssertNonvoid(Token != 0U);
+
+	if (SvcPtr->UseIntr != TRUE) {
+		XZDma_CopyService(SvcPtr);
+	}
+
+	ReqPtr = &SvcPtr->Req[Token % XZDMA_COPY_MAX_REQS];
+	if (ReqPtr->Token != Token) {
+		Status = XST_SUCCESS;
+	}
+	else if (ReqPtr->Pending != 0U) {
+		Status = XST_DEVICE_BUSY;
+	}
+	else {
+		Status = ReqPtr->Status;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function waits until a request completes.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	Token is the completion token returned for the request.
+*
+* @return
+*		- XST_SUCCESS if the request completed.
+*		- XST_FAILURE if a channel reported an error for the request.
+*
+* @note		None.
+*
+******************************************************************************/
+s32 XZDma_CopyWait(XZDma_CopySvc *SvcPtr, u32 Token)
+{
+	s32 Status;
+
+	do {
+		Status = XZDma_CopyPoll(SvcPtr, Token);
+	} while (Status == XST_DEVICE_BUSY);
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function completes the pieces finished by the channels of a polled
+* service and starts the next queued pieces. Completion callbacks of the
+* requests are called from here.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+*
+* @return	None.
+*
+* @note		Only to be used when the service was initialized without
+*		interrupts.
+*
+******************************************************************************/
+void XZDma_CopyService(XZDma_CopySvc *SvcPtr)
+{
+	XZDma_CopyChan *ChanPtr;
+	XZDma *InstancePtr;
+	u32 Value;
+	u32 Index;
+
+	/* Verify arguments */
+	Xil_AssertVoid(SvcPtr != NULL);
+	Xil_AssertVoid(SvcPtr->UseIntr != TRUE);
+
+	for (Index = 0U; Index < SvcPtr->NumChans; Index++) {
+		ChanPtr = &SvcPtr->Chan[Index];
+		if (ChanPtr->Active == XZDMA_COPY_NONE) {
+			continue;
+		}
+
+		InstancePtr = ChanPtr->InstancePtr;
+		Value = XZDma_ReadReg(InstancePtr->Config.BaseAddress,
+				XZDMA_CH_STS_OFFSET) & XZDMA_STS_ALL_MASK;
+		if ((Value != XZDMA_STS_DONE_MASK) &&
+				(Value != XZDMA_STS_DONE_ERR_MASK)) {
+			continue;
+		}
+
+		XZDma_IntrClear(InstancePtr, XZDMA_IXR_ALL_INTR_MASK);
+		InstancePtr->ChannelState = XZDMA_IDLE;
+		XZDma_CopyComplete(ChanPtr,
+			(Value == XZDMA_STS_DONE_MASK) ? XST_SUCCESS :
+			XST_FAILURE);
+		XZDma_CopyKick(ChanPtr);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the interrupt handler of a channel owned by a service that
+* uses interrupts. It runs XZDma_IntrHandler(), which completes the active
+* piece through the service callbacks, and then starts the next queued piece
+* once the interrupt status has been cleared.
+*
+* @param	CallBackRef is a pointer to the XZDma_CopyChan of the channel,
+*		&SvcPtr->Chan[n].
+*
+* @return	None.
+*
+* @note		XZDma_IntrHandler() masks the channel interrupts on done,
+*		they are enabled again here.
+*
+******************************************************************************/
+void XZDma_CopyIntrHandler(void *CallBackRef)
+{
+	XZDma_CopyChan *ChanPtr = (XZDma_CopyChan *)CallBackRef;
+
+	/* Verify arguments */
+	Xil_AssertVoid(ChanPtr != NULL);
+
+	ChanPtr->InIntr = TRUE;
+	XZDma_IntrHandler(ChanPtr->InstancePtr);
+	ChanPtr->InIntr = FALSE;
+
+	XZDma_EnableIntr(ChanPtr->InstancePtr,
+		(XZDMA_IXR_DMA_DONE_MASK | XZDMA_IXR_ERR_MASK));
+	XZDma_CopyKick(ChanPtr);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function protects the queues of a service from its completion
+* callbacks. Interrupts are only masked when the service uses them.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+*
+* @return	The previous interrupt state, to be passed to
+*		XZDma_CopyUnlock().
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XZDma_CopyLock(XZDma_CopySvc *SvcPtr)
+{
+	u32 State = 0U;
+
+	if (SvcPtr->UseIntr == TRUE) {
+		State = mfcpsr();
+		Xil_ExceptionDisable();
+	}
+
+	return State;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function releases the protection taken by XZDma_CopyLock(). The
+* interrupt state is restored rather than enabled, so requests issued from a
+* completion callback do not unmask interrupts inside the handler.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	State is the value returned by XZDma_CopyLock().
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_CopyUnlock(XZDma_CopySvc *SvcPtr, u32 State)
+{
+	if (SvcPtr->UseIntr == TRUE) {
+		mtcpsr(State);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function returns the number of pieces a transfer of Size bytes is
+* split in: one per XZDMA_COPY_SPLIT_SIZE bytes, at most one per channel, and
+* enough to keep every piece below the size limit of a channel.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	Size is the size of the transfer in bytes.
+*
+* @return	Number of pieces.
+*
+* @note		None.
+*
+******************************************************************************/
+static u32 XZDma_CopyNumPieces(XZDma_CopySvc *SvcPtr, u32 Size)
+{
+	u32 NumPieces;
+
+	NumPieces = Size / XZDMA_COPY_SPLIT_SIZE;
+	if (NumPieces > SvcPtr->NumChans) {
+		NumPieces = SvcPtr->NumChans;
+	}
+	if (NumPieces == 0U) {
+		NumPieces = 1U;
+	}
+	while ((Size / NumPieces) > (XZDMA_COPY_MAX_PIECE -
+			XZDMA_COPY_ALIGN)) {
+		NumPieces++;
+	}
+
+	return NumPieces;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function takes a free slot of the request table and returns a new
+* token for it.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	Pending is the number of pieces of the request.
+* @param	Handler is the completion callback.
+* @param	CallBackRef is passed to Handler.
+* @param	TokenPtr returns the token.
+*
+* @return
+*		- XST_SUCCESS if a slot was taken.
+*		- XST_DEVICE_BUSY if all slots are in use.
+*
+* @note		Slots are searched from the one after the last token so
+*		that the status of a completed request is kept as long as
+*		possible.
+*
+******************************************************************************/
+static s32 XZDma_CopyAllocReq(XZDma_CopySvc *SvcPtr, u16 Pending,
+		XZDma_CopyHandler Handler, void *CallBackRef, u32 *TokenPtr)
+{
+	XZDma_CopyReq *ReqPtr;
+	u32 Index;
+	u32 Slot;
+	s32 Status = XST_DEVICE_BUSY;
+
+	for (Index = 0U; Index < XZDMA_COPY_MAX_REQS; Index++) {
+		Slot = (SvcPtr->Seq + Index) % XZDMA_COPY_MAX_REQS;
+		ReqPtr = &SvcPtr->Req[Slot];
+		if (ReqPtr->Pending != 0U) {
+			continue;
+		}
+
+		/* Token 0 is never returned */
+		SvcPtr->Seq += Index + 1U;
+		if (SvcPtr->Seq >= (0xFFFFFFFFU / XZDMA_COPY_MAX_REQS)) {
+			SvcPtr->Seq = 1U;
+		}
+		ReqPtr->Token = (SvcPtr->Seq * XZDMA_COPY_MAX_REQS) + Slot;
+		ReqPtr->Status = XST_SUCCESS;
+		ReqPtr->Pending = Pending;
+		ReqPtr->Handler = Handler;
+		ReqPtr->CallBackRef = CallBackRef;
+		*TokenPtr = ReqPtr->Token;
+		Status = XST_SUCCESS;
+		break;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* This function splits a transfer in pieces and queues each piece on the
+* channel with the least outstanding bytes. The caller has checked that
+* enough descriptors are free.
+*
+* @param	SvcPtr is a pointer to the XZDma_CopySvc instance.
+* @param	Req is the slot of the request.
+* @param	DstAddr is the destination address.
+* @param	SrcAddr is the source address.
+* @param	Size is the size in bytes.
+* @param	IsFill is TRUE for write only transfers.
+* @param	FillWord is the pattern of write only transfers.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_CopyQueue(XZDma_CopySvc *SvcPtr, u8 Req, UINTPTR DstAddr,
+		UINTPTR SrcAddr, u32 Size, u8 IsFill, u32 FillWord)
+{
+	XZDma_CopyChan *ChanPtr;
+	XZDma_CopyDesc *DescPtr;
+	u32 NumPieces;
+	u32 Chunk;
+	u32 Offset = 0U;
+	u32 Len;
+	u32 Piece;
+	u32 Index;
+	u16 DescIdx;
+
+	NumPieces = XZDma_CopyNumPieces(SvcPtr, Size);
+	Chunk = Size / NumPieces;
+
+	for (Piece = 0U; Piece < NumPieces; Piece++) {
+		if (Piece == (NumPieces - 1U)) {
+			Len = Size - Offset;
+		}
+		else {
+			Len = (u32)(((DstAddr + Offset + Chunk) &
+				~((UINTPTR)XZDMA_COPY_ALIGN - 1U)) -
+				(DstAddr + Offset));
+		}
+
+		ChanPtr = &SvcPtr->Chan[0];
+		for (Index = 1U; Index < SvcPtr->NumChans; Index++) {
+			if (SvcPtr->Chan[Index].QueuedBytes <
+					ChanPtr->QueuedBytes) {
+				ChanPtr = &SvcPtr->Chan[Index];
+			}
+		}
+
+		DescIdx = SvcPtr->FreeHead;
+		DescPtr = &SvcPtr->Desc[DescIdx];
+		SvcPtr->FreeHead = DescPtr->Next;
+		SvcPtr->NumFree--;
+
+		DescPtr->DstAddr = DstAddr + Offset;
+		DescPtr->SrcAddr = (IsFill == TRUE) ? 0U : (SrcAddr + Offset);
+		DescPtr->Size = Len;
+		DescPtr->FillWord = FillWord;
+		DescPtr->Req = Req;
+		DescPtr->IsFill = IsFill;
+		DescPtr->Next = XZDMA_COPY_NONE;
+
+		if (!ChanPtr->InstancePtr->Config.IsCacheCoherent) {
+			if (IsFill != TRUE) {
+				Xil_DCacheFlushRange(DescPtr->SrcAddr, Len);
+			}
+			Xil_DCacheFlushRange(DescPtr->DstAddr, Len);
+		}
+
+		if (ChanPtr->Tail == XZDMA_COPY_NONE) {
+			ChanPtr->Head = DescIdx;
+		}
+		else {
+			SvcPtr->Desc[ChanPtr->Tail].Next = DescIdx;
+		}
+		ChanPtr->Tail = DescIdx;
+		ChanPtr->QueuedBytes += Len;
+
+		Offset += Len;
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function starts the first queued piece of an idle channel. The channel
+* is switched between normal and write only mode when needed.
+*
+* @param	ChanPtr is a pointer to the channel.
+*
+* @return	None.
+*
+* @note		Nothing is started while XZDma_IntrHandler() runs for the
+*		channel: it clears the status it read on exit, which could
+*		include the done bit of the new piece. XZDma_CopyIntrHandler()
+*		starts the piece once the handler has returned.
+*
+******************************************************************************/
+static void XZDma_CopyKick(XZDma_CopyChan *ChanPtr)
+{
+	XZDma *InstancePtr = ChanPtr->InstancePtr;
+	XZDma_CopyDesc *DescPtr;
+	XZDma_Transfer Data;
+	u32 Buffer[4];
+	XZDma_Mode Mode;
+
+	if ((ChanPtr->Active != XZDMA_COPY_NONE) ||
+			(ChanPtr->Head == XZDMA_COPY_NONE) ||
+			(ChanPtr->InIntr == TRUE)) {
+		return;
+	}
+
+	DescPtr = &ChanPtr->SvcPtr->Desc[ChanPtr->Head];
+	ChanPtr->Active = ChanPtr->Head;
+	ChanPtr->Head = DescPtr->Next;
+	if (ChanPtr->Head == XZDMA_COPY_NONE) {
+		ChanPtr->Tail = XZDMA_COPY_NONE;
+	}
+
+	Mode = (DescPtr->IsFill == TRUE) ? XZDMA_WRONLY_MODE :
+			XZDMA_NORMAL_MODE;
+	if (InstancePtr->Mode != Mode) {
+		(void)XZDma_SetMode(InstancePtr, FALSE, Mode);
+	}
+	if (DescPtr->IsFill == TRUE) {
+		Buffer[0] = DescPtr->FillWord;
+		Buffer[1] = DescPtr->FillWord;
+		Buffer[2] = DescPtr->FillWord;
+		Buffer[3] = DescPtr->FillWord;
+		XZDma_WOData(InstancePtr, Buffer);
+	}
+
+	Data.SrcAddr = DescPtr->SrcAddr;
+	Data.DstAddr = DescPtr->DstAddr;
+	Data.Size = DescPtr->Size;
+	Data.SrcCoherent = InstancePtr->Config.IsCacheCoherent;
+	Data.DstCoherent = InstancePtr->Config.IsCacheCoherent;
+	Data.Pause = 0U;
+
+	ChanPtr->SvcPtr->DmaPieces++;
+	(void)XZDma_Start(InstancePtr, &Data, 1U);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function completes the active piece of a channel, returns its
+* descriptor to the pool and completes the request once all its pieces are
+* done.
+*
+* @param	ChanPtr is a pointer to the channel.
+* @param	Status is the status of the piece.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_CopyComplete(XZDma_CopyChan *ChanPtr, s32 Status)
+{
+	XZDma_CopySvc *SvcPtr = ChanPtr->SvcPtr;
+	XZDma_CopyDesc *DescPtr;
+	XZDma_CopyReq *ReqPtr;
+	u16 DescIdx = ChanPtr->Active;
+
+	if (DescIdx == XZDMA_COPY_NONE) {
+		return;
+	}
+
+	DescPtr = &SvcPtr->Desc[DescIdx];
+	ReqPtr = &SvcPtr->Req[DescPtr->Req];
+
+	if (!ChanPtr->InstancePtr->Config.IsCacheCoherent) {
+		Xil_DCacheInvalidateRange(DescPtr->DstAddr, DescPtr->Size);
+	}
+
+	ChanPtr->Active = XZDMA_COPY_NONE;
+	ChanPtr->QueuedBytes -= DescPtr->Size;
+	DescPtr->Next = SvcPtr->FreeHead;
+	SvcPtr->FreeHead = DescIdx;
+	SvcPtr->NumFree++;
+
+	if (Status != XST_SUCCESS) {
+		ReqPtr->Status = XST_FAILURE;
+	}
+	ReqPtr->Pending--;
+	if ((ReqPtr->Pending == 0U) && (ReqPtr->Handler != NULL)) {
+		ReqPtr->Handler(ReqPtr->CallBackRef, ReqPtr->Token,
+				ReqPtr->Status);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the done callback installed on every channel of a service
+* that uses interrupts. It completes the active piece, the next one is started
+* by XZDma_CopyIntrHandler().
+*
+* @param	CallBackRef is a pointer to the channel.
+*
+* @return	None.
+*
+* @note		Error bits still pending with the done interrupt fail the
+*		piece, XZDma_CopyErrorCallBack() then ignores them.
+*
+******************************************************************************/
+static void XZDma_CopyDoneCallBack(void *CallBackRef)
+{
+	XZDma_CopyChan *ChanPtr = (XZDma_CopyChan *)CallBackRef;
+	u32 ErrorMask;
+
+	ErrorMask = XZDma_IntrGetStatus(ChanPtr->InstancePtr) &
+			XZDMA_IXR_ERR_MASK & ~XZDMA_IXR_DMA_PAUSE_MASK;
+
+	XZDma_CopyComplete(ChanPtr,
+		(ErrorMask == 0U) ? XST_SUCCESS : XST_FAILURE);
+}
+
+/*****************************************************************************/
+/**
+*
+* This function is the error callback installed on every channel of a service
+* that uses interrupts. An AXI error stops the channel without a done
+* interrupt, so the active piece is failed here.
+*
+* @param	CallBackRef is a pointer to the channel.
+* @param	ErrorMask is the mask of errors reported by the channel.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_CopyErrorCallBack(void *CallBackRef, u32 ErrorMask)
+{
+	XZDma_CopyChan *ChanPtr = (XZDma_CopyChan *)CallBackRef;
+	u32 Pending;
+
+	Pending = XZDma_IntrGetStatus(ChanPtr->InstancePtr);
+	if ((Pending & XZDMA_IXR_DMA_DONE_MASK) != 0U) {
+		/* Already accounted by the done callback */
+		return;
+	}
+
+	if ((ErrorMask & (XZDMA_IXR_AXI_WR_DATA_MASK |
+			XZDMA_IXR_AXI_RD_DATA_MASK |
+			XZDMA_IXR_AXI_RD_DST_DSCR_MASK |
+			XZDMA_IXR_AXI_RD_SRC_DSCR_MASK)) != 0U) {
+		XZDma_CopyComplete(ChanPtr, XST_FAILURE);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* This function writes Size bytes of Value at DstAddr with the processor.
+*
+* @param	DstAddr is the destination address.
+* @param	Value is the byte written.
+* @param	Size is the number of bytes.
+*
+* @return	None.
+*
+* @note		None.
+*
+******************************************************************************/
+static void XZDma_CpuFill(UINTPTR DstAddr, u8 Value, u32 Size)
+{
+	u8 *Dst8 = (u8 *)DstAddr;
+	u32 *Dst32;
+	u32 Word = (u32)Value * 0x01010101U;
+	u32 Index = 0U;
+
+	while ((Index < Size) && (((DstAddr + Index) & 3U) != 0U)) {
+		Dst8[Index] = Value;
+		Index++;
+	}
+	Dst32 = (u32 *)(DstAddr + Index);
+	while ((Size - Index) >= 4U) {
+		*Dst32 = Word;
+		Dst32++;
+		Index += 4U;
+	}
+	while (Index < Size) {
+		Dst8[Index] = Value;
+		Index++;
+	}
+}
+/** @} */
@@ -28,6 +28,8 @@
 *       bsv  04/01/21 Added TPM support
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
+*       kk   10/19/26 Added prototypes of XFsbl_ShaUpdateStart() and
+*                     XFsbl_ShaUpdateWait()
 *
 * </pre>
 *
@@ -106,6 +108,10 @@ void XFsbl_ShaDigest(const u8 *In, const u32 Size, u8 *Out, u32 HashLen);
 void XFsbl_ShaFinish(void * Ctx, u8 * Hash, u32 HashLen);
 void XFsbl_ShaStart(void * Ctx, u32 HashLen);
 void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen);
+#ifdef XFSBL_HASH_STREAM
+u32 XFsbl_ShaUpdateStart(const u8 * Data, u32 Size);
+u32 XFsbl_ShaUpdateWait(void);
+#endif
 #ifdef XFSBL_PL_LOAD_FROM_OCM
 #ifdef XFSBL_BS
 u32 XFsbl_ShaUpdate_DdrLess(const XFsblPs *FsblInstancePtr, void *Ctx,
@@ -30,6 +30,8 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed is disabled by
 *                     default
+*       kk   10/18/26 Added FSBL_HASH_STREAM_EXCLUDE_VAL configuration
+*       kk   10/18/26 Added FSBL_ZDMA_COPY_EXCLUDE_VAL configuration
 *
 *</pre>
 *
@@ -138,6 +140,10 @@ extern "C" {
  *     - FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL Code to "load authenticated
  *       partitions as non secure when EFUSEs are not programmed and when boot
  *       header is not authenticated" is excluded
+ *     - FSBL_HASH_STREAM_EXCLUDE_VAL Code to calculate partition checksum
+ *       chunk by chunk while the partition is copied is excluded
+ *     - FSBL_ZDMA_COPY_EXCLUDE_VAL Code to queue partition copies on ZDMA
+ *       channels in USB boot mode is excluded
  */
 #ifndef FSBL_NAND_EXCLUDE_VAL
 #define FSBL_NAND_EXCLUDE_VAL			(0U)
@@ -211,6 +217,14 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE_VAL	(1U)
 #endif
 
+#ifndef FSBL_HASH_STREAM_EXCLUDE_VAL
+#define FSBL_HASH_STREAM_EXCLUDE_VAL	(0U)
+#endif
+
+#ifndef FSBL_ZDMA_COPY_EXCLUDE_VAL
+#define FSBL_ZDMA_COPY_EXCLUDE_VAL		(0U)
+#endif
+
 #if (FSBL_NAND_EXCLUDE_VAL) && (!defined(FSBL_NAND_EXCLUDE))
 #define FSBL_NAND_EXCLUDE
 #endif
@@ -286,6 +300,16 @@ extern "C" {
 #define FSBL_UNPROVISIONED_AUTH_SIGN_EXCLUDE
 #endif
 
+#if (FSBL_HASH_STREAM_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_HASH_STREAM_EXCLUDE))
+#define FSBL_HASH_STREAM_EXCLUDE
+#endif
+
+#if (FSBL_ZDMA_COPY_EXCLUDE_VAL == 1U) && \
+	(!defined(FSBL_ZDMA_COPY_EXCLUDE))
+#define FSBL_ZDMA_COPY_EXCLUDE
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
@@ -25,6 +25,7 @@
 * 5.0   ka   04/10/18 Added error codes for user-efuse revocation
 * 6.0   bkm  04/10/18 Added error codes for FMC_VADJ
 * 7.0	bsv	 08/27/19 Added error code for invalid image header size
+*       kk   10/18/26 Added error codes for ZDMA partition copy
 *
 * </pre>
 *
@@ -189,6 +190,8 @@ extern "C" {
 #define XFSBL_BITSTREAM_NOT_LOADED				(0x77U)
 #define XFSBL_ERROR_SHA2_NOT_SUPPORTED				(0x78U)
 #define XFSBL_ERROR_IMAGE_HEADER_SIZE				(0x79U)
+#define XFSBL_ERROR_ZDMA_INIT_FAIL				(0x7AU)
+#define XFSBL_ERROR_ZDMA_COPY_FAIL				(0x7BU)
 #define XFSBL_FAILURE					(0x3FFFFFFFU)
 
 /**************************** Type Definitions *******************************/
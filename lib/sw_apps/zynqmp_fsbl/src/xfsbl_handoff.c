@@ -27,6 +27,8 @@
  * 3.0   ma   09/09/19 Update FSBL proc info reporting to PMU
  * 4.0   bsv  03/05/19 Restore value of SD_CDN_CTRL register before
  *                     handoff in FSBL
+ *       kk   10/18/26 Wait for partition copies queued on ZDMA before
+ *                     handoff
  *
  * </pre>
  *
@@ -41,6 +43,7 @@
 #include "xfsbl_main.h"
 #include "xfsbl_image_header.h"
 #include "xfsbl_bs.h"
+#include "xfsbl_zdma.h"
 
 /************************** Constant Definitions *****************************/
 #define XFSBL_CPU_POWER_UP		(0x1U)
@@ -721,6 +724,27 @@ u32 XFsbl_Handoff (const XFsblPs * FsblInstancePtr, u32 PartitionNum, u32 EarlyH
 	u32 CpuNeedsEarlyHandoff;
 	const XFsblPs_PartitionHeader * PartitionHeader;
 	static u32 CpuIndexEarlyHandoff = 0;
+#if defined(XFSBL_ZDMA_COPY) && defined(XFSBL_PERF)
+	XTime tCur = 0;
+#endif
+
+#ifdef XFSBL_ZDMA_COPY
+#ifdef XFSBL_PERF
+	XTime_GetTime(&tCur);
+#endif
+	/**
+	 * Partitions queued on ZDMA must be in place before any cpu is
+	 * released
+	 */
+	Status = XFsbl_ZDmaCopyWaitAll();
+	if (Status != XFSBL_SUCCESS) {
+		goto END;
+	}
+#ifdef XFSBL_PERF
+	XFsbl_MeasurePerfTime(tCur);
+	XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": ZDMA copy wait time \r\n");
+#endif
+#endif
 
 	/* Restoring the SD card detection signal */
 	XFsbl_Out32(IOU_SLCR_SD_CDN_CTRL, SdCdnRegVal);
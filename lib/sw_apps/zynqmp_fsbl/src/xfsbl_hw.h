@@ -27,6 +27,8 @@
 * 5.0   bsv  04/01/21 Added TPM support
 *       bsv  05/03/21 Add provision to load bitstream from OCM with DDR
 *                     present in design
+*       kk   10/18/26 Added XFSBL_HASH_STREAM definition
+*       kk   10/18/26 Added XFSBL_ZDMA_COPY definition
 *
 * </pre>
 *
@@ -930,6 +932,23 @@ extern "C" {
 #define XFSBL_PROT_BYPASS
 #endif
 
+/*
+ * Definition for queuing copies of partitions, which need no validation,
+ * on ZDMA channels when boot image is already in DDR (USB boot mode)
+ */
+#if (!defined(FSBL_ZDMA_COPY_EXCLUDE) && defined(XFSBL_USB) \
+	&& defined(XPAR_XZDMA_0_DEVICE_ID) && (!defined(XFSBL_TPM)))
+#define XFSBL_ZDMA_COPY
+#endif
+
+/*
+ * Definition for calculating partition checksum while the partition is
+ * copied from boot device, instead of a second pass over the load address
+ */
+#if !defined(FSBL_HASH_STREAM_EXCLUDE)
+#define XFSBL_HASH_STREAM
+#endif
+
 #ifdef ARMR5
 #define XFSBL_PS_DDR_INIT_START_ADDRESS	XFSBL_PS_DDR_START_ADDRESS_R5
 #if defined(XPAR_PSU_R5_DDR_1_S_AXI_BASEADDR)
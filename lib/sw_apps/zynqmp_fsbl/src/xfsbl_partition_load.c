@@ -50,6 +50,12 @@
 *       bsv  05/15/21 Support to ensure authenticated images boot as
 *                     non-secure when RSA_EN is not programmed and boot header
 *                     is not authenticated is disabled by default
+*       kk   10/18/26 Calculate SHA3 checksum chunk by chunk while the
+*                     partition is copied from boot device
+*       kk   10/18/26 Queue copies of partitions which need no validation
+*                     on ZDMA channels in USB boot mode
+*       kk   10/19/26 Hash a copied chunk on CSU DMA while the next chunk is
+*                     read from boot device
 *
 * </pre>
 *
@@ -68,6 +74,8 @@
 #include "psu_init.h"
 #include "xfsbl_plpartition_valid.h"
 #include "xfsbl_tpm.h"
+#include "xfsbl_zdma.h"
+#include "xfsbl_usb.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -90,6 +98,10 @@
 #define XFSBL_EL2_VAL		(4U)
 #define XFSBL_EL3_VAL		(6U)
 #endif
+#ifdef XFSBL_HASH_STREAM
+/* Chunks hashed while the next one is copied are whole SHA3 blocks */
+#define XFSBL_HASH_STREAM_CHUNK_SIZE	(XSECURE_SHA3_BLOCK_LEN * 630U)
+#endif
 
 /************************** Function Prototypes ******************************/
 static u32 XFsbl_PartitionHeaderValidation(XFsblPs * FsblInstancePtr,
@@ -124,6 +136,14 @@ static void XFsbl_SetR5ExcepVectorLoVec(void);
 #ifdef XFSBL_TPM
 static u8 XFsbl_GetPcrIndex(const XFsblPs * FsblInstancePtr, u32 PartitionNum);
 #endif
+#ifdef XFSBL_ZDMA_COPY
+static u32 XFsbl_IsCopyDeferrable(const XFsblPs * FsblInstancePtr,
+	const XFsblPs_PartitionHeader * PartitionHeader, u32 DestinationCpu);
+#endif
+#ifdef XFSBL_HASH_STREAM
+static u32 XFsbl_CopyAndCalculateSHA(const XFsblPs * FsblInstancePtr,
+	u32 SrcAddress, PTRSIZE LoadAddress, u32 Length);
+#endif
 
 /************************** Variable Definitions *****************************/
 #ifdef ARMR5
@@ -146,6 +166,13 @@ u8 HashsOfChunks[HASH_BUFFER_SIZE] __attribute__((section (".bitstream_buffer"))
 #endif
 #endif
 
+#ifdef XFSBL_HASH_STREAM
+/* SHA3 digest calculated while the current partition was copied */
+static u8 StreamedPartitionHash[XFSBL_HASH_TYPE_SHA3]
+	__attribute__ ((aligned (4U))) = {0U};
+static u8 IsPartitionHashStreamed = FALSE;
+#endif
+
 /* buffer for storing chunks for bitstream */
 #if defined(XFSBL_BS)
 extern u8 ReadBuffer[READ_BUFFER_SIZE];
@@ -864,6 +891,10 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	u32 Index;
 #endif
 
+#ifdef XFSBL_HASH_STREAM
+	IsPartitionHashStreamed = FALSE;
+#endif
+
 	/**
 	 * Assign the partition header to local variable
 	 */
@@ -1105,11 +1136,67 @@ static u32 XFsbl_PartitionCopy(XFsblPs * FsblInstancePtr, u32 PartitionNum)
 	XTime tCur = 0;
 	XTime_GetTime(&tCur);
 #endif
+#ifdef XFSBL_ZDMA_COPY
+	if (XFsbl_IsCopyDeferrable(FsblInstancePtr, PartitionHeader,
+			DestinationCpu) == TRUE)
+	{
+		/**
+		 * Partition is not read again by FSBL, queue the copy on ZDMA
+		 * and continue with the next partition. Copies are waited
+		 * for before handoff.
+		 */
+		Status = XFsbl_UsbCopyAsync(SrcAddress, LoadAddress, Length);
+#ifdef XFSBL_PERF
+		XFsbl_MeasurePerfTime(tCur);
+		XFsbl_Printf(DEBUG_PRINT_ALWAYS, ": P%u Copy queued, Size: %0u \r\n",
+				PartitionNum, Length);
+#endif
+		goto END;
+	}
+
+	if (DestinationDevice == XIH_PH_ATTRB_DEST_DEVICE_PL)
+	{
+		/**
+		 * Bitstream is staged in DDR temporary address, make sure
+		 * no queued copy is still writing there
+		 */
+		Status = XFsbl_ZDmaCopyWaitAll();
+		if (XFSBL_SUCCESS != Status)
+		{
+			goto END;
+		}
+	}
+#endif
+#ifdef XFSBL_HASH_STREAM
 	/**
-	 * Copy the partition to PS_DDR/PL_DDR/TCM
+	 * For SHA3 checksum enabled PS partitions copied in full, feed each
+	 * chunk to SHA3 engine as soon as it lands at the load address so
+	 * that partition validation need not read the partition again
 	 */
-	Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
+	if ((XFsbl_GetChecksumType(PartitionHeader) == XIH_PH_ATTRB_HASH_SHA3)
+		&& (DestinationDevice != XIH_PH_ATTRB_DEST_DEVICE_PL) &&
+		(Length == (PartitionHeader->TotalDataWordLength *
+				XIH_PARTITION_WORD_LENGTH)))
+	{
+		/**
+		 * Copy the partition to PS_DDR/TCM and calculate its SHA3
+		 */
+		Status = XFsbl_CopyAndCalculateSHA(FsblInstancePtr, SrcAddress,
+					LoadAddress, Length);
+		if (XFSBL_SUCCESS == Status)
+		{
+			IsPartitionHashStreamed = TRUE;
+		}
+	}
+	else
+#endif
+	{
+		/**
+		 * Copy the partition to PS_DDR/PL_DDR/TCM
+		 */
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(SrcAddress,
 					LoadAddress, Length);
+	}
 
 #ifdef XFSBL_PERF
 	XFsbl_MeasurePerfTime(tCur);
@@ -1845,6 +1932,19 @@ static u32 XFsbl_CalculateCheckSum(XFsblPs * FsblInstancePtr,
 	}
 
 	XFsbl_Printf(DEBUG_INFO,"CheckSum Type - SHA3\r\n");
+#ifdef XFSBL_HASH_STREAM
+	/**
+	 * Digest is already calculated while the partition is copied
+	 */
+	if (IsPartitionHashStreamed == TRUE)
+	{
+		IsPartitionHashStreamed = FALSE;
+		(void)XFsbl_MemCpy(PartitionHash, StreamedPartitionHash,
+				XFSBL_HASH_TYPE_SHA3);
+		Status = XFSBL_SUCCESS;
+		goto END;
+	}
+#endif
 #ifdef XFSBL_PL_LOAD_FROM_OCM
 	if (DestinationDevice == XIH_PH_ATTRB_DEST_DEVICE_PL)
 	{
@@ -1955,6 +2055,167 @@ static void XFsbl_CalculateSHA(const XFsblPs * FsblInstancePtr,
 		XFSBL_HASH_TYPE_SHA3);
 }
 
+#ifdef XFSBL_ZDMA_COPY
+/*****************************************************************************/
+/**
+ * This function checks whether copy of the partition can be queued on ZDMA
+ * and left running while FSBL processes the next partitions. It is possible
+ * only when the boot image is in DDR and FSBL does not read the partition
+ * again, i.e. no checksum, authentication or encryption is enabled for it.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	PartitionHeader is pointer to the partition header
+ * @param	DestinationCpu is the destination cpu of the partition
+ *
+ * @return	returns TRUE if copy can be queued, FALSE otherwise
+ *
+ *****************************************************************************/
+static u32 XFsbl_IsCopyDeferrable(const XFsblPs * FsblInstancePtr,
+	const XFsblPs_PartitionHeader * PartitionHeader, u32 DestinationCpu)
+{
+	u32 IsDeferrable = FALSE;
+
+	if ((FsblInstancePtr->PrimaryBootDevice != XFSBL_USB_BOOT_MODE) ||
+		(XFsbl_GetDestinationDevice(PartitionHeader) ==
+			XIH_PH_ATTRB_DEST_DEVICE_PL) ||
+		(DestinationCpu == XIH_PH_ATTRB_DEST_CPU_PMU))
+	{
+		goto END;
+	}
+
+	if ((XFsbl_GetChecksumType(PartitionHeader) != XIH_PH_ATTRB_NOCHECKSUM)
+		|| (XFsbl_IsRsaSignaturePresent(PartitionHeader) ==
+			XIH_PH_ATTRB_RSA_SIGNATURE) ||
+		(XFsbl_IsEncrypted(PartitionHeader) == XIH_PH_ATTRB_ENCRYPTION))
+	{
+		goto END;
+	}
+
+#ifdef ARMR5
+	/* R5 vectors are restored from the partition after validation */
+	if (IsR5IvtBackup == TRUE)
+	{
+		goto END;
+	}
+#endif
+
+	IsDeferrable = TRUE;
+
+END:
+	return IsDeferrable;
+}
+#endif
+
+#ifdef XFSBL_HASH_STREAM
+/*****************************************************************************/
+/**
+ * This function copies the partition from boot device to load address in
+ * chunks and updates SHA3 engine with each chunk once it is copied. The
+ * resulting digest is stored and later consumed by XFsbl_CalculateCheckSum.
+ *
+ * The CSU DMA feeds a copied chunk to the SHA3 engine while the next chunk
+ * is read from the boot device. USB boot copies through the CSU DMA itself,
+ * so chunks are then hashed after each copy, as is the last partial chunk.
+ *
+ * @param	FsblInstancePtr is pointer to the XFsbl Instance
+ * @param	SrcAddress is the boot device offset of the partition
+ * @param	LoadAddress Load address of partition
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	returns XFSBL_SUCCESS on success
+ * 			returns the error code of the device copy on failure
+ *
+ *****************************************************************************/
+static u32 XFsbl_CopyAndCalculateSHA(const XFsblPs * FsblInstancePtr,
+	u32 SrcAddress, PTRSIZE LoadAddress, u32 Length)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 Offset = 0U;
+	u32 ChunkSize;
+	u32 IsHashPending = FALSE;
+	u32 IsOverlapped = FALSE;
+
+	if ((FsblInstancePtr->PrimaryBootDevice != XFSBL_USB_BOOT_MODE) &&
+		(FsblInstancePtr->SecondaryBootDevice != XFSBL_USB_BOOT_MODE) &&
+		((LoadAddress & (XFSBL_WORD_LEN_IN_BYTES - 1U)) == 0U))
+	{
+		IsOverlapped = TRUE;
+	}
+
+	/* Start the SHA engine */
+	XFsbl_ShaStart(NULL, XFSBL_HASH_TYPE_SHA3);
+
+	while (Offset < Length)
+	{
+		ChunkSize = Length - Offset;
+		if (ChunkSize > XFSBL_HASH_STREAM_CHUNK_SIZE)
+		{
+			ChunkSize = XFSBL_HASH_STREAM_CHUNK_SIZE;
+		}
+
+		/* The previous chunk is hashed while this one is copied */
+		Status = FsblInstancePtr->DeviceOps.DeviceCopy(
+				SrcAddress + Offset, LoadAddress + Offset,
+				ChunkSize);
+		if (XFSBL_SUCCESS != Status)
+		{
+			XFsbl_Printf(DEBUG_GENERAL,
+				"XFsbl_CopyAndCalculateSHA: Device copy failed\r\n");
+			goto END;
+		}
+
+		if (IsHashPending == TRUE)
+		{
+			IsHashPending = FALSE;
+			Status = XFsbl_ShaUpdateWait();
+			if (XFSBL_SUCCESS != Status)
+			{
+				goto END;
+			}
+		}
+
+		if ((IsOverlapped == TRUE) &&
+			(ChunkSize == XFSBL_HASH_STREAM_CHUNK_SIZE))
+		{
+			Status = XFsbl_ShaUpdateStart(
+					(u8 *)(LoadAddress + Offset), ChunkSize);
+			if (XFSBL_SUCCESS != Status)
+			{
+				goto END;
+			}
+			IsHashPending = TRUE;
+		}
+		else
+		{
+			XFsbl_ShaUpdate(NULL, (u8 *)(LoadAddress + Offset),
+					ChunkSize, XFSBL_HASH_TYPE_SHA3);
+		}
+
+		Offset += ChunkSize;
+	}
+
+	if (IsHashPending == TRUE)
+	{
+		IsHashPending = FALSE;
+		Status = XFsbl_ShaUpdateWait();
+		if (XFSBL_SUCCESS != Status)
+		{
+			goto END;
+		}
+	}
+
+	XFsbl_ShaFinish(NULL, StreamedPartitionHash, XFSBL_HASH_TYPE_SHA3);
+
+END:
+	/* Do not leave the CSU DMA running on a failed copy */
+	if (IsHashPending == TRUE)
+	{
+		(void)XFsbl_ShaUpdateWait();
+	}
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_ENABLE_DDR_SR
 /*****************************************************************************/
 /**
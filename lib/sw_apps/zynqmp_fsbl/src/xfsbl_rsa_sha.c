@@ -23,6 +23,8 @@
  * 4.0   har  06/17/20  Removed references to unused algorithms
  * 5.0   bsv  03/11/21  Fixed build issues
  *       kpt  03/16/21  Updated function headers with appropriate description
+ *       kk   10/19/26  Added XFsbl_ShaUpdateStart() and XFsbl_ShaUpdateWait()
+ *                      to hash a chunk while the next one is copied
  *
  * </pre>
  *
@@ -131,6 +133,73 @@ void XFsbl_ShaUpdate(void * Ctx, u8 * Data, u32 Size, u32 HashLen)
 	}
 }
 
+#ifdef XFSBL_HASH_STREAM
+/*****************************************************************************
+ * This function starts the CSU DMA transfer of the input data to the SHA3
+ * engine and returns without waiting for it to complete, so that the next
+ * data can be read from the boot device meanwhile.
+ *
+ * @param       Data     Pointer to the word aligned input data
+ * @param       Size     Size of the input data, a multiple of the SHA3 block
+ *                       length
+ *
+ * @return      XFSBL_SUCCESS if the transfer is started
+ *              XFSBL_ERROR_PARTITION_CHECKSUM_FAILED if SSS configuration
+ *              failed
+ *
+ * @note        The SHA3 engine must have been started with XFsbl_ShaStart()
+ *              and every previous update must have been a multiple of the
+ *              SHA3 block length. XFsbl_ShaUpdateWait() must be called before
+ *              the next update or before the CSU DMA is used otherwise.
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaUpdateStart(const u8 * Data, u32 Size)
+{
+	u32 Status;
+
+	Status = XSecure_SssSha(&SecureSha3.SssInstance,
+				CsuDma.Config.DeviceId);
+	if (Status != (u32)XST_SUCCESS) {
+		Status = XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+		goto END;
+	}
+
+	/* Padding in XSecure_Sha3Finish() depends on the total length */
+	SecureSha3.Sha3Len += Size;
+	XCsuDma_Transfer(&CsuDma, XCSUDMA_SRC_CHANNEL, (UINTPTR)Data,
+				Size / XFSBL_WORD_LEN_IN_BYTES, 0U);
+	Status = XFSBL_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************
+ * This function waits for the transfer started by XFsbl_ShaUpdateStart().
+ *
+ * @param       None
+ *
+ * @return      XFSBL_SUCCESS if the transfer completed
+ *              XFSBL_ERROR_PARTITION_CHECKSUM_FAILED on timeout
+ *
+ ******************************************************************************/
+u32 XFsbl_ShaUpdateWait(void)
+{
+	u32 Status;
+
+	Status = XCsuDma_WaitForDoneTimeout(&CsuDma, XCSUDMA_SRC_CHANNEL);
+	XCsuDma_IntrClear(&CsuDma, XCSUDMA_SRC_CHANNEL, XCSUDMA_IXR_DONE_MASK);
+	if (Status != (u32)XST_SUCCESS) {
+		Status = XFSBL_ERROR_PARTITION_CHECKSUM_FAILED;
+	}
+	else {
+		Status = XFSBL_SUCCESS;
+	}
+
+	return Status;
+}
+#endif
+
 #ifdef XFSBL_SECURE
 /*****************************************************************************
  *
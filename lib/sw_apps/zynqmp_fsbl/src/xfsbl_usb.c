@@ -22,6 +22,7 @@
 *                         clear SHA and AES nibbles and avoid DMA corrupting
 *                         destination data
 * 4.0   bvikram  06/09/21 Added support for delayed enumeration of DFU devices
+*       kk       10/18/26 Added XFsbl_UsbCopyAsync to queue copies on ZDMA
 *
 * </pre>
 *
@@ -38,6 +39,7 @@
 #include "xcsudma.h"
 #include "xfsbl_csu_dma.h"
 #include "xfsbl_dfu_util.h"
+#include "xfsbl_zdma.h"
 
 /************************** Constant Definitions ****************************/
 
@@ -144,6 +146,13 @@ u32 XFsbl_UsbInit(u32 DeviceFlags)
 
 	if(DownloadDone == XFSBL_DOWNLOAD_COMPLETE) {
 		Status = XFSBL_SUCCESS;
+#ifdef XFSBL_ZDMA_COPY
+		/*
+		 * ZDMA is optional for USB boot, copies fall back to
+		 * CSU DMA when no channel could be initialized
+		 */
+		(void)XFsbl_ZDmaInit();
+#endif
 	}
 	else
 	{
@@ -199,6 +208,44 @@ END:
 	return Status;
 }
 
+#ifdef XFSBL_ZDMA_COPY
+/*****************************************************************************
+* This function queues a copy from DFU temporary address in DDR to destination
+* on a ZDMA channel and returns without waiting for completion. Caller has to
+* call XFsbl_ZDmaCopyWaitAll before the destination is used.
+*
+* @param	Source Address
+* @param	Destination Address
+* @param	Number of Bytes to be copied
+*
+* @return
+*		- XFSBL_SUCCESS if successful,
+*		- XFSBL_FAILURE or ZDMA error code if unsuccessful.
+*
+* @note		Copy is done synchronously through XFsbl_UsbCopy when no
+*		ZDMA channel is available.
+*
+*****************************************************************************/
+u32 XFsbl_UsbCopyAsync(u32 SrcAddress, PTRSIZE DestAddress, u32 Length)
+{
+	u32 Status;
+
+	Status = XFsbl_CheckTempDfuMemory(SrcAddress + Length);
+	if(Status == XFSBL_FAILURE){
+		goto END;
+	}
+
+	Status = XFsbl_ZDmaCopyStart((PTRSIZE)DfuVirtFlash + SrcAddress,
+			DestAddress, Length);
+	if (Status == XFSBL_ERROR_ZDMA_INIT_FAIL) {
+		Status = XFsbl_UsbCopy(SrcAddress, DestAddress, Length);
+	}
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************
 * This function is only for compatibility with other device ops structures.
 *
@@ -99,6 +99,9 @@ s32 XFsbl_SetConfiguration(struct Usb_DevData *InstancePtr, SetupPacket *Ctrl);
 void XFsbl_DfuSetState(struct Usb_DevData* InstancePtr, u32 DfuState);
 u32 XFsbl_UsbInit(u32 DeviceFlags);
 u32 XFsbl_UsbCopy(u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
+#ifdef XFSBL_ZDMA_COPY
+u32 XFsbl_UsbCopyAsync(u32 SrcAddress, PTRSIZE DestAddress, u32 Length);
+#endif
 u32 XFsbl_UsbRelease(void);
 u32 XFsbl_CheckTempDfuMemory(u32 Offset);
 
@@ -0,0 +1,246 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_zdma.c
+ *
+ * Contains code to queue memory to memory partition copies on ZDMA channels
+ * so that FSBL can process the next partition while the copy is in flight.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.00  kk   10/18/26 Initial release
+ *       kk   10/19/26 Flush source and destination before a copy and
+ *                     invalidate the destination when it completes
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xfsbl_zdma.h"
+
+#ifdef XFSBL_ZDMA_COPY
+#include "xfsbl_main.h"
+#include "xil_cache.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static u32 XFsbl_ZDmaWaitChannel(u32 ChIndex);
+
+/************************** Variable Definitions *****************************/
+static XZDma ZDmaCh[XFSBL_ZDMA_NUM_CHANNELS];
+static u8 ZDmaChBusy[XFSBL_ZDMA_NUM_CHANNELS] = {0U};
+static PTRSIZE ZDmaChDest[XFSBL_ZDMA_NUM_CHANNELS] = {0U};
+static u32 ZDmaChLength[XFSBL_ZDMA_NUM_CHANNELS] = {0U};
+static u32 ZDmaNumChannels = 0U;
+static u32 ZDmaNextCh = 0U;
+
+/*****************************************************************************/
+/**
+ * This function initializes the ZDMA channels used for partition copies.
+ * Channels missing from the design are skipped.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_ERROR_ZDMA_INIT_FAIL if no channel could be
+ * 			initialized
+ * 		returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaInit(void)
+{
+	u32 Status;
+	s32 SStatus;
+	u32 Index;
+	XZDma_Config *ZDmaConfig;
+
+	ZDmaNumChannels = 0U;
+	ZDmaNextCh = 0U;
+
+	for (Index = 0U; Index < XFSBL_ZDMA_NUM_CHANNELS; Index++)
+	{
+		ZDmaConfig = XZDma_LookupConfig((u16)(XPAR_XZDMA_0_DEVICE_ID
+					+ Index));
+		if (NULL == ZDmaConfig) {
+			break;
+		}
+
+		SStatus = XZDma_CfgInitialize(&ZDmaCh[Index], ZDmaConfig,
+				ZDmaConfig->BaseAddress);
+		if (SStatus != XST_SUCCESS) {
+			break;
+		}
+
+		SStatus = XZDma_SetMode(&ZDmaCh[Index], FALSE,
+				XZDMA_NORMAL_MODE);
+		if (SStatus != XST_SUCCESS) {
+			break;
+		}
+
+		ZDmaChBusy[Index] = FALSE;
+		ZDmaNumChannels++;
+	}
+
+	if (ZDmaNumChannels == 0U) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ZDMA_INIT_FAIL \n\r");
+		Status = XFSBL_ERROR_ZDMA_INIT_FAIL;
+	}
+	else {
+		XFsbl_Printf(DEBUG_INFO, "ZDMA copy channels: %u \n\r",
+				ZDmaNumChannels);
+		Status = XFSBL_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function queues a memory to memory copy on the next ZDMA channel and
+ * returns without waiting for the copy to complete. If the channel still
+ * has a copy in flight, it waits for that copy first. ZDMA is not cache
+ * coherent, so the source and destination are flushed before the copy
+ * and the destination is invalidated once the copy is waited for.
+ *
+ * @param	SrcAddress is the source address of the copy
+ * @param	DestAddress is the destination address of the copy
+ * @param	Length is the number of bytes to be copied
+ *
+ * @return	returns XFSBL_ERROR_ZDMA_INIT_FAIL if no channel is available
+ * 		returns XFSBL_ERROR_ZDMA_COPY_FAIL on any other error
+ * 		returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaCopyStart(PTRSIZE SrcAddress, PTRSIZE DestAddress, u32 Length)
+{
+	u32 Status;
+	s32 SStatus;
+	u32 ChIndex;
+	XZDma_Transfer Data = {0U};
+
+	if (ZDmaNumChannels == 0U) {
+		Status = XFSBL_ERROR_ZDMA_INIT_FAIL;
+		goto END;
+	}
+
+	ChIndex = ZDmaNextCh;
+	ZDmaNextCh = (ZDmaNextCh + 1U) % ZDmaNumChannels;
+
+	Status = XFsbl_ZDmaWaitChannel(ChIndex);
+	if (XFSBL_SUCCESS != Status) {
+		goto END;
+	}
+
+	Data.SrcAddr = (UINTPTR)SrcAddress;
+	Data.DstAddr = (UINTPTR)DestAddress;
+	Data.Size = Length;
+	Data.SrcCoherent = 0U;
+	Data.DstCoherent = 0U;
+
+	/**
+	 * Write back the source and any dirty destination lines so that
+	 * they are not evicted over the copied data
+	 */
+	Xil_DCacheFlushRange((INTPTR)SrcAddress, Length);
+	Xil_DCacheFlushRange((INTPTR)DestAddress, Length);
+
+	SStatus = XZDma_Start(&ZDmaCh[ChIndex], &Data, 1U);
+	if (SStatus != XST_SUCCESS) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ZDMA_COPY_FAIL \n\r");
+		Status = XFSBL_ERROR_ZDMA_COPY_FAIL;
+		goto END;
+	}
+	ZDmaChDest[ChIndex] = DestAddress;
+	ZDmaChLength[ChIndex] = Length;
+	ZDmaChBusy[ChIndex] = TRUE;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits for all the queued ZDMA copies to complete.
+ *
+ * @param	None
+ *
+ * @return	returns XFSBL_ERROR_ZDMA_COPY_FAIL if any copy failed
+ * 		returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+u32 XFsbl_ZDmaCopyWaitAll(void)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 ChStatus;
+	u32 ChIndex;
+
+	for (ChIndex = 0U; ChIndex < ZDmaNumChannels; ChIndex++)
+	{
+		ChStatus = XFsbl_ZDmaWaitChannel(ChIndex);
+		if (XFSBL_SUCCESS != ChStatus) {
+			Status = ChStatus;
+		}
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * This function waits for the copy queued on a ZDMA channel to complete,
+ * acknowledges it and invalidates the destination in the data cache.
+ *
+ * @param	ChIndex is the index of the channel
+ *
+ * @return	returns XFSBL_ERROR_ZDMA_COPY_FAIL if the copy failed
+ * 		returns XFSBL_SUCCESS on success
+ *
+ *****************************************************************************/
+static u32 XFsbl_ZDmaWaitChannel(u32 ChIndex)
+{
+	u32 Status = XFSBL_SUCCESS;
+	u32 ChStatus;
+	XZDma *ZDmaPtr = &ZDmaCh[ChIndex];
+
+	if (ZDmaChBusy[ChIndex] == FALSE) {
+		goto END;
+	}
+
+	do {
+		ChStatus = XZDma_ReadReg(ZDmaPtr->Config.BaseAddress,
+				XZDMA_CH_STS_OFFSET) & XZDMA_STS_ALL_MASK;
+	} while (ChStatus == XZDMA_STS_BUSY_MASK);
+
+	XZDma_IntrClear(ZDmaPtr, XZDMA_IXR_ALL_INTR_MASK);
+	ZDmaPtr->ChannelState = XZDMA_IDLE;
+	ZDmaChBusy[ChIndex] = FALSE;
+
+	/* Drop lines prefetched while the copy was in flight */
+	Xil_DCacheInvalidateRange((INTPTR)ZDmaChDest[ChIndex],
+			ZDmaChLength[ChIndex]);
+
+	if (ChStatus != XZDMA_STS_DONE_MASK) {
+		XFsbl_Printf(DEBUG_GENERAL, "XFSBL_ERROR_ZDMA_COPY_FAIL, "
+				"channel %u status 0x%0lx \n\r", ChIndex, ChStatus);
+		Status = XFSBL_ERROR_ZDMA_COPY_FAIL;
+	}
+
+END:
+	return Status;
+}
+#endif /* XFSBL_ZDMA_COPY */
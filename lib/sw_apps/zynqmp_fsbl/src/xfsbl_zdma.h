@@ -0,0 +1,62 @@
+/******************************************************************************
+* Copyright (c) 2026 Xilinx, Inc.  All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file xfsbl_zdma.h
+ *
+ * This is the header file which contains ZDMA based asynchronous copy
+ * interface for the FSBL.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 1.00  kk   10/18/26 Initial release
+ *
+ * </pre>
+ *
+ * @note
+ *
+ ******************************************************************************/
+#ifndef XFSBL_ZDMA_H
+#define XFSBL_ZDMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xfsbl_hw.h"
+
+#ifdef XFSBL_ZDMA_COPY
+#include "xzdma.h"
+
+/************************** Constant Definitions *****************************/
+/**
+ * Number of ZDMA channels used for queuing partition copies
+ */
+#ifndef XFSBL_ZDMA_NUM_CHANNELS
+#define XFSBL_ZDMA_NUM_CHANNELS		(4U)
+#endif
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+u32 XFsbl_ZDmaInit(void);
+u32 XFsbl_ZDmaCopyStart(PTRSIZE SrcAddress, PTRSIZE DestAddress, u32 Length);
+u32 XFsbl_ZDmaCopyWaitAll(void);
+
+#endif /* XFSBL_ZDMA_COPY */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XFSBL_ZDMA_H */
@@ -41,6 +41,58 @@
 		PMU_IOMODULE_GPI1_MIO_WAKE_4_MASK | \
 		PMU_IOMODULE_GPI1_MIO_WAKE_5_MASK)
 
+#ifdef ENABLE_PM_IPI_LATENCY
+/* PIT3 is free running down from this value, one count per PMU clock */
+#define PM_IPI_LATENCY_PIT_PRELOAD	0xFFFFFFFFU
+#define PM_IPI_LATENCY_PIT_CTRL_EN	0x3U
+
+/**
+ * PmApiLatency - Service time statistics of a PM API
+ * @count	Number of requests served
+ * @last	Cycles taken by the last request
+ * @max		Worst case cycles observed
+ */
+typedef struct {
+	u32 count;
+	u32 last;
+	u32 max;
+} PmApiLatency;
+
+static PmApiLatency pmApiLatency[PM_API_MAX];
+
+/**
+ * PmIpiLatencyInit() - Start the time base used for PM API latency
+ */
+static void PmIpiLatencyInit(void)
+{
+	XPfw_Write32(PMU_IOMODULE_PIT3_PRELOAD, PM_IPI_LATENCY_PIT_PRELOAD);
+	XPfw_Write32(PMU_IOMODULE_PIT3_CONTROL, PM_IPI_LATENCY_PIT_CTRL_EN);
+}
+
+/**
+ * PmIpiLatencyRecord() - Account the service time of a PM API request
+ * @api		PM API ID of the request
+ * @start	PIT3 counter value latched when the request was received
+ */
+static void PmIpiLatencyRecord(const u32 api, const u32 start)
+{
+	/* PIT counts down, so elapsed cycles are start - now (mod 2^32) */
+	u32 cycles = start - XPfw_Read32(PMU_IOMODULE_PIT3_COUNTER);
+
+	if (api < PM_API_MAX) {
+		pmApiLatency[api].count++;
+		pmApiLatency[api].last = cycles;
+		if (cycles > pmApiLatency[api].max) {
+			pmApiLatency[api].max = cycles;
+		}
+		/* Runs in IPI handler context, print only in detailed debug */
+		XPfw_Printf(DEBUG_DETAILED, "PM API %lu: %lu cycles "
+			    "(max %lu, count %lu)\r\n", api, cycles,
+			    pmApiLatency[api].max, pmApiLatency[api].count);
+	}
+}
+#endif
+
 /**
  * XPfw_PmInit() - initializes PM firmware
  *
@@ -59,6 +111,10 @@ void XPfw_PmInit(void)
 
 	PmInfo("Power Management Init\r\n");
 
+#ifdef ENABLE_PM_IPI_LATENCY
+	PmIpiLatencyInit();
+#endif
+
 	if (bootType == PM_COLD_BOOT) {
 		PmMasterDefaultConfig();
 		PmNodeConstruct();
@@ -84,6 +140,9 @@ void XPfw_PmInit(void)
 s32 XPfw_PmIpiHandler(const u32 IsrMask, const u32* Payload, u8 Len)
 {
 	s32 status = XST_SUCCESS;
+#ifdef ENABLE_PM_IPI_LATENCY
+	u32 start = XPfw_Read32(PMU_IOMODULE_PIT3_COUNTER);
+#endif
 	PmMaster* master = PmGetMasterByIpiMask(IsrMask);
 
 	if ((NULL == Payload) || (NULL == master) || (Len < PAYLOAD_ELEM_CNT)) {
@@ -94,6 +153,10 @@ s32 XPfw_PmIpiHandler(const u32 IsrMask, const u32* Payload, u8 Len)
 	}
 
 	PmProcessRequest(master, Payload);
+#ifdef ENABLE_PM_IPI_LATENCY
+	/* The response has been written to the IPI buffer at this point */
+	PmIpiLatencyRecord(Payload[0], start);
+#endif
 
 done:
 	return status;
@@ -112,6 +112,12 @@ extern "C" {
  * 	                             line when system shutdown request comes
  *	- ENABLE_DYNAMIC_MIO_CONFIG: Enables IOCTL support for configuring MIO
  *				     regiisters
+ *	- ENABLE_PM_IPI_LATENCY: Measures, in PMU clock cycles, the time taken
+ *				 to serve each PM API IPI request and records
+ *				 the count, last and max per API in
+ *				 pmApiLatency. Each request is also printed
+ *				 when XPFW_DEBUG_DETAILED is enabled.
+ *				 Uses the otherwise unused PIT3 as time base.
  */
 #ifndef ENABLE_PM_VAL
 #define	ENABLE_PM_VAL						(1U)
@@ -281,6 +287,10 @@ extern "C" {
 #define ENABLE_DDR_XMPU_VAL			(0U)
 #endif
 
+#ifndef ENABLE_PM_IPI_LATENCY_VAL
+#define ENABLE_PM_IPI_LATENCY_VAL			(0U)
+#endif
+
 /*
  * XPFW_CFG_PMU_DEFAULT_WDT_TIMEOUT
  * 		Default watchdog timeout
@@ -563,6 +573,10 @@ extern "C" {
 #define ENABLE_DDR_XMPU
 #endif
 
+#if (ENABLE_PM_IPI_LATENCY_VAL) && (!defined(ENABLE_PM_IPI_LATENCY))
+#define ENABLE_PM_IPI_LATENCY
+#endif
+
 #ifdef __cplusplus
 }
 #endif
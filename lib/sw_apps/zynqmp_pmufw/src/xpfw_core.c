@@ -193,15 +193,21 @@ XStatus XPfw_CoreDispatchEvent(u32 EventId)
 {
 	XStatus Status;
 	u32 Idx;
+	u32 ModMask;
 	u32 CallCount = 0U;
 	if ((CorePtr != NULL) && (EventId < XPFW_EV_MAX)) {
-
-		for (Idx = 0U; Idx < CorePtr->ModCount; Idx++) {
+		/**
+		 * The owner mask of the event is the dispatch table: walk only
+		 * its set bits instead of every registered module
+		 */
+		ModMask = XPfw_EventGetModMask(EventId);
+		for (Idx = 0U; (ModMask != 0U) && (Idx < CorePtr->ModCount);
+				Idx++, ModMask >>= 1U) {
 			/**
 			 * Check if Mod[Idx] and event handler are registered for this event
 			 */
-			if (((XPfw_EventGetModMask(EventId) & ((u32) 1U << Idx))
-					== ((u32) 1U << Idx)) && (CorePtr->ModList[Idx].EventHandler != NULL)) {
+			if (((ModMask & 1U) != 0U) &&
+					(CorePtr->ModList[Idx].EventHandler != NULL)) {
 				CorePtr->ModList[Idx].EventHandler(&CorePtr->ModList[Idx],
 						EventId);
 				CallCount++;
@@ -231,11 +237,13 @@ XStatus XPfw_CoreDispatchIpi(u32 IpiNum, u32 SrcMask)
 		goto Done;
 	}
 
-	/* For each of the IPI sources */
-	for (MaskIndex = 0U; MaskIndex < XPFW_IPI_MASK_COUNT; MaskIndex++) {
+	/* For each of the IPI sources, until all pending sources are served */
+	for (MaskIndex = 0U; (MaskIndex < XPFW_IPI_MASK_COUNT) && (SrcMask != 0U);
+			MaskIndex++) {
 		/* Check if the Mask is set */
 		if ((SrcMask &
 				Ipi0InstPtr->Config.TargetList[MaskIndex].Mask) != 0U) {
+			SrcMask &= ~Ipi0InstPtr->Config.TargetList[MaskIndex].Mask;
 			/* If set, read the message into buffer */
 			Status = XPfw_IpiReadMessage(
 						Ipi0InstPtr->Config.TargetList[MaskIndex].Mask,
@@ -76,11 +76,15 @@ static void XPfw_InterruptGpi0Handler(void)
 static void XPfw_InterruptGpi1Handler(void)
 {
 	u32 EventId;
+	u32 GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI1);
 
-	for (EventId = XPFW_EV_APB_AIB_ERROR; EventId <= XPFW_EV_ACPU_0_WAKE;
-			++EventId) {
+	/*
+	 * Events are laid out from MSB to LSB of the GPI register, so the scan
+	 * can stop as soon as no pending bit is left below the current event
+	 */
+	for (EventId = XPFW_EV_APB_AIB_ERROR;
+			(EventId <= XPFW_EV_ACPU_0_WAKE) && (GpiRegVal != 0U); ++EventId) {
 		u32 RegMask = XPfw_EventGetRegMask(EventId);
-		u32 GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI1);
 
 		if ((GpiRegVal & RegMask) == RegMask) {
 			/* Dispatch the event to Registered Modules */
@@ -90,6 +94,8 @@ static void XPfw_InterruptGpi1Handler(void)
 				XPfw_Printf(DEBUG_DETAILED,"Warning: "
 						"Failed to dispatch Event ID: %lu\r\n", EventId);
 			}
+			/* Handlers may clear other GPI bits, so re-read what is left */
+			GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI1) & (RegMask - 1U);
 		}
 	}
 }
@@ -97,11 +103,15 @@ static void XPfw_InterruptGpi1Handler(void)
 static void XPfw_InterruptGpi2Handler(void)
 {
 	u32 EventId;
+	u32 GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI2);
 
+	/*
+	 * Events are laid out from MSB to LSB of the GPI register, so the scan
+	 * can stop as soon as no pending bit is left below the current event
+	 */
 	for (EventId = XPFW_EV_VCC_INT_FP_DISCONNECT;
-			EventId <= XPFW_EV_ACPU_0_SLEEP; ++EventId) {
+			(EventId <= XPFW_EV_ACPU_0_SLEEP) && (GpiRegVal != 0U); ++EventId) {
 		u32 RegMask = XPfw_EventGetRegMask(EventId);
-		u32 GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI2);
 
 		if ((GpiRegVal & RegMask) == RegMask) {
 			/* Dispatch the event to Registered Modules */
@@ -111,6 +121,8 @@ static void XPfw_InterruptGpi2Handler(void)
 				XPfw_Printf(DEBUG_DETAILED,"Warning: "
 						"Failed to dispatch Event ID: %lu\r\n", EventId);
 			}
+			/* Handlers may clear other GPI bits, so re-read what is left */
+			GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI2) & (RegMask - 1U);
 		}
 	}
 }
@@ -118,11 +130,15 @@ static void XPfw_InterruptGpi2Handler(void)
 static void XPfw_InterruptGpi3Handler(void)
 {
 	u32 EventId;
+	u32 GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI3);
 
+	/*
+	 * Events are laid out from MSB to LSB of the GPI register, so the scan
+	 * can stop as soon as no pending bit is left below the current event
+	 */
 	for (EventId = XPFW_EV_PL_GPI_31;
-			EventId <= XPFW_EV_PL_GPI_0; ++EventId) {
+			(EventId <= XPFW_EV_PL_GPI_0) && (GpiRegVal != 0U); ++EventId) {
 		u32 RegMask = XPfw_EventGetRegMask(EventId);
-		u32 GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI3);
 
 		if ((GpiRegVal & RegMask) == RegMask) {
 			/* Dispatch the event to Registered Modules */
@@ -132,6 +148,8 @@ static void XPfw_InterruptGpi3Handler(void)
 				XPfw_Printf(DEBUG_DETAILED,"Warning: "
 						"Failed to dispatch Event ID: %lu\r\n", EventId);
 			}
+			/* Handlers may clear other GPI bits, so re-read what is left */
+			GpiRegVal = XPfw_Read32(PMU_IOMODULE_GPI3) & (RegMask - 1U);
 		}
 	}
 }
@@ -21,39 +21,73 @@
 #define PIT_COUNTER_OFFSET	4U
 #define PIT_CONTROL_OFFSET	8U
 
-static u32 is_task_active(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+/**
+ * MicroBlaze MSR Interrupt Enable bit
+ */
+#define MB_MSR_IE_MASK		0x2U
+
+/**
+ * Returns TRUE when Tick has reached or passed Deadline. Written as a
+ * signed difference so that it stays correct across wrap of the tick count.
+ */
+static u32 is_deadline_reached(u32 Tick, u32 Deadline)
 {
-	u32 ReturnVal;
-
-	/* Periodic */
-	if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)
-		&& (0U == (SchedPtr->Tick
-				% SchedPtr->TaskList[TaskListIndex].Interval))) {
-		ReturnVal = (u32)TRUE;
-	} else if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-			&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		/* Non-Periodic */
-		ReturnVal = (u32)TRUE;
-	} else {
-		ReturnVal = (u32)FALSE;
+	return (((s32)(Tick - Deadline)) >= 0) ? (u32)TRUE : (u32)FALSE;
+}
+
+/**
+ * Walk the periodic tasks once to find the earliest pending deadline.
+ * Called only when the task set changes or a deadline expires, so the
+ * tick handler can skip the task list entirely on all other ticks.
+ */
+static void update_next_deadline(XPfw_Scheduler_t *SchedPtr)
+{
+	u32 Mask = SchedPtr->PeriodicMask;
+	u32 Idx;
+	u32 Deadline = SchedPtr->Tick + MASK32_ALL_HIGH / 2U;
+
+	for (Idx = 0U; Mask != 0U; Idx++, Mask >>= 1U) {
+		if (((Mask & 1U) != 0U) &&
+			((u32)TRUE != is_deadline_reached(
+				SchedPtr->TaskList[Idx].NextTick, Deadline))) {
+			Deadline = SchedPtr->TaskList[Idx].NextTick;
+		}
 	}
 
-	return ReturnVal;
+	SchedPtr->NextDeadline = Deadline;
 }
 
-static u32 is_task_non_periodic(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+/**
+ * Mask interrupts so the task list and masks can be updated without racing
+ * the tick handler. Returns the previous MSR so that callers running from
+ * an interrupt handler do not re-enable interrupts on the way out.
+ */
+static u32 sched_lock(void)
 {
-	u32 ReturnVal;
+	u32 Msr = mfmsr();
 
-	if ((0U == SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (NULL != SchedPtr->TaskList[TaskListIndex].Callback)) {
-		ReturnVal = (u32)TRUE;
-	} else {
-		ReturnVal = (u32)FALSE;
+	microblaze_disable_interrupts();
+
+	return Msr;
+}
+
+static void sched_unlock(u32 Msr)
+{
+	if ((Msr & MB_MSR_IE_MASK) != 0U) {
+		microblaze_enable_interrupts();
 	}
+}
 
-	return ReturnVal;
+static void remove_task(XPfw_Scheduler_t *SchedPtr, u32 TaskListIndex)
+{
+	u32 TaskBit = (u32)1U << TaskListIndex;
+
+	SchedPtr->TaskList[TaskListIndex].Interval = 0U;
+	SchedPtr->TaskList[TaskListIndex].OwnerId = 0U;
+	SchedPtr->TaskList[TaskListIndex].Callback = NULL;
+	SchedPtr->PeriodicMask &= ~TaskBit;
+	SchedPtr->OneShotMask &= ~TaskBit;
+	SchedPtr->TriggerMask &= ~TaskBit;
 }
 
 XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
@@ -71,11 +105,16 @@ XStatus XPfw_SchedulerInit(XPfw_Scheduler_t *SchedPtr, u32 PitBaseAddr)
 		SchedPtr->TaskList[Idx].Interval = 0U;
 		SchedPtr->TaskList[Idx].Callback = NULL;
 		SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
+		SchedPtr->TaskList[Idx].NextTick = 0U;
 	}
 
 	SchedPtr->Enabled = (u32)FALSE;
 	SchedPtr->PitBaseAddr = PitBaseAddr;
 	SchedPtr->Tick = 0U;
+	SchedPtr->PeriodicMask = 0U;
+	SchedPtr->OneShotMask = 0U;
+	SchedPtr->TriggerMask = 0U;
+	SchedPtr->NextDeadline = 0U;
 	XPfw_Write32(SchedPtr->PitBaseAddr + PIT_CONTROL_OFFSET, 0U);
 
 	/* Successfully completed init */
@@ -118,12 +157,35 @@ XStatus XPfw_SchedulerStop(XPfw_Scheduler_t *SchedPtr)
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 {
 	u32 Idx;
+	u32 Mask;
+	u32 Trigger;
 
 	SchedPtr->Tick++;
-	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
-		/* Check if it this task can be triggered */
-		if ((u32)TRUE == is_task_active(SchedPtr, Idx)) {
-			/* Mark the Task as TRIGGERED */
+
+	/* Non-Periodic tasks are triggered on the first tick after being added */
+	Trigger = SchedPtr->OneShotMask;
+
+	/* Nothing periodic is due before NextDeadline, skip the task list */
+	if ((SchedPtr->PeriodicMask != 0U) &&
+		((u32)TRUE == is_deadline_reached(SchedPtr->Tick,
+				SchedPtr->NextDeadline))) {
+		Mask = SchedPtr->PeriodicMask;
+		for (Idx = 0U; Mask != 0U; Idx++, Mask >>= 1U) {
+			if (((Mask & 1U) != 0U) &&
+				((u32)TRUE == is_deadline_reached(SchedPtr->Tick,
+					SchedPtr->TaskList[Idx].NextTick))) {
+				Trigger |= (u32)1U << Idx;
+				SchedPtr->TaskList[Idx].NextTick +=
+						SchedPtr->TaskList[Idx].Interval;
+			}
+		}
+		update_next_deadline(SchedPtr);
+	}
+
+	/* Mark the Tasks as TRIGGERED */
+	SchedPtr->TriggerMask |= Trigger;
+	for (Idx = 0U; Trigger != 0U; Idx++, Trigger >>= 1U) {
+		if ((Trigger & 1U) != 0U) {
 			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_TRIGGERED;
 		}
 	}
@@ -132,30 +194,53 @@ void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr)
 void XPfw_SchedulerProcess(XPfw_Scheduler_t *SchedPtr)
 {
 	u32 Idx;
-	u32 CallCount = 0U;
+	u32 Triggered;
+	u32 Msr;
+	XPfw_Callback_t Callback;
 
-	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
+	/* Fast path: no task has been triggered since the last pass */
+	if (0U == SchedPtr->TriggerMask) {
+		goto done;
+	}
+
+	/* Take the triggered set atomically w.r.t. the tick handler */
+	Msr = sched_lock();
+	Triggered = SchedPtr->TriggerMask;
+	SchedPtr->TriggerMask = 0U;
+	sched_unlock(Msr);
+
+	for (Idx = 0U; Triggered != 0U; Idx++, Triggered >>= 1U) {
+		Callback = SchedPtr->TaskList[Idx].Callback;
 		/* Check if the task is triggered and has a valid Callback */
-		if ((XPFW_TASK_STATUS_TRIGGERED == SchedPtr->TaskList[Idx].Status) &&
-			(NULL != SchedPtr->TaskList[Idx].Callback)) {
-			/* Execute the Task */
-			SchedPtr->TaskList[Idx].Callback();
+		if (((Triggered & 1U) != 0U) &&
+			(XPFW_TASK_STATUS_TRIGGERED == SchedPtr->TaskList[Idx].Status) &&
+			(NULL != Callback)) {
 			/* Disable the executed Task */
 			SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
-			CallCount++;
-	                /* Remove the Non-Periodic Task */
-		        if ((u32)TRUE == is_task_non_periodic(SchedPtr, Idx)) {
-			        SchedPtr->TaskList[Idx].Callback = NULL;
+			/* Remove the Non-Periodic Task, the callback may add it again */
+			if ((SchedPtr->OneShotMask & ((u32)1U << Idx)) != 0U) {
+				Msr = sched_lock();
+				remove_task(SchedPtr, Idx);
+				sched_unlock(Msr);
 			}
+			/* Execute the Task */
+			Callback();
 		}
 	}
+
+done:
+	return;
 }
 
 XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliSeconds, XPfw_Callback_t CallbackFn)
 {
 	u32 Idx;
+	u32 Interval;
+	u32 Msr;
 	XStatus Status;
 
+	Msr = sched_lock();
+
 	/* Get the Next Free Task Index */
 	for (Idx=0U;Idx < XPFW_SCHED_MAX_TASK;Idx++) {
 		if (NULL == SchedPtr->TaskList[Idx].Callback){
@@ -170,12 +255,25 @@ XStatus XPfw_SchedulerAddTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId,u32 MilliS
 	}
 
 	/* Add Interval as a factor of TICK_MILLISECONDS */
-	SchedPtr->TaskList[Idx].Interval = MilliSeconds/TICK_MILLISECONDS;
+	Interval = MilliSeconds/TICK_MILLISECONDS;
+	SchedPtr->TaskList[Idx].Interval = Interval;
 	SchedPtr->TaskList[Idx].OwnerId = OwnerId;
+	SchedPtr->TaskList[Idx].Status = XPFW_TASK_STATUS_DISABLED;
 	SchedPtr->TaskList[Idx].Callback = CallbackFn;
+
+	if (0U != Interval) {
+		/* Keep the period aligned to multiples of Interval ticks */
+		SchedPtr->TaskList[Idx].NextTick = SchedPtr->Tick + Interval -
+				(SchedPtr->Tick % Interval);
+		SchedPtr->PeriodicMask |= (u32)1U << Idx;
+		update_next_deadline(SchedPtr);
+	} else {
+		SchedPtr->OneShotMask |= (u32)1U << Idx;
+	}
 	Status = XST_SUCCESS;
 
 done:
+	sched_unlock(Msr);
 	return Status;
 }
 
@@ -183,6 +281,10 @@ XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 Mi
 {
 	u32 Idx;
 	u32 TaskCount = 0U;
+	u32 Msr;
+
+	/* The tick handler updates the same slots and masks */
+	Msr = sched_lock();
 
 	/*Find the Task Index */
 	for (Idx = 0U; Idx < XPFW_SCHED_MAX_TASK; Idx++) {
@@ -190,13 +292,17 @@ XStatus XPfw_SchedulerRemoveTask(XPfw_Scheduler_t *SchedPtr, u32 OwnerId, u32 Mi
 		    (SchedPtr->TaskList[Idx].OwnerId == OwnerId) &&
 		    ((SchedPtr->TaskList[Idx].Interval == (MilliSeconds/TICK_MILLISECONDS)) ||
 				(0U == MilliSeconds))) {
-			SchedPtr->TaskList[Idx].Interval = 0U;
-			SchedPtr->TaskList[Idx].OwnerId = 0U;
-			SchedPtr->TaskList[Idx].Callback = NULL;
+			remove_task(SchedPtr, Idx);
 			TaskCount++;
 		}
 	}
 
+	if (TaskCount > 0U) {
+		update_next_deadline(SchedPtr);
+	}
+
+	sched_unlock(Msr);
+
 	XPfw_Printf(DEBUG_DETAILED,"%s: Removed %lu tasks\r\n",
 			__func__, TaskCount);
 
@@ -25,6 +25,7 @@ struct XPfw_Task_t{
 	u32 Interval;
 	u32 OwnerId;
 	u32 Status;
+	u32 NextTick;	/**< Tick at which a periodic task is due next */
 	XPfw_Callback_t Callback;
 };
 
@@ -33,6 +34,10 @@ typedef struct {
 	u32 PitBaseAddr;
 	u32 Tick;
 	u32 Enabled;
+	u32 PeriodicMask;	/**< Bit n set when TaskList[n] is a periodic task */
+	u32 OneShotMask;	/**< Bit n set when TaskList[n] is a non-periodic task */
+	u32 TriggerMask;	/**< Bit n set when TaskList[n] is triggered */
+	u32 NextDeadline;	/**< Earliest NextTick among periodic tasks */
 } XPfw_Scheduler_t ;
 
 void XPfw_SchedulerTickHandler(XPfw_Scheduler_t *SchedPtr);
@@ -125,6 +125,7 @@
 *                       case of invalid header
 *       bm   01/20/2022 Fix compilation warnings in Xil_SMemCpy
 *       bsv  01/29/2022 Added redundancy to Status variable in XLoader_LoadImage
+*       kk   10/18/2026 Log image load as a span to trace log buffer
 *
 * </pre>
 *
@@ -1365,7 +1366,11 @@ static int XLoader_LoadImage(XilPdi *PdiPtr)
 	PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgName[XILPDI_IMG_NAME_ARRAY_SIZE - 1U] = 0;
 	/* Update current subsystem ID for EM */
 	XPlmi_SetEmSubsystemId(&PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
+	XPlmi_TraceSpanBegin(XPLMI_TRACE_SPAN_LOAD_IMAGE,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 	Status = XLoader_LoadImagePrtns(PdiPtr);
+	XPlmi_TraceSpanEnd(XPLMI_TRACE_SPAN_LOAD_IMAGE,
+		PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
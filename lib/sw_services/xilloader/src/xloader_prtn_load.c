@@ -85,6 +85,9 @@
 *       bsv  03/17/2022 Add support for A72 elfs to run from TCM
 *       bsv  03/23/2022 Minor change in loading of A72 elfs to TCM
 *       bsv  03/29/2022 Dump Ddrmc registers only when PLM DEBUG MODE is enabled
+*       kk   10/18/2026 Log partition load and CDO processing as spans to
+*                       trace log buffer
+*       kk   10/19/2026 Begin partition load span after header validation
 *
 * </pre>
 *
@@ -238,8 +241,16 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 			goto END;
 		}
 
+		/*
+		 * Span begins once the header is validated, so that no exit
+		 * leaves it open
+		 */
+		XPlmi_TraceSpanBegin(XPLMI_TRACE_SPAN_LOAD_PRTN,
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId);
 		/* Process Partition */
 		Status = XLoader_ProcessPrtn(PdiPtr);
+		XPlmi_TraceSpanEnd(XPLMI_TRACE_SPAN_LOAD_PRTN,
+			PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId);
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
@@ -657,6 +668,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 #endif
 
 	XPlmi_Printf(DEBUG_INFO, "Processing CDO partition \n\r");
+	XPlmi_TraceSpanBegin(XPLMI_TRACE_SPAN_CDO_PROCESS, 0U);
 	/*
 	 * Initialize the Cdo Pointer and
 	 * check CDO header contents
@@ -822,6 +834,7 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	Status = XST_SUCCESS;
 
 END:
+	XPlmi_TraceSpanEnd(XPLMI_TRACE_SPAN_CDO_PROCESS, 0U);
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	XPlmi_MeasurePerfTime((XPlmi_GetTimerValue() + CdoProcessTime),
 				&PerfTime);
@@ -8,6 +8,7 @@
 # ----- ---- -------- -----------------------------------------------
 # 1.00  kc   09/22/18 Initial Release
 # 1.10  ssc  03/05/22 Added configurable options
+#       kk   10/19/26 Added plm_trace_span_en option
 ##############################################################################
 
 #---------------------------------------------
@@ -158,6 +159,13 @@ proc xgen_opts_file {libhandle} {
 		puts $file_handle "#define PLM_ENABLE_STL"
 	}
 
+	# Get plm_trace_span_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_trace_span_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Boot step span logging enable */"
+		puts $file_handle "#define PLM_TRACE_SPAN"
+	}
+
 	puts $file_handle "\n"
 	close $file_handle
 }
@@ -42,6 +42,8 @@
 * 1.08  kpt  01/04/2022 Added PLM_PUF and PLM_PUF_EXCLUDE macros
 *       kpt  01/31/2022 Added description for PLM_PUF_EXCLUDE
 *       ssc  03/05/2022 Moved default config definitions to xparameters.h
+*       kk   10/18/2026 Added PLM_TRACE_SPAN macro
+*       kk   10/19/2026 Moved PLM_TRACE_SPAN to xparameters.h
 *
 * </pre>
 *
@@ -192,6 +194,17 @@ extern "C" {
 //#define PLM_PRINT_PERF_KEYHOLE
 //#define PLM_PRINT_PERF_PL
 
+/**
+ * Enabling the PLM_TRACE_SPAN logs begin and end of image load, partition
+ * load and CDO processing as spans to the trace log buffer. Unlike the
+ * above prints, spans do not add UART time to the measured boot time.
+ * Trace log buffer can be retrieved using the event logging IPI command.
+ * Please note that below is defined in xparameters.h based on the
+ * xilplmi library configuration, hence commented out here.
+ * This definition is disabled by default (i.e. not defined).
+ */
+//#define PLM_TRACE_SPAN
+
 #define XPLMI_MJTAG_WA_GASKET_TOGGLE_CNT 10U /**< Number of clock cyles required
 					to change tap state to RESET */
 #define XPLMI_MJTAG_WA_DELAY_USED_IN_GASKET_TOGGLE 1U /**< Delay in usec in
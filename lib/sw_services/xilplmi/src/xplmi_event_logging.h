@@ -29,6 +29,7 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+*       kk   10/18/2026 Added span begin and end trace events
 *
 *
 * </pre>
@@ -47,6 +48,7 @@ extern "C" {
 /***************************** Include Files *********************************/
 #include "xplmi_cmd.h"
 #include "xplmi_util.h"
+#include "xplmi_config.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -93,6 +95,13 @@ void XPlmi_InitDebugLogBuffer(void);
 
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_LOG_SPAN_BEGIN		(0x2U)
+#define XPLMI_TRACE_LOG_SPAN_END		(0x3U)
+
+/* Span IDs logged as first payload word of span begin and end events */
+#define XPLMI_TRACE_SPAN_LOAD_IMAGE		(0x1U)
+#define XPLMI_TRACE_SPAN_LOAD_PRTN		(0x2U)
+#define XPLMI_TRACE_SPAN_CDO_PROCESS		(0x3U)
 
 /*
  * Trace log functions
@@ -169,6 +178,55 @@ static inline void XPlmi_TraceLog5(u32 Header, u32 Arg1, u32 Arg2, u32 Arg3)
 	XPlmi_StoreTraceLog(TraceBuffer, XPLMI_ARRAY_SIZE(TraceBuffer));
 }
 
+/*
+ * Span functions
+ * A span is logged as a SPAN_BEGIN and a SPAN_END event with the same
+ * span ID, so that the time spent in a boot step can be derived from the
+ * retrieved trace buffer without printing to UART.
+ * 		3U - Span ID
+ * 		4U - Span argument (Image ID, Partition ID, ...)
+ * Spans are logged only when PLM_TRACE_SPAN is defined.
+ */
+/*****************************************************************************/
+/**
+ * @brief	This function logs beginning of a span to trace buffer
+ *
+ * @param 	SpanId is the ID of the span
+ * @param	Arg is the argument of the span
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static inline void XPlmi_TraceSpanBegin(u32 SpanId, u32 Arg)
+{
+#ifdef PLM_TRACE_SPAN
+	XPlmi_TraceLog4(XPLMI_TRACE_LOG_SPAN_BEGIN, SpanId, Arg);
+#else
+	(void)SpanId;
+	(void)Arg;
+#endif
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function logs end of a span to trace buffer
+ *
+ * @param 	SpanId is the ID of the span
+ * @param	Arg is the argument of the span
+ *
+ * @return	None
+ *
+ *****************************************************************************/
+static inline void XPlmi_TraceSpanEnd(u32 SpanId, u32 Arg)
+{
+#ifdef PLM_TRACE_SPAN
+	XPlmi_TraceLog4(XPLMI_TRACE_LOG_SPAN_END, SpanId, Arg);
+#else
+	(void)SpanId;
+	(void)Arg;
+#endif
+}
+
 /************************** Variable Definitions *****************************/
 extern XPlmi_LogInfo *DebugLog;
 
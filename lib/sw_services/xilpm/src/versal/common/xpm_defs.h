@@ -180,6 +180,8 @@ enum pm_query_id {
 	XPM_QID_CLOCK_GET_NUM_CLOCKS,			/**< Get number of clocks */
 	XPM_QID_CLOCK_GET_MAX_DIVISOR,			/**< Get max clock divisor */
 	XPM_QID_PLD_GET_PARENT,				/**< Get PLD parent */
+	XPM_QID_CLOCK_GET_BATCH_INFO,			/**< Get one field of a
+							  page of clocks */
 };
 
 /**
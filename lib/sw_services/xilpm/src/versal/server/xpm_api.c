@@ -109,7 +109,8 @@
 	(1ULL << (u64)XPM_QID_PINCTRL_GET_PIN_GROUPS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_NUM_CLOCKS) | \
 	(1ULL << (u64)XPM_QID_CLOCK_GET_MAX_DIVISOR) | \
-	(1ULL << (u64)XPM_QID_PLD_GET_PARENT))
+	(1ULL << (u64)XPM_QID_PLD_GET_PARENT) | \
+	(1ULL << (u64)XPM_QID_CLOCK_GET_BATCH_INFO))
 
 u32 ResetReason;
 
@@ -2784,6 +2785,10 @@ XStatus XPm_Query(const u32 Qid, const u32 Arg1, const u32 Arg2,
 	case (u32)XPM_QID_PLD_GET_PARENT:
 		Status = XPmPlDevice_GetParent(Arg1, Output);
 		break;
+	case (u32)XPM_QID_CLOCK_GET_BATCH_INFO:
+		/* Arg1: first clock index, Arg2: CLK_BATCH_FIELD_* */
+		Status = XPmClock_QueryBatchInfo(Arg1, Arg2, Output);
+		break;
 	default:
 		Status = XST_INVALID_PARAM;
 		break;
@@ -13,6 +13,7 @@
 
 /* Query related defines */
 #define CLK_QUERY_NAME_LEN		(MAX_NAME_BYTES)
+#define CLK_VALID_MASK			BIT(0)
 #define CLK_INIT_ENABLE_SHIFT		1U
 #define CLK_TYPE_SHIFT			2U
 #define CLK_NODETYPE_SHIFT		14U
@@ -983,7 +984,7 @@ XStatus XPmClock_QueryAttributes(u32 ClockIndex, u32 *Resp)
 
 	/* Clock valid bit. All clocks present in clock database is valid. */
 	if (NULL != ClkNodeList[ClockIndex]) {
-		Attr = 1U;
+		Attr = CLK_VALID_MASK;
 		Clk = ClkNodeList[ClockIndex];
 		ClockId = Clk->Node.Id;
 	} else {
@@ -1039,6 +1040,110 @@ done:
 	return Status;
 }
 
+/****************************************************************************/
+/**
+ * @brief  Return one field for a page of consecutive clocks, so that a client
+ * can enumerate the clock tree with one request per page instead of one
+ * request per clock
+ *
+ * @param StartIndex	Index of the first clock to report
+ * @param Field		CLK_BATCH_FIELD_* to report
+ * @param Resp		Resp[0] is the number of clocks reported, followed by
+ *			the field of each clock. The next page starts at
+ *			StartIndex + Resp[0].
+ *
+ * @return XST_SUCCESS if successful else XST_INVALID_PARAM
+ *
+ * @note   Each field holds the same data as the Index 0 response of the
+ * matching single query, or zero for clocks which are not valid. Clocks with
+ * more than 3 topology nodes or parents need the single queries for the rest.
+ *
+ ****************************************************************************/
+XStatus XPmClock_QueryBatchInfo(u32 StartIndex, u32 Field, u32 *Resp)
+{
+	XStatus Status = XST_FAILURE;
+	const XPm_ClockNode *Clk;
+	u32 FieldWords;
+	u32 NumClocks;
+	u32 ClockIndex;
+	u32 ClockId;
+	u32 Attr;
+	u32 *Rec;
+
+	switch (Field) {
+	case CLK_BATCH_FIELD_ATTR:
+	case CLK_BATCH_FIELD_RATE:
+		FieldWords = 1U;
+		break;
+	case CLK_BATCH_FIELD_NAME:
+		FieldWords = 4U;
+		break;
+	case CLK_BATCH_FIELD_TOPOLOGY:
+	case CLK_BATCH_FIELD_PARENTS:
+		FieldWords = 3U;
+		break;
+	default:
+		FieldWords = 0U;
+		break;
+	}
+	if ((0U == FieldWords) || (StartIndex >= MaxClkNodes)) {
+		Status = XST_INVALID_PARAM;
+		goto done;
+	}
+
+	NumClocks = CLK_BATCH_PAYLOAD_WORDS / FieldWords;
+	if (NumClocks > (MaxClkNodes - StartIndex)) {
+		NumClocks = MaxClkNodes - StartIndex;
+	}
+
+	Status = Xil_SMemSet(&Resp[1], CLK_BATCH_PAYLOAD_WORDS * sizeof(u32), 0,
+			     CLK_BATCH_PAYLOAD_WORDS * sizeof(u32));
+	if (XST_SUCCESS != Status) {
+		goto done;
+	}
+
+	Rec = &Resp[1];
+	for (ClockIndex = StartIndex; ClockIndex < (StartIndex + NumClocks);
+	     ClockIndex++) {
+		Status = XPmClock_QueryAttributes(ClockIndex, &Attr);
+		if (XST_SUCCESS != Status) {
+			goto done;
+		}
+
+		/* Only clocks reported as valid are described further */
+		Clk = ClkNodeList[ClockIndex];
+		if (CLK_BATCH_FIELD_ATTR == Field) {
+			Rec[0] = Attr;
+		} else if ((NULL != Clk) && (0U != (Attr & CLK_VALID_MASK))) {
+			ClockId = Clk->Node.Id;
+			if (CLK_BATCH_FIELD_NAME == Field) {
+				(void)XPmClock_QueryName(ClockId, Rec);
+			} else if (CLK_BATCH_FIELD_TOPOLOGY == Field) {
+				(void)XPmClock_QueryTopology(ClockId, 0U, Rec);
+			} else if (CLK_BATCH_FIELD_RATE == Field) {
+				Rec[0] = Clk->ClkRate;
+			} else if (ISPLL(ClockId)) {
+				(void)XPmClockPll_QueryMuxSources(ClockId, 0U,
+								  Rec);
+			} else if (ISOUTCLK(ClockId)) {
+				(void)XPmClock_QueryMuxSources(ClockId, 0U, Rec);
+			} else {
+				/* Reference clocks have no parents */
+				Rec[0] = 0xFFFFFFFFU;
+			}
+		} else {
+			/* Field left zero for clocks which are not valid */
+		}
+		Rec = &Rec[FieldWords];
+	}
+
+	Resp[0] = NumClocks;
+	Status = XST_SUCCESS;
+
+done:
+	return Status;
+}
+
 XStatus XPmClock_GetNumClocks(u32 *Resp)
 {
 	*Resp = (u32)XPM_NODEIDX_CLK_MAX;
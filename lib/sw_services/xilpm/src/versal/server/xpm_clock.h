@@ -36,6 +36,18 @@ extern "C" {
 #define MAX_MUX_PARENTS		8U
 #define MAX_NAME_BYTES		16U
 
+/*
+ * Fields reported by XPM_QID_CLOCK_GET_BATCH_INFO. Each holds the same data as
+ * the Index 0 response of the matching single query.
+ */
+#define CLK_BATCH_FIELD_ATTR		0U	/* GET_ATTRIBUTES, 1 word */
+#define CLK_BATCH_FIELD_NAME		1U	/* GET_NAME, 4 words */
+#define CLK_BATCH_FIELD_TOPOLOGY	2U	/* GET_TOPOLOGY, 3 words */
+#define CLK_BATCH_FIELD_PARENTS		3U	/* GET_MUXSOURCES, 3 words */
+#define CLK_BATCH_FIELD_RATE		4U	/* Clock rate, 1 word */
+/* Response words after the status and the clock count */
+#define CLK_BATCH_PAYLOAD_WORDS		6U
+
 /* Clock Flags */
 #define CLK_FLAG_READ_ONLY		(1U << 0U)
 
@@ -173,6 +185,7 @@ XStatus XPmClock_QueryTopology(u32 ClockId, u32 Index, u32 *Resp);
 XStatus XPmClock_QueryFFParams(u32 ClockId, u32 *Resp);
 XStatus XPmClock_QueryMuxSources(u32 ClockId, u32 Index, u32 *Resp);
 XStatus XPmClock_QueryAttributes(u32 ClockIndex, u32 *Resp);
+XStatus XPmClock_QueryBatchInfo(u32 StartIndex, u32 Field, u32 *Resp);
 XStatus XPmClock_GetNumClocks(u32 *Resp);
 XStatus XPmClock_CheckPermissions(u32 SubsystemIdx, u32 ClockId);
 XStatus XPmClock_GetMaxDivisor(u32 ClockId, u32 DivType, u32 *Resp);
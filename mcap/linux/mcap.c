@@ -54,6 +54,20 @@ static char help_msg[] =
 "\n"
 ;
 
+static void MCapShowProgress(void *ref, size_t done, size_t total)
+{
+	unsigned int pct;
+
+	(void)ref;
+
+	/* Trailing bytes that do not form a word are not written */
+	pct = done + 3 >= total ? 100 : (unsigned int)(done * 100 / total);
+	printf("\rProgramming: %3u%%", pct);
+	if (pct == 100)
+		printf("\n");
+	fflush(stdout);
+}
+
 int main(int argc, char **argv)
 {
 	struct mcap_dev *mdev;
@@ -114,6 +128,8 @@ int main(int argc, char **argv)
 	if (!mdev)
 		return 1;
 
+	MCapSetProgress(mdev, MCapShowProgress, NULL);
+
 	if (verbose) {
 		MCapShowDevice(mdev, verbose);
 		goto free;
@@ -47,6 +47,20 @@
 #define MCAP_BIT_FILE	".bit"
 #define MCAP_BIN_FILE	".bin"
 
+/*
+ * Bitstream source. RBT files are parsed line by line, BIT and BIN files
+ * are mapped and converted to register order one chunk at a time, so only
+ * one chunk of the bitstream is held in memory.
+ */
+struct mcap_stream {
+	FILE *fptr;		/* RBT file, NULL for mapped files */
+	const u8 *map;		/* Mapped BIT/BIN file */
+	size_t pos;		/* Next byte of the mapped file */
+	size_t size;		/* Size of the file */
+	u32 sync;		/* Sync word still to be written */
+	u32 *buf;		/* MCAP_CHUNK_WORDS words */
+};
+
 static char *MCapFindTypeofFile(const char *s1, const char *s2)
 {
 	size_t l1, l2;
@@ -65,14 +79,14 @@ static char *MCapFindTypeofFile(const char *s1, const char *s2)
 	return NULL;
 }
 
-static u32 MCapProcessRBT(FILE *fptr, u32 *buf)
+static u32 MCapProcessRBT(FILE *fptr, u32 *buf, u32 max)
 {
 	char *raw = NULL;
 	int i, read;
-	size_t linelen;
+	size_t linelen = 0;
 	u32 count = 0, len = 0, result = 0;
 
-	while ((read = getline(&raw, &linelen, fptr)) != -1) {
+	while (len < max && (read = getline(&raw, &linelen, fptr)) != -1) {
 		if (raw[0] != '1' && raw[1] != '0')
 			continue;
 
@@ -90,67 +104,157 @@ static u32 MCapProcessRBT(FILE *fptr, u32 *buf)
 		}
 	}
 
+	free(raw);
+
 	return len;
 }
 
-static u32 MCapProcessBIT(FILE *fptr, u32 *buf, int sz)
+/*
+ * Copies words from a mapped file to the write buffer, swapping each 32-bit
+ * word from bitstream (big endian) to register order. Two words are swapped
+ * per 64-bit load.
+ */
+static void MCapSwapWords(u32 *dst, const u8 *src, u32 len)
 {
-	int err;
-	u8 value, len = 0;
+	uint64_t val;
+	u32 word;
+	u32 i;
+
+	for (i = 0; i + 1 < len; i += 2) {
+		memcpy(&val, src + i * 4, sizeof(val));
+		val = ((val & 0xFF00FF00FF00FF00ULL) >> 8) |
+		      ((val & 0x00FF00FF00FF00FFULL) << 8);
+		val = ((val & 0xFFFF0000FFFF0000ULL) >> 16) |
+		      ((val & 0x0000FFFF0000FFFFULL) << 16);
+		memcpy(dst + i, &val, sizeof(val));
+	}
+
+	if (i < len) {
+		memcpy(&word, src + i * 4, sizeof(word));
+		dst[i] = __bswap_32(word);
+	}
+}
+
+static int MCapProcessBIT(struct mcap_stream *strm)
+{
+	size_t i;
 
 	/*
 	 * .bit files are not guaranteed to be aligned with
 	 * the bitstream sync word on a 32-bit boundary. So,
 	 * we need to check every byte here.
 	 */
-	while ((err = fread(&value, 1, 1, fptr)) == 1) {
-		len++; if (value == MCAP_SYNC_BYTE0)
-		  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-		    len++; if (value == MCAP_SYNC_BYTE1)
-		      if ((err = fread(&value, 1, 1, fptr)) == 1) {
-			len++; if (value == MCAP_SYNC_BYTE2)
-			  if ((err = fread(&value, 1, 1, fptr)) == 1) {
-				len++; if (value == MCAP_SYNC_BYTE3)
-					break;
-			  }
-		      }
-		}
+	for (i = 0; i + 4 <= strm->size; i++) {
+		if (strm->map[i] == MCAP_SYNC_BYTE0 &&
+		    strm->map[i + 1] == MCAP_SYNC_BYTE1 &&
+		    strm->map[i + 2] == MCAP_SYNC_BYTE2 &&
+		    strm->map[i + 3] == MCAP_SYNC_BYTE3)
+			break;
 	}
 
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
-		return 0;
+	if (i + 4 > strm->size) {
+		pr_err("Failed to find SYNC Word in BIT file\n");
+		return -EMCAPCFG;
 	}
 
-	if (err != 1 && feof(fptr)) {
-		pr_err("Failed to find SYNC Word in BIT file\n");
-		return 0;
+	strm->pos = i + 4;
+	strm->sync = 1;
+
+	return 0;
+}
+
+static int MCapProcessBIN(struct mcap_stream *strm)
+{
+	strm->pos = 0;
+	strm->sync = 0;
+
+	return 0;
+}
+
+/* Fills the write buffer with the next chunk, returns the number of words */
+static u32 MCapStreamRead(struct mcap_stream *strm)
+{
+	u32 len = 0, words;
+
+	if (strm->fptr)
+		return MCapProcessRBT(strm->fptr, strm->buf, MCAP_CHUNK_WORDS);
+
+	if (strm->sync) {
+		strm->buf[len++] = MCAP_SYNC_DWORD;
+		strm->sync = 0;
+	}
+
+	words = MCAP_CHUNK_WORDS - len;
+	if ((strm->size - strm->pos) / 4 < words)
+		words = (strm->size - strm->pos) / 4;
+
+	MCapSwapWords(strm->buf + len, strm->map + strm->pos, words);
+	strm->pos += (size_t)words * 4;
+
+	return len + words;
+}
+
+static size_t MCapStreamPos(struct mcap_stream *strm)
+{
+	long pos;
+
+	if (strm->fptr) {
+		pos = ftell(strm->fptr);
+		return pos < 0 ? 0 : (size_t)pos;
 	}
 
-	*buf++ = __bswap_32(MCAP_SYNC_DWORD);
+	return strm->pos;
+}
 
-	while ((err = fread(buf, sz - len, 1, fptr)) == 1)
-		;
+/*
+ * Writes words to the MCAP Data register. With the sysfs config file open
+ * each word is one pwrite at the Data register offset; the kernel advances
+ * the offset within a write, so several words can not be merged in one call.
+ */
+static int MCapWriteData(struct mcap_dev *mdev, const u32 *data, u32 len)
+{
+	off_t off = mdev->reg_base + MCAP_DATA;
+	u32 count;
 
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIT file\n");
+	if (mdev->cfg_fd < 0) {
+		for (count = 0; count < len; count++)
+			MCapRegWrite(mdev, MCAP_DATA, data[count]);
 		return 0;
 	}
 
-	return (sz - len)/4 + 1;
+	for (count = 0; count < len; count++) {
+		if (pwrite(mdev->cfg_fd, &data[count], sizeof(u32), off) !=
+		    sizeof(u32)) {
+			pr_err("Failed to write MCAP Data register\n");
+			return -EMCAPWRITE;
+		}
+	}
+
+	return 0;
 }
 
-static u32 MCapProcessBIN(FILE *fptr, u32 *buf, int sz)
+/*
+ * Writes the whole bitstream starting with the chunk already in the write
+ * buffer, reporting progress after each chunk.
+ */
+static int MCapStreamBitStream(struct mcap_dev *mdev,
+			       struct mcap_stream *strm, u32 len)
 {
 	int err;
 
-	err = fread(buf, sz, 1, fptr);
-	if (err != 1 && !feof(fptr)) {
-		pr_err("Failed to Read BIN file\n");
-		return 0;
+	while (len) {
+		err = MCapWriteData(mdev, strm->buf, len);
+		if (err)
+			return err;
+
+		if (mdev->progress)
+			mdev->progress(mdev->progress_ref,
+				       MCapStreamPos(strm), strm->size);
+
+		len = MCapStreamRead(strm);
 	}
 
-	return sz/4;
+	return 0;
 }
 
 static int MCapDoBusWalk(struct mcap_dev *mdev)
@@ -220,13 +324,14 @@ static int Checkforcompletion(struct mcap_dev *mdev)
 	return 0;
 }
 
-static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
-					int len, u8 bswap)
+static int MCapWritePartialBitStream(struct mcap_dev *mdev,
+				     struct mcap_stream *strm)
 {
-	u32 set, restore;
-	int err, count = 0, i;
+	u32 set, restore, len;
+	int err, i;
 
-	if (!data || !len) {
+	len = MCapStreamRead(strm);
+	if (!len) {
 		pr_err("Invalid Arguments\n");
 		return -EMCAPWRITE;
 	}
@@ -254,12 +359,10 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	MCapRegWrite(mdev, MCAP_CONTROL, set);
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
+	err = MCapStreamBitStream(mdev, strm, len);
+	if (err) {
+		MCapRegWrite(mdev, MCAP_CONTROL, restore);
+		return err;
 	}
 
 	for (i = 0 ; i < EMCAP_EOS_LOOP_COUNT; i++) {
@@ -283,13 +386,13 @@ static int MCapWritePartialBitStream(struct mcap_dev *mdev, u32 *data,
 	return 0;
 }
 
-static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
-			      int len, u8 bswap)
+static int MCapWriteBitStream(struct mcap_dev *mdev, struct mcap_stream *strm)
 {
-	u32 set, restore;
-	int err, count = 0;
+	u32 set, restore, len;
+	int err;
 
-	if (!data || !len) {
+	len = MCapStreamRead(strm);
+	if (!len) {
 		pr_err("Invalid Arguments\n");
 		return -EMCAPWRITE;
 	}
@@ -319,12 +422,10 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 	}
 
 	/* Write Data */
-	if (!bswap) {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, data[count]);
-	} else {
-		for (count = 0; count < len; count++)
-			MCapRegWrite(mdev, MCAP_DATA, __bswap_32(data[count]));
+	err = MCapStreamBitStream(mdev, strm, len);
+	if (err) {
+		MCapRegWrite(mdev, MCAP_CONTROL, restore);
+		return err;
 	}
 
 	/* Check for Completion */
@@ -350,11 +451,34 @@ static int MCapWriteBitStream(struct mcap_dev *mdev, u32 *data,
 void MCapLibFree(struct mcap_dev *mdev)
 {
 	if (mdev) {
+		if (mdev->cfg_fd >= 0)
+			close(mdev->cfg_fd);
 		pci_cleanup(mdev->pacc);
 		free(mdev);
 	}
 }
 
+static void MCapOpenConfig(struct mcap_dev *mdev)
+{
+	char path[64];
+
+	snprintf(path, sizeof(path),
+		 "/sys/bus/pci/devices/%04x:%02x:%02x.%d/config",
+		 mdev->pdev->domain, mdev->pdev->bus, mdev->pdev->dev,
+		 mdev->pdev->func);
+
+	mdev->cfg_fd = open(path, O_WRONLY);
+	if (mdev->cfg_fd < 0)
+		pr_dbg("Using libpci for MCAP Data writes\n");
+}
+
+void MCapSetProgress(struct mcap_dev *mdev, mcap_progress_t progress,
+		     void *ref)
+{
+	mdev->progress = progress;
+	mdev->progress_ref = ref;
+}
+
 struct mcap_dev *MCapLibInit(int device_id)
 {
 	struct pci_dev *dev;
@@ -368,7 +492,11 @@ struct mcap_dev *MCapLibInit(int device_id)
 	/* Get the pci_access structure */
 	mdev->pacc = pci_alloc();
 
+	mdev->pdev = NULL;
 	mdev->is_multiplebit = 0;
+	mdev->cfg_fd = -1;
+	mdev->progress = NULL;
+	mdev->progress_ref = NULL;
 
 	/* Initialize the PCI library */
 	pci_init(mdev->pacc);
@@ -401,6 +529,12 @@ struct mcap_dev *MCapLibInit(int device_id)
 		goto free_resources;
 	}
 
+	/*
+	 * Bitstream words are written straight to the sysfs config file,
+	 * the library accessors are used if it can not be opened.
+	 */
+	MCapOpenConfig(mdev);
+
 	return mdev;
 
 free_resources:
@@ -591,42 +725,60 @@ void MCapDumpRegs(struct mcap_dev *mdev)
 
 int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
 {
-	FILE *fptr;
-	u32 *data;
-	u32 binsz, wrdatasz;
-	int err = 0;
-	u8 bswap = 0;
+	struct mcap_stream strm;
+	struct stat st;
+	void *map = MAP_FAILED;
+	int fd, err = 0;
+
+	memset(&strm, 0, sizeof(strm));
 
 	/* Get the size */
-	fptr = fopen(file_path, "rb");
-	if (fptr == NULL)
+	fd = open(file_path, O_RDONLY);
+	if (fd < 0)
 		return -EMCAPCFG;
-	fseek(fptr, 0L, SEEK_END);
-	binsz = ftell(fptr);
-	fseek(fptr, 0L, SEEK_SET);
+	if (fstat(fd, &st) < 0 || !st.st_size) {
+		close(fd);
+		return -EMCAPCFG;
+	}
+	strm.size = st.st_size;
 
-	/* Allocate the buffer */
-	data = malloc(binsz);
-	if (data == NULL)
+	/* Allocate the buffer for one chunk */
+	strm.buf = malloc(MCAP_CHUNK_WORDS * sizeof(u32));
+	if (strm.buf == NULL) {
+		close(fd);
 		return -EMCAPCFG;
+	}
 
 	/* Process files and Read the data */
 	if (MCapFindTypeofFile(file_path, MCAP_RBT_FILE)) {
 
 		/* Read the RBT file */
-		wrdatasz = MCapProcessRBT(fptr, data);
-
-	} else if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE)) {
+		strm.fptr = fdopen(fd, "r");
+		if (strm.fptr == NULL) {
+			close(fd);
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
+		fd = -1;
 
-		/* Read the BIT file */
-		wrdatasz = MCapProcessBIT(fptr, data, binsz);
-		bswap = 1;
+	} else if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE) ||
+		   MCapFindTypeofFile(file_path, MCAP_BIN_FILE)) {
 
-	} else if (MCapFindTypeofFile(file_path, MCAP_BIN_FILE)) {
+		map = mmap(NULL, strm.size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (map == MAP_FAILED) {
+			pr_err("Failed to map %s\n", file_path);
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
+		madvise(map, strm.size, MADV_SEQUENTIAL);
+		strm.map = map;
 
-		/* Read the BIN file */
-		wrdatasz = MCapProcessBIN(fptr, data, binsz);
-		bswap = 1;
+		if (MCapFindTypeofFile(file_path, MCAP_BIT_FILE))
+			err = MCapProcessBIT(&strm);
+		else
+			err = MCapProcessBIN(&strm);
+		if (err)
+			goto free_resources;
 
 	} else {
 		pr_err("Unknown File Format.. This may be");
@@ -638,21 +790,29 @@ int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type)
 
 	/* Program FPGA */
 	if (bitfile_type == EMCAP_PARTIALCONFIG_FILE) {
-		err = MCapWritePartialBitStream(mdev, data, wrdatasz, bswap);
-		if (err)
-			return -EMCAPCFG;
+		err = MCapWritePartialBitStream(mdev, &strm);
+		if (err) {
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
 		pr_info("FPGA Partial Configuration Done!!\n");
 	} else if (bitfile_type == EMCAP_CONFIG_FILE) {
-		err = MCapWriteBitStream(mdev, data, wrdatasz, bswap);
-		if (err)
-			return -EMCAPCFG;
+		err = MCapWriteBitStream(mdev, &strm);
+		if (err) {
+			err = -EMCAPCFG;
+			goto free_resources;
+		}
 		pr_info("FPGA Configuration Done!!\n");
 	}
 
 free_resources:
-	if (data)
-		free(data);
-	fclose(fptr);
+	if (map != MAP_FAILED)
+		munmap(map, strm.size);
+	if (strm.fptr)
+		fclose(strm.fptr);
+	if (fd >= 0)
+		close(fd);
+	free(strm.buf);
 
 	return err;
 }
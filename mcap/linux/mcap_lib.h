@@ -35,6 +35,10 @@
 #include <string.h>
 #include <ctype.h>
 #include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 #include "pci.h"
 #include "lspci.h"
@@ -90,6 +94,9 @@
 #define EMCAP_EOS_LOOP_COUNT 100
 #define EMCAP_NOOP_VAL	0x2000000
 
+/* Words written to the MCAP Data register per chunk of the bitstream */
+#define MCAP_CHUNK_WORDS	16384
+
 /* Bitfile Type */
 #define EMCAP_CONFIG_FILE	 0
 #define EMCAP_PARTIALCONFIG_FILE 1
@@ -104,12 +111,21 @@
 #define pr_info printf
 #define pr_err	printf
 
+/*
+ * Progress callback, called after each chunk of the bitstream is written
+ * with the number of bytes of the file processed and the file size.
+ */
+typedef void (*mcap_progress_t)(void *ref, size_t done, size_t total);
+
 /* MCAP Device Information */
 struct mcap_dev {
 	struct pci_dev *pdev;
 	struct pci_access *pacc;
 	unsigned int reg_base;
 	u32 is_multiplebit;
+	int cfg_fd;			/* sysfs config file, -1 if not open */
+	mcap_progress_t progress;
+	void *progress_ref;
 };
 
 #define MCapRegWrite(mdev, offset, value) \
@@ -158,3 +174,5 @@ int MCapShowDevice(struct mcap_dev *mdev, int verbose);
 int MCapConfigureFPGA(struct mcap_dev *mdev, char *file_path, u32 bitfile_type);
 int MCapReadRegisters(struct mcap_dev *mdev, u32 *data);
 int MCapAccessConfigSpace(struct mcap_dev *mdev, int argc, char **argv);
+void MCapSetProgress(struct mcap_dev *mdev, mcap_progress_t progress,
+		     void *ref);